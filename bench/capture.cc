@@ -0,0 +1,105 @@
+//! Capture latency of the Linux MIT-SHM ScreenLens, one line per frame.
+//!
+//!   export DISPLAY=:99 && Xvfb :99 -screen 0 1920x1080x24 &
+//!   ./build/Release/capture_bench --frames=1000 --size=17
+//!
+//! The cursor is not needed, the bound walks diagonally over the screen
+//! so every frame reads a different block.
+
+#include <chrono>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+#include "../src/linux/ScreenLens.h"
+#include "../src/parameters.h"
+
+
+static int
+ParameterOf(int argc, char** argv, const char* name, int default_value)
+{
+    const auto name_length = strlen(name);
+    for(int idx = 1; idx < argc; ++idx)
+    {
+        if( strncmp(argv[idx], name, name_length) == 0 )
+        {
+            return atoi(argv[idx] + name_length);
+        }
+    }
+    return default_value;
+}
+
+
+int
+main(int argc, char** argv)
+{
+    const int frames = std::max(1, ParameterOf(argc, argv, "--frames=", 1000));
+    const int size = ParameterOf(argc, argv, "--size=", CAPTURE_WIDTH);
+
+    class ScreenLens* screen_lens_ptr = nullptr;
+    try
+    {
+        screen_lens_ptr = new class ScreenLens;
+    }
+    catch(const std::exception& error)
+    {
+        fprintf(stderr, "%s\n", error.what());
+        return 1;
+    }
+    class ScreenLens& screen_lens = *screen_lens_ptr;
+
+    std::vector<ScreenPixel> off_screen_render_data(size*size);
+    std::vector<double> latency_list;
+    latency_list.reserve(frames);
+
+    const int step_x = std::max(1, screen_lens.ScreenWidth()/frames);
+    const int step_y = std::max(1, screen_lens.ScreenHeight()/frames);
+
+    for(int frame = 0; frame < frames; ++frame)
+    {
+        const int central_x = (frame*step_x) % screen_lens.ScreenWidth();
+        const int central_y = (frame*step_y) % screen_lens.ScreenHeight();
+
+        const auto start = std::chrono::steady_clock::now();
+        const auto ok = screen_lens.RefreshScreenPixelDataWithinBound( \
+                                central_x, central_y, size, size, \
+                                        off_screen_render_data.data() );
+        const auto end = std::chrono::steady_clock::now();
+
+        if( !ok )
+        {
+            fprintf(stderr, "frame %d capture failed\n", frame);
+            delete screen_lens_ptr;
+            return 1;
+        }
+
+        const double latency = \
+            std::chrono::duration<double, std::micro>(end - start).count();
+        latency_list.push_back(latency);
+        fprintf(stdout, "frame %6d %4dx%-4d %10.2f us\n", \
+                                        frame, size, size, latency);
+    }
+
+    std::sort(latency_list.begin(), latency_list.end());
+
+    auto percentile = [&](double p)
+    {
+        return latency_list[size_t(p*(latency_list.size() - 1))];
+    };
+
+    double sum = 0;
+    for(const auto latency : latency_list) { sum += latency; }
+
+    fprintf(stdout, "frames %d size %dx%d min %.2f us p50 %.2f us "
+                    "p99 %.2f us max %.2f us mean %.2f us\n", \
+                    frames, size, size, latency_list.front(), \
+                    percentile(0.50), percentile(0.99), \
+                    latency_list.back(), sum/latency_list.size());
+
+    delete screen_lens_ptr;
+
+    return 0;
+}
@@ -0,0 +1,167 @@
+//! Display profile -> sRGB / Display P3 through ColorTransform, from an ICC
+//! file on disk, so the colour stage runs without any display at all:
+//!
+//!   ./build/Release/color_bench --profile=/usr/share/color/icc/display.icc
+//!   ./build/Release/color_bench --profile=display.icc --target=p3 --frames=50
+//!
+//! prints the matrix, a few reference colours, then every kernel level the
+//! CPU runs against the scalar one over a 3840x2160 frame.
+
+#include <chrono>
+#include <vector>
+#include <random>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+#include "../src/ColorProfile.h"
+#include "../src/ColorTransform.h"
+
+
+static const char*
+StringParameterOf(int argc, char** argv, const char* name, const char* default_value)
+{
+    const auto name_length = strlen(name);
+    for(int idx = 1; idx < argc; ++idx)
+    {
+        if( strncmp(argv[idx], name, name_length) == 0 )
+        {
+            return argv[idx] + name_length;
+        }
+    }
+    return default_value;
+}
+
+
+static int
+ParameterOf(int argc, char** argv, const char* name, int default_value)
+{
+    auto value = StringParameterOf(argc, argv, name, nullptr);
+    return value == nullptr ? default_value : atoi(value);
+}
+
+
+int
+main(int argc, char** argv)
+{
+    const char* profile_path = StringParameterOf(argc, argv, "--profile=", nullptr);
+    if( profile_path == nullptr )
+    {
+        fprintf(stderr, "usage: %s --profile=<icc> [--target=srgb|p3] "
+                        "[--width=] [--height=] [--frames=]\n", argv[0]);
+        return 1;
+    }
+    const auto target = strcmp(StringParameterOf(argc, argv, "--target=", "srgb"), \
+                "p3") == 0 ? TargetColorSpace::DISPLAY_P3 : TargetColorSpace::SRGB;
+
+    const int width  = std::max(1, ParameterOf(argc, argv, "--width=", 3840));
+    const int height = std::max(1, ParameterOf(argc, argv, "--height=", 2160));
+    const int frames = std::max(1, ParameterOf(argc, argv, "--frames=", 20));
+
+    class ColorTransform* transform = nullptr;
+    try
+    {
+        class ColorProfile profile(profile_path);
+        transform = new class ColorTransform(profile, target);
+    }
+    catch(const std::exception& error)
+    {
+        fprintf(stderr, "%s\n", error.what());
+        return 1;
+    }
+
+    auto m = transform->Matrix();
+    fprintf(stdout, "matrix %+.4f %+.4f %+.4f\n"
+                    "       %+.4f %+.4f %+.4f\n"
+                    "       %+.4f %+.4f %+.4f\n", \
+            m[0], m[1], m[2], m[3], m[4], m[5], m[6], m[7], m[8]);
+
+    const PixelRGBA8 references[] = {
+        {0xFF, 0x00, 0x00, 0xFF}, {0x00, 0xFF, 0x00, 0xFF}, {0x00, 0x00, 0xFF, 0xFF},
+        {0xFF, 0xFF, 0xFF, 0xFF}, {0x80, 0x80, 0x80, 0xFF}, {0x20, 0x40, 0x60, 0xFF},
+    };
+    for(auto reference : references)
+    {
+        auto converted = reference;
+        transform->TransformRow(&converted, 1);
+        fprintf(stdout, "#%02X%02X%02X -> #%02X%02X%02X\n", \
+                        reference.r, reference.g, reference.b, \
+                        converted.r, converted.g, converted.b);
+    }
+
+    if( transform->IsIdentity() )
+    {
+        fprintf(stdout, "identity, rows are left untouched\n");
+        delete transform;
+        return 0;
+    }
+
+    std::vector<PixelRGBA8> source(size_t(width)*height);
+    std::mt19937 generator(2020);
+    for(auto& pixel : source)
+    {
+        const uint32_t value = generator();
+        pixel = PixelRGBA8{uint8_t(value), uint8_t(value >> 8), \
+                           uint8_t(value >> 16), uint8_t(value >> 24)};
+    }
+
+    std::vector<PixelRGBA8> expected(source);
+    transform->SetKernelLevel(ConvertKernelLevel::SCALAR);
+    transform->TransformRow(expected.data(), int(expected.size()));
+
+    const auto detected = DetectConvertKernelLevel();
+    fprintf(stdout, "frame %dx%d, detected %s\n", \
+                            width, height, ConvertKernelLevelName(detected));
+
+    std::vector<PixelRGBA8> rows(source.size());
+    double scalar_ms = 0;
+
+    for(auto level : { ConvertKernelLevel::SCALAR, ConvertKernelLevel::SSE2, \
+                       ConvertKernelLevel::AVX2 })
+    {
+        if( level > detected )
+        {
+            fprintf(stdout, "%-8s unsupported\n", ConvertKernelLevelName(level));
+            continue;
+        }
+        transform->SetKernelLevel(level);
+
+        std::chrono::steady_clock::duration elapsed{};
+        for(int frame = 0; frame < frames; ++frame)
+        {
+            std::copy(source.begin(), source.end(), rows.begin());
+            const auto start = std::chrono::steady_clock::now();
+            for(int y = 0; y < height; ++y)
+            {
+                transform->TransformRow(rows.data() + size_t(y)*width, width);
+            }
+            elapsed += std::chrono::steady_clock::now() - start;
+        }
+
+        //! the kernels round halfway cases to even, the scalar loop up
+        int max_difference = 0;
+        for(size_t idx = 0; idx < rows.size(); ++idx)
+        {
+            max_difference = std::max({max_difference, \
+                                    std::abs(rows[idx].r - expected[idx].r), \
+                                    std::abs(rows[idx].g - expected[idx].g), \
+                                    std::abs(rows[idx].b - expected[idx].b), \
+                                    std::abs(rows[idx].a - expected[idx].a)});
+        }
+
+        const double ms = std::chrono::duration<double, std::milli>( \
+                                                        elapsed).count()/frames;
+        if( level == ConvertKernelLevel::SCALAR ) { scalar_ms = ms; }
+
+        const double pixels_per_second = double(width)*height/(ms/1000);
+        fprintf(stdout, "%-8s %8.3f ms/frame %8.1f Mpixel/s x%5.2f %s\n", \
+                ConvertKernelLevelName(level), ms, pixels_per_second/1e6, \
+                scalar_ms/ms, max_difference <= 1 ? "ok" : "MISMATCH");
+
+        if( max_difference > 1 ) { delete transform; return 1; }
+    }
+
+    delete transform;
+    return 0;
+}
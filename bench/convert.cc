@@ -0,0 +1,97 @@
+//! BGRX -> RGBA8 row kernels against the scalar loop, over whole frames.
+//!
+//!   ./build/Release/convert_bench --width=3840 --height=2160 --frames=200
+
+#include <chrono>
+#include <vector>
+#include <random>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+#include "../src/PixelConvert.h"
+
+
+static int
+ParameterOf(int argc, char** argv, const char* name, int default_value)
+{
+    const auto name_length = strlen(name);
+    for(int idx = 1; idx < argc; ++idx)
+    {
+        if( strncmp(argv[idx], name, name_length) == 0 )
+        {
+            return atoi(argv[idx] + name_length);
+        }
+    }
+    return default_value;
+}
+
+
+int
+main(int argc, char** argv)
+{
+    const int width  = std::max(1, ParameterOf(argc, argv, "--width=", 3840));
+    const int height = std::max(1, ParameterOf(argc, argv, "--height=", 2160));
+    const int frames = std::max(1, ParameterOf(argc, argv, "--frames=", 200));
+
+    //! a captured row is often padded, keep the stride off the width
+    const int stride = width*4 + 64;
+
+    std::vector<uint8_t> bgra(size_t(stride)*height);
+    std::mt19937 generator(2020);
+    for(auto& value : bgra) { value = uint8_t(generator()); }
+
+    std::vector<PixelRGBA8> expected(size_t(width)*height);
+    std::vector<PixelRGBA8> rgba(size_t(width)*height);
+
+    auto scalar = BGRAToRGBA8RowKernel(ConvertKernelLevel::SCALAR);
+    for(int y = 0; y < height; ++y)
+    {
+        scalar(bgra.data() + size_t(y)*stride, expected.data() + size_t(y)*width, width);
+    }
+
+    const auto detected = DetectConvertKernelLevel();
+    fprintf(stdout, "frame %dx%d, detected %s\n", \
+                            width, height, ConvertKernelLevelName(detected));
+
+    double scalar_ms = 0;
+
+    for(auto level : { ConvertKernelLevel::SCALAR, ConvertKernelLevel::SSE2, \
+                       ConvertKernelLevel::AVX2, ConvertKernelLevel::AVX512 })
+    {
+        auto kernel = BGRAToRGBA8RowKernel(level);
+        if( kernel == nullptr || level > detected )
+        {
+            fprintf(stdout, "%-8s unsupported\n", ConvertKernelLevelName(level));
+            continue;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        for(int frame = 0; frame < frames; ++frame)
+        {
+            for(int y = 0; y < height; ++y)
+            {
+                kernel(bgra.data() + size_t(y)*stride, \
+                                    rgba.data() + size_t(y)*width, width);
+            }
+        }
+        const auto end = std::chrono::steady_clock::now();
+
+        const bool same = 0 == memcmp(rgba.data(), expected.data(), \
+                                    expected.size()*sizeof(PixelRGBA8));
+
+        const double ms = std::chrono::duration<double, std::milli>( \
+                                                    end - start).count()/frames;
+        if( level == ConvertKernelLevel::SCALAR ) { scalar_ms = ms; }
+
+        const double pixels_per_second = double(width)*height/(ms/1000);
+        fprintf(stdout, "%-8s %8.3f ms/frame %8.1f Mpixel/s x%5.2f %s\n", \
+                ConvertKernelLevelName(level), ms, pixels_per_second/1e6, \
+                scalar_ms/ms, same ? "ok" : "MISMATCH");
+
+        if( !same ) { return 1; }
+    }
+
+    return 0;
+}
@@ -0,0 +1,217 @@
+//! The picker split in two threads against the serial loop, over a
+//! synthetic desktop: the pipeline ticks on a capture thread and publishes
+//! into a TripleBuffer, the render stage takes the newest frame and draws
+//! the magnifier, as the Linux picker and the synthetic source of the
+//! addon run it:
+//!
+//!   ./build/Release/handoff_bench --frames=5000 --width=1920 --height=1080
+//!   ./build/Release/handoff_bench --frames=2000 --rate=1000 --render-us=2000
+//!
+//! The cursor moves --rate times a second (a 1 kHz mouse by default).
+//! --render-us adds that much work to every present, a slow window: the
+//! serial loop then captures that much later, the split one keeps
+//! capturing and the render stage skips to the newest frame.
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+#include "../src/PickerPipeline.h"
+#include "../src/SyntheticFrameSource.h"
+#include "../src/MagnifierRaster.h"
+#include "../src/TripleBuffer.h"
+
+
+typedef std::chrono::steady_clock clock_type;
+
+
+static int
+ParameterOf(int argc, char** argv, const char* name, int default_value)
+{
+    const auto name_length = strlen(name);
+    for(int idx = 1; idx < argc; ++idx)
+    {
+        if( strncmp(argv[idx], name, name_length) == 0 )
+        {
+            return atoi(argv[idx] + name_length);
+        }
+    }
+    return default_value;
+}
+
+
+//! a random desktop as a binary PPM
+static bool
+WriteDesktop(const std::string& path, int width, int height)
+{
+    auto file = fopen(path.c_str(), "wb");
+    if( file == nullptr ) { return false; }
+
+    fprintf(file, "P6\n%d %d\n255\n", width, height);
+    std::mt19937 generator(2020);
+    std::vector<uint8_t> row(size_t(width)*3);
+    for(int y = 0; y < height; ++y)
+    {
+        for(auto& value : row) { value = uint8_t(generator()); }
+        fwrite(row.data(), 1, row.size(), file);
+    }
+    fclose(file);
+    return true;
+}
+
+
+static void
+BusyWait(clock_type::duration duration)
+{
+    const auto end = clock_type::now() + duration;
+    while( clock_type::now() < end ) {}
+}
+
+
+int
+main(int argc, char** argv)
+{
+    const int frames = std::max(1, ParameterOf(argc, argv, "--frames=", 5000));
+    const int width = ParameterOf(argc, argv, "--width=", 1920);
+    const int height = ParameterOf(argc, argv, "--height=", 1080);
+    const auto render_work = std::chrono::microseconds( \
+                                    ParameterOf(argc, argv, "--render-us=", 0));
+    const auto tick_interval = std::chrono::microseconds( \
+                    1000000/std::max(1, ParameterOf(argc, argv, "--rate=", 1000)));
+
+    const std::string image_path = "/tmp/handoff_bench.ppm";
+    if( false == WriteDesktop(image_path, width, height) )
+    {
+        fprintf(stderr, "cannot write %s\n", image_path.c_str());
+        return 1;
+    }
+
+    //! a random walk, one step per tick
+    SyntheticFrameSource::CursorPath cursor_path;
+    std::mt19937 generator(7);
+    int x = width/2, y = height/2;
+    for(int frame = 0; frame < frames; ++frame)
+    {
+        x = std::clamp(x + int(generator() % 9) - 4, 0, width - 1);
+        y = std::clamp(y + int(generator() % 9) - 4, 0, height - 1);
+        cursor_path.push_back({x, y});
+    }
+
+    class MagnifierRaster raster(1);
+    auto present = [&](const struct PickerFrame<ScreenPixel>& frame)
+    {
+        raster.Render(frame.View());
+        BusyWait(render_work);
+    };
+
+    //! serial: tick, render, tick, render...
+    class FrameLatency serial_latency;
+    double serial_ms = 0;
+    {
+        class SyntheticFrameSource source(image_path, cursor_path);
+        class PickerPipeline<ScreenPixel> pipeline(&source);
+        struct PickerFrame<ScreenPixel> frame;
+
+        const auto start = clock_type::now();
+        auto next_tick = start;
+        for(;;)
+        {
+            //! the move happened at next_tick, whatever the loop was busy with
+            std::this_thread::sleep_until(next_tick);
+            const auto tick_start = next_tick;
+            next_tick += tick_interval;
+            if( false == pipeline.Tick() )
+            {
+                break;
+            }
+            if( pipeline.FrameChanged() )
+            {
+                pipeline.Snapshot(&frame);
+                present(frame);
+                //! a cursor move waits for the previous present to end
+                serial_latency.Add(clock_type::now() - tick_start);
+            }
+        }
+        serial_ms = std::chrono::duration<double, std::milli>(clock_type::now() - start).count();
+    }
+
+    //! split: the capture thread publishes, this one renders the newest
+    class FrameLatency split_latency;
+    double split_ms = 0;
+    uint64_t published = 0, presented = 0, dropped = 0;
+    {
+        class SyntheticFrameSource source(image_path, cursor_path);
+        class PickerPipeline<ScreenPixel> pipeline(&source);
+        class TripleBuffer<struct PickerFrame<ScreenPixel>> frame_buffer;
+        std::atomic<bool> capture_done(false);
+
+        const auto start = clock_type::now();
+        std::thread capture_thread([&]()
+        {
+            for(auto next_tick = start; ; next_tick += tick_interval)
+            {
+                std::this_thread::sleep_until(next_tick);
+                const auto tick_start = next_tick;
+                if( false == pipeline.Tick() )
+                {
+                    break;
+                }
+                if( pipeline.FrameChanged() )
+                {
+                    auto& frame = frame_buffer.Back();
+                    pipeline.Snapshot(&frame);
+                    frame.tick_start = tick_start;
+                    frame.published = clock_type::now();
+                    frame_buffer.Publish();
+                }
+            }
+            capture_done.store(true, std::memory_order_release);
+        });
+
+        for(;;)
+        {
+            const bool done = capture_done.load(std::memory_order_acquire);
+            if( frame_buffer.Update() )
+            {
+                present(frame_buffer.Front());
+                split_latency.Add(clock_type::now() - frame_buffer.Front().tick_start);
+            }
+            else if( done )
+            {
+                break;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+        capture_thread.join();
+        split_ms = std::chrono::duration<double, std::milli>(clock_type::now() - start).count();
+
+        published = frame_buffer.PublishedCount();
+        presented = frame_buffer.ConsumedCount();
+        dropped = frame_buffer.DroppedCount();
+    }
+
+    fprintf(stdout, "desktop %dx%d, %d ticks every %lld us, render +%lld us\n", \
+                width, height, frames, (long long)tick_interval.count(), \
+                (long long)render_work.count());
+    fprintf(stdout, "serial capture->present %8.1f us mean, %8.1f us max, " \
+                "%llu frames in %.1f ms\n", serial_latency.MeanMicroseconds(), \
+                serial_latency.MaxMicroseconds(), \
+                (unsigned long long)serial_latency.Count(), serial_ms);
+    fprintf(stdout, "split  capture->present %8.1f us mean, %8.1f us max, " \
+                "%llu frames in %.1f ms (%llu published, %llu replaced unseen)\n", \
+                split_latency.MeanMicroseconds(), split_latency.MaxMicroseconds(), \
+                (unsigned long long)presented, split_ms, \
+                (unsigned long long)published, (unsigned long long)dropped);
+
+    return presented > 0 && presented + dropped == published ? 0 : 1;
+}
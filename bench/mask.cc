@@ -0,0 +1,300 @@
+//! The loupe mask as embedded (CircleMask, built from res/embed-masks.js
+//! output) against the PNG decoded at startup and drawn over the whole
+//! window every frame, as the GDI+ and Quartz windows did:
+//!
+//!   ./build/Release/mask_bench --res=res --frames=10000
+//!
+//! startup: PNG inflate + unfilter + premultiply vs expanding the embedded
+//! runs; per frame: a full window over (scalar, then SSE2) vs the runs
+//! only. A magnifier frame composites only the "per frame" pixels of the
+//! runs again, the others are drawn once per surface.
+
+#include <zlib.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+#include "../src/CircleMask.h"
+#include "../src/MagnifierRaster.h"
+
+
+static const char*
+StringParameterOf(int argc, char** argv, const char* name, const char* default_value)
+{
+    const auto name_length = strlen(name);
+    for(int idx = 1; idx < argc; ++idx)
+    {
+        if( strncmp(argv[idx], name, name_length) == 0 )
+        {
+            return argv[idx] + name_length;
+        }
+    }
+    return default_value;
+}
+
+
+static int
+ParameterOf(int argc, char** argv, const char* name, int default_value)
+{
+    auto value = StringParameterOf(argc, argv, name, nullptr);
+    return value == nullptr ? default_value : atoi(value);
+}
+
+
+static uint32_t
+ReadUInt32BE(const uint8_t* data)
+{
+    return (uint32_t(data[0]) << 24) | (uint32_t(data[1]) << 16) | \
+           (uint32_t(data[2]) << 8) | uint32_t(data[3]);
+}
+
+
+//! 8 bits palette/RGB/RGBA, not interlaced, into premultiplied 0xAARRGGBB;
+//! what Bitmap::FromStream and CGImageCreateWithPNGDataProvider did
+static bool
+DecodePNG(const std::vector<uint8_t>& file, std::vector<uint32_t>* const pixels, int* const size)
+{
+    if( file.size() < 8 + 25 )
+    {
+        return false;
+    }
+
+    int width = 0, height = 0, channels = 0;
+    const uint8_t* palette = nullptr;
+    const uint8_t* transparency = nullptr;
+    size_t transparency_size = 0;
+    std::vector<uint8_t> compressed;
+
+    for(size_t offset = 8; offset + 12 <= file.size(); )
+    {
+        const uint32_t length = ReadUInt32BE(&file[offset]);
+        const uint8_t* type = &file[offset + 4];
+        const uint8_t* data = &file[offset + 8];
+        if( offset + 12 + length > file.size() )
+        {
+            return false;
+        }
+
+        if( memcmp(type, "IHDR", 4) == 0 )
+        {
+            width = int(ReadUInt32BE(data));
+            height = int(ReadUInt32BE(data + 4));
+            channels = data[9] == 3 ? 1 : data[9] == 2 ? 3 : data[9] == 6 ? 4 : 0;
+            if( data[8] != 8 || data[12] != 0 || channels == 0 )
+            {
+                return false;
+            }
+        }
+        else if( memcmp(type, "PLTE", 4) == 0 )
+        {
+            palette = data;
+        }
+        else if( memcmp(type, "tRNS", 4) == 0 )
+        {
+            transparency = data;
+            transparency_size = length;
+        }
+        else if( memcmp(type, "IDAT", 4) == 0 )
+        {
+            compressed.insert(compressed.end(), data, data + length);
+        }
+        offset += 12 + length;
+    }
+    if( width <= 0 || width != height || (channels == 1 && palette == nullptr) )
+    {
+        return false;
+    }
+
+    const size_t stride = size_t(width)*channels;
+    std::vector<uint8_t> raw((stride + 1)*height);
+    uLongf raw_size = uLongf(raw.size());
+    if( Z_OK != uncompress(raw.data(), &raw_size, compressed.data(), uLong(compressed.size())) )
+    {
+        return false;
+    }
+
+    pixels->assign(size_t(width)*height, 0u);
+    std::vector<uint8_t> previous(stride, 0);
+    for(int y = 0; y < height; ++y)
+    {
+        uint8_t* line = &raw[y*(stride + 1) + 1];
+        const uint8_t filter = line[-1];
+        for(size_t x = 0; x < stride; ++x)
+        {
+            const int a = x >= size_t(channels) ? line[x - channels] : 0;
+            const int b = previous[x];
+            const int c = x >= size_t(channels) ? previous[x - channels] : 0;
+            int predictor = 0;
+            if( filter == 1 ) { predictor = a; }
+            else if( filter == 2 ) { predictor = b; }
+            else if( filter == 3 ) { predictor = (a + b)/2; }
+            else if( filter == 4 )
+            {
+                const int p = a + b - c;
+                const int pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+                predictor = (pa <= pb && pa <= pc) ? a : (pb <= pc ? b : c);
+            }
+            line[x] = uint8_t(line[x] + predictor);
+        }
+
+        for(int x = 0; x < width; ++x)
+        {
+            uint8_t r, g, b, alpha = 0xFF;
+            if( channels == 1 )
+            {
+                const int idx = line[x];
+                r = palette[idx*3];
+                g = palette[idx*3 + 1];
+                b = palette[idx*3 + 2];
+                if( transparency != nullptr && size_t(idx) < transparency_size )
+                {
+                    alpha = transparency[idx];
+                }
+            }
+            else
+            {
+                r = line[x*channels];
+                g = line[x*channels + 1];
+                b = line[x*channels + 2];
+                if( channels == 4 ) { alpha = line[x*channels + 3]; }
+            }
+            (*pixels)[size_t(y)*width + x] = MagnifierRaster::PackPixel(r, g, b, alpha);
+        }
+        previous.assign(line, line + stride);
+    }
+
+    *size = width;
+    return true;
+}
+
+
+template <typename Function>
+static double
+MinimumMicroseconds(int repeat, Function&& function)
+{
+    double best = 1e30;
+    for(int idx = 0; idx < repeat; ++idx)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        best = std::min(best, std::chrono::duration<double, std::micro>( \
+                            std::chrono::steady_clock::now() - start).count());
+    }
+    return best;
+}
+
+
+int
+main(int argc, char** argv)
+{
+    const std::string res_path = StringParameterOf(argc, argv, "--res=", "res");
+    const int frames = std::max(1, ParameterOf(argc, argv, "--frames=", 10000));
+    bool ok = true;
+
+    for(int scale = 1; scale <= UI_SCALE_MAX; ++scale)
+    {
+        class MagnifierRaster raster(scale);
+        const auto& mask = raster.Mask();
+        const int size = raster.Size();
+
+        //! startup
+        const std::string png_path = res_path + "/" + mask.VariantName();
+        auto file = fopen(png_path.c_str(), "rb");
+        if( file == nullptr )
+        {
+            fprintf(stderr, "cannot read %s\n", png_path.c_str());
+            return 1;
+        }
+        std::vector<uint8_t> png;
+        uint8_t chunk[4096];
+        for(size_t count; (count = fread(chunk, 1, sizeof(chunk), file)) > 0; )
+        {
+            png.insert(png.end(), chunk, chunk + count);
+        }
+        fclose(file);
+
+        std::vector<uint32_t> decoded;
+        int decoded_size = 0;
+        const double png_us = MinimumMicroseconds(20, [&]()
+        {
+            ok = DecodePNG(png, &decoded, &decoded_size) && ok;
+        });
+        const double embedded_us = MinimumMicroseconds(20, [&]()
+        {
+            class CircleMask circle_mask(scale, size);
+        });
+
+        //! the window sized mask both ways, they must agree
+        std::vector<uint32_t> dense(size_t(size)*size, 0u);
+        for(int idx = 0; idx < mask.RunCount(); ++idx)
+        {
+            const auto& run = mask.Runs()[idx];
+            std::copy(run.pixels, run.pixels + run.length, dense.begin() + run.y*size + run.x);
+        }
+        bool same = true;
+        const int offset = (size - decoded_size)/2;
+        for(int y = 0; y < size; ++y)
+        {
+            for(int x = 0; x < size; ++x)
+            {
+                const int source_x = x - offset, source_y = y - offset;
+                const bool inside = source_x >= 0 && source_y >= 0 && \
+                            source_x < decoded_size && source_y < decoded_size;
+                const uint32_t expected = inside ? \
+                            decoded[size_t(source_y)*decoded_size + source_x] : 0u;
+                same = same && (expected >> 24 == 0 ? dense[y*size + x] == 0 : \
+                                                    dense[y*size + x] == expected);
+            }
+        }
+        ok = ok && same;
+
+        //! per frame
+        std::vector<uint32_t> target(size_t(size)*size, MagnifierRaster::BackgroundPixel());
+        auto per_frame = [&](auto&& composite)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            for(int frame = 0; frame < frames; ++frame)
+            {
+                composite();
+            }
+            return std::chrono::duration<double, std::micro>( \
+                            std::chrono::steady_clock::now() - start).count()/frames;
+        };
+        const double full_scalar_us = per_frame([&]()
+        {
+            for(size_t idx = 0; idx < dense.size(); ++idx)
+            {
+                CircleMask::CompositeSpan(&target[idx], &dense[idx], 1);
+            }
+        });
+        const double full_simd_us = per_frame([&]()
+        {
+            CircleMask::CompositeSpan(target.data(), dense.data(), int(dense.size()));
+        });
+        const double runs_us = per_frame([&]()
+        {
+            mask.Composite(target.data(), size);
+        });
+
+        int run_pixels = 0;
+        for(int idx = 0; idx < mask.RunCount(); ++idx)
+        {
+            run_pixels += mask.Runs()[idx].length;
+        }
+
+        fprintf(stdout, "x%d %s, window %dx%d, %d runs, %d pixels, %d per frame\n", \
+                scale, mask.VariantName(), size, size, mask.RunCount(), run_pixels, \
+                raster.FrameMaskPixelCount());
+        fprintf(stdout, "  startup   png decode %8.2f us, embedded %8.2f us x%.1f %s\n", \
+                png_us, embedded_us, png_us/embedded_us, same ? "ok" : "MISMATCH");
+        fprintf(stdout, "  per frame full over %8.2f us, full SSE2 %8.2f us, " \
+                "runs %8.2f us\n", full_scalar_us, full_simd_us, runs_us);
+    }
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,281 @@
+//! The X side of the motion to update harness (bench/motion.js): paints
+//! the root window with a pattern whose colour encodes the position, then
+//! moves the cursor through XTest along scripted paths and ends the pick
+//! with a click. Every injected motion is written to stdout as a JSON line
+//! with its CLOCK_MONOTONIC time, the clock process.hrtime() reads:
+//!
+//!   {"event":"ready","width":1920,"height":1080}      painted, waits for a line on stdin
+//!   {"event":"motion","t":123456789,"x":240,"y":540}  one per step, after the click
+//!   {"event":"done","motions":1500}
+//!
+//!   DISPLAY=:99 ./build/Release/motion_driver --path=line,circle,jumps --steps=500 --rate=250
+//!
+//! The motions are kept in memory while they are injected, so that writing
+//! them never delays the next one.
+
+#include <X11/Xlib.h>
+#include <X11/Xutil.h>
+#include <X11/extensions/XTest.h>
+
+#include <time.h>
+
+#include <cmath>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <algorithm>
+
+
+static const char*
+StringParameterOf(int argc, char** argv, const char* name, const char* default_value)
+{
+    const auto name_length = strlen(name);
+    for(int idx = 1; idx < argc; ++idx)
+    {
+        if( strncmp(argv[idx], name, name_length) == 0 )
+        {
+            return argv[idx] + name_length;
+        }
+    }
+    return default_value;
+}
+
+
+static int
+ParameterOf(int argc, char** argv, const char* name, int default_value)
+{
+    auto value = StringParameterOf(argc, argv, name, nullptr);
+    return value == nullptr ? default_value : atoi(value);
+}
+
+
+static uint64_t
+MonotonicNanoseconds()
+{
+    struct timespec now;
+    ::clock_gettime(CLOCK_MONOTONIC, &now);
+    return uint64_t(now.tv_sec)*1000000000u + uint64_t(now.tv_nsec);
+}
+
+
+//! 0xRRGGBB of the pattern at x, y: the low bytes of x and y in red and
+//! green, their next four bits in blue, one colour per pixel up to 4096x4096.
+//! patternColor() of motion.js is the same
+static uint32_t
+PatternColor(int x, int y)
+{
+    const uint32_t red = uint32_t(x) & 0xFF;
+    const uint32_t green = uint32_t(y) & 0xFF;
+    const uint32_t blue = (uint32_t(x) >> 8 & 0x0F) | (uint32_t(y) >> 8 & 0x0F) << 4;
+    return red << 16 | green << 8 | blue;
+}
+
+
+//! the pattern as the background of the root window, false when the
+//! visual is not 24 bit TrueColor
+static bool
+PaintPattern(Display* display, int width, int height)
+{
+    const int screen = DefaultScreen(display);
+    auto visual = DefaultVisual(display, screen);
+    if( DefaultDepth(display, screen) != 24 || visual->red_mask != 0xFF0000 || \
+        visual->green_mask != 0x00FF00 || visual->blue_mask != 0x0000FF )
+    {
+        fprintf(stderr, "%s Error 0\n", __PRETTY_FUNCTION__);
+        return false;
+    }
+
+    auto data = static_cast<uint32_t*>(malloc(size_t(width)*height*sizeof(uint32_t)));
+    if( data == nullptr )
+    {
+        fprintf(stderr, "%s Error 1\n", __PRETTY_FUNCTION__);
+        return false;
+    }
+    for(int y = 0; y < height; ++y)
+    {
+        for(int x = 0; x < width; ++x)
+        {
+            data[size_t(y)*width + x] = PatternColor(x, y);
+        }
+    }
+
+    //! owns data from here on
+    auto image = ::XCreateImage(display, visual, 24, ZPixmap, 0, \
+                                reinterpret_cast<char*>(data), width, height, 32, 0);
+    if( image == nullptr )
+    {
+        free(data);
+        fprintf(stderr, "%s Error 2\n", __PRETTY_FUNCTION__);
+        return false;
+    }
+
+    const auto root = DefaultRootWindow(display);
+    auto pixmap = ::XCreatePixmap(display, root, width, height, 24);
+    auto gc = ::XCreateGC(display, pixmap, 0, nullptr);
+    ::XPutImage(display, pixmap, gc, image, 0, 0, 0, 0, width, height);
+    ::XFreeGC(display, gc);
+    XDestroyImage(image);
+
+    //! the server keeps the pixmap as long as the root uses it
+    ::XSetWindowBackgroundPixmap(display, root, pixmap);
+    ::XClearWindow(display, root);
+    ::XFreePixmap(display, pixmap);
+    ::XSync(display, False);
+    return true;
+}
+
+
+struct MotionPoint
+{
+    int x;
+    int y;
+};
+
+
+//! steps points of a path across a width x height screen, none when the
+//! name is unknown:
+//!   line    left to right across the middle, then back
+//!   circle  around the centre, a third of the height in radius
+//!   jumps   from anywhere to anywhere, as a flick of the mouse does
+static std::vector<struct MotionPoint>
+PathOf(const std::string& name, int width, int height, int steps)
+{
+    std::vector<struct MotionPoint> points;
+    points.reserve(steps);
+    if( name == "line" )
+    {
+        const int left = width/8, right = width - width/8;
+        for(int step = 0; step < steps; ++step)
+        {
+            //! 0 -> 1 -> 0
+            const double phase = 2.0*step/steps;
+            const double ratio = phase <= 1 ? phase : 2 - phase;
+            points.push_back({ left + int(ratio*(right - left)), height/2 });
+        }
+    }
+    else if( name == "circle" )
+    {
+        const double radius = std::min(width, height)/3.0;
+        for(int step = 0; step < steps; ++step)
+        {
+            const double angle = 2*M_PI*step/steps;
+            points.push_back({ width/2 + int(std::lround(radius*std::cos(angle))), \
+                               height/2 + int(std::lround(radius*std::sin(angle))) });
+        }
+    }
+    else if( name == "jumps" )
+    {
+        //! the same jumps every run
+        uint32_t seed = 0x2545F491;
+        auto next = [&seed](int range)
+        {
+            seed = seed*1664525u + 1013904223u;
+            return int((seed >> 8) % uint32_t(range));
+        };
+        for(int step = 0; step < steps; ++step)
+        {
+            points.push_back({ width/16 + next(width - width/8), \
+                               height/16 + next(height - height/8) });
+        }
+    }
+    return points;
+}
+
+
+int
+main(int argc, char** argv)
+{
+    const std::string paths = StringParameterOf(argc, argv, "--path=", "line,circle,jumps");
+    const int steps = std::max(1, ParameterOf(argc, argv, "--steps=", 500));
+    const int rate = std::max(1, ParameterOf(argc, argv, "--rate=", 250));
+    const int settle_ms = std::max(0, ParameterOf(argc, argv, "--settle-ms=", 200));
+
+    auto display = ::XOpenDisplay(nullptr);
+    if( display == nullptr )
+    {
+        fprintf(stderr, "motion_driver: cannot open the display\n");
+        return 1;
+    }
+    int event_base = 0, error_base = 0, major = 0, minor = 0;
+    if( False == ::XTestQueryExtension(display, &event_base, &error_base, &major, &minor) )
+    {
+        fprintf(stderr, "motion_driver: the server has no XTEST\n");
+        return 1;
+    }
+
+    const int screen = DefaultScreen(display);
+    const int width = DisplayWidth(display, screen);
+    const int height = DisplayHeight(display, screen);
+
+    std::vector<struct MotionPoint> points;
+    size_t start = 0, end = 0;
+    while( start <= paths.size() )
+    {
+        end = std::min(paths.find(',', start), paths.size());
+        const auto name = paths.substr(start, end - start);
+        const auto path = PathOf(name, width, height, steps);
+        if( path.empty() )
+        {
+            fprintf(stderr, "motion_driver: no path %s\n", name.c_str());
+            return 1;
+        }
+        points.insert(points.end(), path.begin(), path.end());
+        start = end + 1;
+    }
+
+    if( false == PaintPattern(display, width, height) )
+    {
+        return 1;
+    }
+    //! the picker starts from the first point, not from wherever the
+    //! cursor was
+    ::XTestFakeMotionEvent(display, -1, points.front().x, points.front().y, CurrentTime);
+    ::XSync(display, False);
+
+    fprintf(stdout, "{\"event\":\"ready\",\"width\":%d,\"height\":%d}\n", width, height);
+    fflush(stdout);
+    char line[64];
+    if( nullptr == fgets(line, sizeof(line), stdin) )
+    {
+        //! the harness is gone
+        return 1;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(settle_ms));
+
+    //! paced on a grid rather than by sleeps, a late step does not delay
+    //! the following ones
+    std::vector<uint64_t> times(points.size());
+    const auto interval = std::chrono::nanoseconds(1000000000/rate);
+    auto next_step = std::chrono::steady_clock::now();
+    for(size_t idx = 0; idx < points.size(); ++idx)
+    {
+        std::this_thread::sleep_until(next_step);
+        next_step += interval;
+
+        times[idx] = MonotonicNanoseconds();
+        ::XTestFakeMotionEvent(display, -1, points[idx].x, points[idx].y, CurrentTime);
+        ::XFlush(display);
+    }
+
+    //! the last motions get their updates before the click ends the pick
+    std::this_thread::sleep_for(std::chrono::milliseconds(settle_ms));
+    ::XTestFakeButtonEvent(display, 1, True, CurrentTime);
+    ::XTestFakeButtonEvent(display, 1, False, CurrentTime);
+    ::XSync(display, False);
+
+    for(size_t idx = 0; idx < points.size(); ++idx)
+    {
+        fprintf(stdout, "{\"event\":\"motion\",\"t\":%llu,\"x\":%d,\"y\":%d}\n", \
+                        static_cast<unsigned long long>(times[idx]), points[idx].x, points[idx].y);
+    }
+    fprintf(stdout, "{\"event\":\"done\",\"motions\":%zu}\n", points.size());
+    fflush(stdout);
+
+    ::XCloseDisplay(display);
+    return 0;
+}
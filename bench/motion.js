@@ -0,0 +1,220 @@
+// Motion to update latency, end to end: what a user feels between moving
+// the mouse and the `update` event in JS. Starts Xvfb, has motion_driver
+// paint a pattern whose colour encodes the position and move the cursor
+// through XTest along scripted paths, picks with init() meanwhile and
+// timestamps every update against the motion that put the cursor there.
+//
+//   npm run e2e -- --path=line,circle,jumps --steps=500 --rate=250
+//   node bench/motion.js --display=:99 --session --output=motion.json
+//
+// Reports the latency distribution of the motions an update showed, how
+// many motions were never shown (the cursor moved on before the next
+// frame), and the rate of updates whose colour is not the pattern's at
+// their position. --max-p99-ms and --max-mismatch-rate make it fail.
+// Both sides read CLOCK_MONOTONIC: process.hrtime() here, clock_gettime()
+// in the driver.
+
+const fs = require('fs');
+const path = require('path');
+const readline = require('readline');
+const { spawn } = require('child_process');
+
+const DRIVER = path.join(__dirname, '..', 'build', 'Release', 'motion_driver');
+const DRIVER_OPTIONS = ['path', 'steps', 'rate', 'settle-ms'];
+
+function parseOptions(argv) {
+    const options = {};
+    for (const arg of argv) {
+        const match = /^--([^=]+)(?:=(.*))?$/.exec(arg);
+        if (match) {
+            options[match[1]] = match[2] === undefined ? true : match[2];
+        }
+    }
+    return options;
+}
+
+// 0xRRGGBB of the pattern at x, y, as PatternColor() of motion.cc
+function patternColor(x, y) {
+    const red = x & 0xFF;
+    const green = y & 0xFF;
+    const blue = (x >> 8 & 0x0F) | (y >> 8 & 0x0F) << 4;
+    return (red << 16 | green << 8 | blue) >>> 0;
+}
+
+// a server of its own, on the first free display, resolves with its name
+function startXvfb(screen) {
+    return new Promise((resolve, reject) => {
+        const server = spawn('Xvfb', ['-displayfd', '3', '-screen', '0', screen, '-nolisten', 'tcp'],
+            { stdio: ['ignore', 'ignore', 'inherit', 'pipe'] });
+        let output = '';
+        server.on('error', reject);
+        server.on('exit', code => reject(new Error('Xvfb exited with ' + code)));
+        server.stdio[3].on('data', data => {
+            output += data;
+            if (output.includes('\n')) {
+                resolve({ display: ':' + output.trim(), server });
+            }
+        });
+    });
+}
+
+// the nearest rank percentile of sorted values
+function percentile(sorted, ratio) {
+    if (sorted.length === 0) {
+        return 0;
+    }
+    const rank = Math.max(1, Math.ceil(ratio * sorted.length));
+    return sorted[Math.min(sorted.length, rank) - 1];
+}
+
+// every update against the latest motion to its position before it, the
+// first update showing a motion gives its latency
+function analyse(motions, updates) {
+    const motionsAt = new Map();
+    for (const motion of motions) {
+        const key = motion.x + ',' + motion.y;
+        if (!motionsAt.has(key)) {
+            motionsAt.set(key, []);
+        }
+        motionsAt.get(key).push(motion);
+    }
+
+    const latencies = [];
+    let mismatches = 0;
+    for (const update of updates) {
+        const expected = (patternColor(update.x, update.y) * 0x100 + 0xFF) >>> 0;
+        if (update.rgba !== expected) {
+            mismatches += 1;
+        }
+
+        let shown = null;
+        for (const motion of motionsAt.get(update.x + ',' + update.y) || []) {
+            if (motion.t <= update.t) {
+                shown = motion;
+            }
+        }
+        if (shown !== null && !shown.seen) {
+            shown.seen = true;
+            latencies.push(Number(update.t - shown.t) / 1e6);
+        }
+    }
+    latencies.sort((a, b) => a - b);
+
+    const round = value => Math.round(value * 1000) / 1000;
+    return {
+        motions: motions.length,
+        shown: latencies.length,
+        updates: updates.length,
+        mismatches,
+        mismatchRate: updates.length === 0 ? 0 : mismatches / updates.length,
+        latencyMs: {
+            p50: round(percentile(latencies, 0.5)),
+            p95: round(percentile(latencies, 0.95)),
+            p99: round(percentile(latencies, 0.99)),
+            max: round(latencies.length === 0 ? 0 : latencies[latencies.length - 1]),
+            mean: round(latencies.reduce((sum, value) => sum + value, 0) / Math.max(1, latencies.length))
+        }
+    };
+}
+
+// motion_driver's motions, once it has clicked the pick away; start()
+// runs when the pattern is up and must return the pick's promise
+function drive(options, start) {
+    const args = DRIVER_OPTIONS
+        .filter(name => options[name] !== undefined)
+        .map(name => '--' + name + '=' + options[name]);
+    const driver = spawn(DRIVER, args, { stdio: ['pipe', 'pipe', 'inherit'] });
+    const motions = [];
+    let picked = null;
+
+    return new Promise((resolve, reject) => {
+        driver.on('error', reject);
+        readline.createInterface({ input: driver.stdout }).on('line', line => {
+            const event = JSON.parse(line);
+            if (event.event === 'ready') {
+                picked = start();
+                driver.stdin.write('go\n');
+            } else if (event.event === 'motion') {
+                motions.push({ t: BigInt(event.t), x: event.x, y: event.y, seen: false });
+            }
+        });
+        driver.on('close', code => {
+            if (code !== 0 || picked === null) {
+                reject(new Error('motion_driver exited with ' + code));
+                return;
+            }
+            picked.then(() => resolve(motions), reject);
+        });
+    });
+}
+
+async function main() {
+    const options = parseOptions(process.argv.slice(2));
+
+    let server = null;
+    if (options.display) {
+        process.env.DISPLAY = options.display;
+    } else {
+        const xvfb = await startXvfb(options.screen || '1920x1080x24');
+        server = xvfb.server;
+        server.removeAllListeners('exit');
+        process.env.DISPLAY = xvfb.display;
+    }
+
+    try {
+        const picker = require('../index');
+        const updates = [];
+        const emit = (name, rgba, x, y) => {
+            // the first update is the previous colour, as a string
+            if (name === 'update' && typeof rgba === 'number') {
+                updates.push({ t: process.hrtime.bigint(), rgba, x, y });
+            }
+        };
+        const params = { previousColor: '#000000', payload: 'compact', gridSize: 1 };
+
+        let session = null;
+        if (options.session) {
+            session = picker.createSession();
+        }
+        const motions = await drive(options, () => session
+            ? session.start(emit, params)
+            : picker.init(emit, params));
+        if (session) {
+            session.close();
+        }
+
+        const report = Object.assign({
+            display: process.env.DISPLAY,
+            session: Boolean(options.session)
+        }, analyse(motions, updates));
+        const json = JSON.stringify(report, null, 2) + '\n';
+        if (options.output) {
+            fs.writeFileSync(options.output, json);
+        } else {
+            process.stdout.write(json);
+        }
+        console.error('motion to update: p50 %s ms  p95 %s ms  p99 %s ms  max %s ms, ' +
+            '%d of %d motions shown, %d of %d updates mismatched',
+            report.latencyMs.p50, report.latencyMs.p95, report.latencyMs.p99,
+            report.latencyMs.max, report.shown, report.motions,
+            report.mismatches, report.updates);
+
+        if (options['max-p99-ms'] !== undefined &&
+            report.latencyMs.p99 > Number(options['max-p99-ms'])) {
+            process.exitCode = 1;
+        }
+        if (options['max-mismatch-rate'] !== undefined &&
+            report.mismatchRate > Number(options['max-mismatch-rate'])) {
+            process.exitCode = 1;
+        }
+    } finally {
+        if (server) {
+            server.kill();
+        }
+    }
+}
+
+main().catch(error => {
+    console.error(error.message);
+    process.exit(1);
+});
@@ -0,0 +1,217 @@
+//! pickMany() against a sample per point: the same points read through
+//! PointSampler (planned captures, gathered) and through one 1x1
+//! RefreshScreenPixelDataWithinBound() each, the way a per-point API would.
+//!
+//!   export DISPLAY=:99 && Xvfb :99 -screen 0 1920x1080x24 &
+//!   ./build/Release/points_bench --points=500 --clusters=12 --runs=50
+//!   ./build/Release/points_bench --source=synthetic --points=500
+//!
+//! The points are spread around --clusters random centres (widgets of a
+//! UI under test), --clusters=0 spreads them over the whole screen. The
+//! synthetic desktop costs nothing to capture, it only times the planning
+//! and the gather; the X server is where a capture per point hurts.
+
+#include <chrono>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <numeric>
+#include <algorithm>
+#include <functional>
+
+#include "../src/PointSampler.h"
+#include "../src/SyntheticFrameSource.h"
+#include "../src/linux/ScreenLens.h"
+
+
+typedef std::chrono::steady_clock clock_type;
+
+
+static int
+ParameterOf(int argc, char** argv, const char* name, int default_value)
+{
+    const auto name_length = strlen(name);
+    for(int idx = 1; idx < argc; ++idx)
+    {
+        if( strncmp(argv[idx], name, name_length) == 0 )
+        {
+            return atoi(argv[idx] + name_length);
+        }
+    }
+    return default_value;
+}
+
+
+static std::string
+StringParameterOf(int argc, char** argv, const char* name, const char* default_value)
+{
+    const auto name_length = strlen(name);
+    for(int idx = 1; idx < argc; ++idx)
+    {
+        if( strncmp(argv[idx], name, name_length) == 0 )
+        {
+            return std::string(argv[idx] + name_length);
+        }
+    }
+    return default_value;
+}
+
+
+//! a random desktop as a binary PPM
+static bool
+WriteDesktop(const std::string& path, int width, int height)
+{
+    auto file = fopen(path.c_str(), "wb");
+    if( file == nullptr ) { return false; }
+
+    fprintf(file, "P6\n%d %d\n255\n", width, height);
+    std::mt19937 generator(2020);
+    std::vector<uint8_t> row(size_t(width)*3);
+    for(int y = 0; y < height; ++y)
+    {
+        for(auto& value : row) { value = uint8_t(generator()); }
+        fwrite(row.data(), 1, row.size(), file);
+    }
+    fclose(file);
+    return true;
+}
+
+
+static double
+MicrosecondsSince(clock_type::time_point start)
+{
+    return std::chrono::duration<double, std::micro>(clock_type::now() - start).count();
+}
+
+
+int
+main(int argc, char** argv)
+{
+    const int point_count = std::max(1, ParameterOf(argc, argv, "--points=", 500));
+    const int cluster_count = std::max(0, ParameterOf(argc, argv, "--clusters=", 12));
+    const int runs = std::max(1, ParameterOf(argc, argv, "--runs=", 50));
+    const int merge_area = ParameterOf(argc, argv, "--merge-area=", POINT_MERGE_AREA);
+    const std::string source_name = StringParameterOf(argc, argv, "--source=", "screen");
+
+    std::unique_ptr<class FrameSource> frame_source;
+    try
+    {
+        if( source_name == "synthetic" )
+        {
+            const std::string image_path = "/tmp/points_bench.ppm";
+            if( false == WriteDesktop(image_path, 1920, 1080) )
+            {
+                fprintf(stderr, "cannot write %s\n", image_path.c_str());
+                return 1;
+            }
+            frame_source.reset(new class SyntheticFrameSource(image_path, {}));
+        }
+        else
+        {
+            frame_source.reset(new class ScreenLens);
+        }
+    }
+    catch(const std::exception& error)
+    {
+        fprintf(stderr, "%s\n", error.what());
+        return 1;
+    }
+    const int width = frame_source->ScreenWidth();
+    const int height = frame_source->ScreenHeight();
+
+    //! up to 60 pixels around each centre, or anywhere
+    std::mt19937 generator(11);
+    std::vector<struct SamplePoint> centres(std::max(1, cluster_count));
+    for(auto& centre : centres)
+    {
+        centre.x = int(generator() % width);
+        centre.y = int(generator() % height);
+    }
+    std::vector<struct SamplePoint> points(point_count);
+    for(auto& point : points)
+    {
+        if( cluster_count == 0 )
+        {
+            point.x = int(generator() % width);
+            point.y = int(generator() % height);
+            continue;
+        }
+        const auto& centre = centres[generator() % centres.size()];
+        point.x = std::clamp(centre.x + int(generator() % 121) - 60, 0, width - 1);
+        point.y = std::clamp(centre.y + int(generator() % 121) - 60, 0, height - 1);
+    }
+
+    //! per point
+    std::vector<uint32_t> reference(point_count);
+    double per_point_us = 0;
+    for(int run = 0; run < runs; ++run)
+    {
+        const auto start = clock_type::now();
+        for(int idx = 0; idx < point_count; ++idx)
+        {
+            PixelRGBA8 pixel;
+            if( false == frame_source->RefreshScreenPixelDataWithinBound( \
+                                        points[idx].x, points[idx].y, 1, 1, &pixel) )
+            {
+                fprintf(stderr, "point %d capture failed\n", idx);
+                return 1;
+            }
+            reference[idx] = pixel.Packed();
+        }
+        per_point_us += MicrosecondsSince(start);
+    }
+
+    fprintf(stdout, "%d points, %d clusters, %dx%d %s\n", point_count, \
+                    cluster_count, width, height, source_name.c_str());
+    fprintf(stdout, "per point   %10.1f us per call, %d captures\n", \
+                    per_point_us/runs, point_count);
+
+    int result = 0;
+    const ConvertKernelLevel levels[] = {
+        ConvertKernelLevel::SCALAR, ConvertKernelLevel::AVX2
+    };
+    const auto detected_level = DetectConvertKernelLevel();
+    for(auto level : levels)
+    {
+        if( level > detected_level )
+        {
+            continue;
+        }
+
+        class PointSampler point_sampler(frame_source.get(), merge_area);
+        point_sampler.SetKernelLevel(level);
+        std::vector<uint32_t> colors(point_count);
+
+        double batch_us = 0;
+        for(int run = 0; run < runs; ++run)
+        {
+            const auto start = clock_type::now();
+            if( false == point_sampler.Sample(points.data(), point_count, colors.data()) )
+            {
+                fprintf(stderr, "batch capture failed\n");
+                return 1;
+            }
+            batch_us += MicrosecondsSince(start);
+        }
+
+        const auto mismatch_count = std::inner_product(colors.begin(), colors.end(), \
+                                    reference.begin(), 0, std::plus<int>(), \
+                                    std::not_equal_to<uint32_t>());
+        fprintf(stdout, "pickMany %-6s %7.1f us per call, %d captures, " \
+                        "%lld pixels, %d mismatches, %.1fx\n", \
+                        ConvertKernelLevelName(level), batch_us/runs, \
+                        int(point_sampler.Rects().size()), \
+                        (long long)point_sampler.CapturedArea(), mismatch_count, \
+                        per_point_us/std::max(1.0, batch_us));
+        if( mismatch_count != 0 )
+        {
+            result = 1;
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,268 @@
+//! The magnifier rasterizer against a per cell fill (one FillRectangle per
+//! cell and a clip test per pixel, then the whole mask image drawn over,
+//! as the GDI+ and Quartz windows drew it), over random grids, no window
+//! system involved:
+//!
+//!   ./build/Release/raster_bench --frames=10000 --scale=1
+//!   ./build/Release/raster_bench --frames=10000 --grid=33 --zoom=7
+//!   ./build/Release/raster_bench --frames=1 --scale=2 --output=magnifier.pam
+//!
+//! "caret" keeps the grid and blinks one cell, into two alternating
+//! surfaces as a double buffered pool renders, which only repaints that
+//! cell; checked against a full frame of the same grid.
+
+#include <cmath>
+#include <chrono>
+#include <vector>
+#include <random>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+#include "../src/MagnifierRaster.h"
+
+
+static const char*
+StringParameterOf(int argc, char** argv, const char* name, const char* default_value)
+{
+    const auto name_length = strlen(name);
+    for(int idx = 1; idx < argc; ++idx)
+    {
+        if( strncmp(argv[idx], name, name_length) == 0 )
+        {
+            return argv[idx] + name_length;
+        }
+    }
+    return default_value;
+}
+
+
+static int
+ParameterOf(int argc, char** argv, const char* name, int default_value)
+{
+    auto value = StringParameterOf(argc, argv, name, nullptr);
+    return value == nullptr ? default_value : atoi(value);
+}
+
+
+//! the same picture the way the platform windows drew it, mask_image is
+//! the whole size*size mask
+static void
+RenderPerCell
+(
+    const struct ScreenPixelView<ScreenPixel>& view,
+    int scale, int grid_number, int grid_pixel,
+    const uint32_t* const mask_image,
+    uint32_t* const framebuffer
+)
+{
+    const int window_size = MagnifierRaster::WindowSize(grid_number, grid_pixel);
+    const int size = window_size*scale;
+    const double centre = size/2.0;
+    const double radius = size/2.0 - UI_CIRCLE_INSET*scale;
+    auto fill_rectangle = [&](int left, int top, int width, int height, uint32_t color)
+    {
+        left *= scale;
+        top *= scale;
+        width *= scale;
+        height *= scale;
+        for(int y = top; y < top + height; ++y)
+        {
+            for(int x = left; x < left + width; ++x)
+            {
+                const double dy = y + 0.5 - centre;
+                const double half_width = std::sqrt(std::max(0.0, radius*radius - dy*dy));
+                const bool inside = std::fabs(dy) < radius && \
+                        x >= std::ceil(centre - half_width - 0.5) && \
+                        x <= std::floor(centre + half_width - 0.5);
+                if( inside ) { framebuffer[y*size + x] = color; }
+            }
+        }
+    };
+
+    std::fill(framebuffer, framebuffer + size*size, 0u);
+    fill_rectangle(0, 0, window_size, window_size, MagnifierRaster::BackgroundPixel());
+
+    for(int idx_y = 0; idx_y < grid_number; ++idx_y)
+    {
+        for(int idx_x = 0; idx_x < grid_number; ++idx_x)
+        {
+            const auto& pixel = view.At(idx_x, idx_y);
+            fill_rectangle(UI_WINDOW_MARGIN + 1 + (grid_pixel + 1)*idx_x, \
+                           UI_WINDOW_MARGIN + 1 + (grid_pixel + 1)*idx_y, \
+                           grid_pixel, grid_pixel, \
+                           MagnifierRaster::PackPixel(pixel.r, pixel.g, pixel.b));
+        }
+    }
+
+    const int origin = UI_WINDOW_MARGIN + 1 + (grid_pixel + 1)*(grid_number/2);
+    const auto& centre_pixel = view.At(grid_number/2, grid_number/2);
+    fill_rectangle(origin - 1, origin - 1, grid_pixel + 2, grid_pixel + 2, \
+                                    MagnifierRaster::PackPixel(0, 0, 0));
+    fill_rectangle(origin, origin, grid_pixel, grid_pixel, \
+                                    MagnifierRaster::PackPixel(0xFF, 0xFF, 0xFF));
+    fill_rectangle(origin + 1, origin + 1, grid_pixel - 2, grid_pixel - 2, \
+                                    MagnifierRaster::PackPixel(centre_pixel.r, \
+                                            centre_pixel.g, centre_pixel.b));
+
+    //! DrawImage of the mask, every pixel of the window
+    for(int idx = 0; idx < size*size; ++idx)
+    {
+        CircleMask::CompositeSpan(framebuffer + idx, mask_image + idx, 1);
+    }
+}
+
+
+//! PAM, RGB_ALPHA, straight alpha
+static bool
+WriteFramebuffer(const char* path, const uint32_t* const framebuffer, int size)
+{
+    auto file = fopen(path, "wb");
+    if( file == nullptr ) { return false; }
+
+    fprintf(file, "P7\nWIDTH %d\nHEIGHT %d\nDEPTH 4\nMAXVAL 255\n"
+                  "TUPLTYPE RGB_ALPHA\nENDHDR\n", size, size);
+    for(int idx = 0; idx < size*size; ++idx)
+    {
+        const uint32_t pixel = framebuffer[idx];
+        const uint32_t alpha = pixel >> 24;
+        auto unpremultiply = [alpha](uint32_t v) -> uint8_t
+        {
+            return alpha == 0 ? 0 : uint8_t(std::min(255u, (v*255 + alpha/2)/alpha));
+        };
+        const uint8_t rgba[4] = { unpremultiply((pixel >> 16) & 0xFF), \
+                                  unpremultiply((pixel >> 8) & 0xFF), \
+                                  unpremultiply(pixel & 0xFF), uint8_t(alpha) };
+        fwrite(rgba, 1, 4, file);
+    }
+    fclose(file);
+    return true;
+}
+
+
+int
+main(int argc, char** argv)
+{
+    const int frames = std::max(1, ParameterOf(argc, argv, "--frames=", 10000));
+    const int scale = ParameterOf(argc, argv, "--scale=", 1);
+    class MagnifierRaster raster(scale, ParameterOf(argc, argv, "--grid=", GRID_NUMUBER), \
+                                        ParameterOf(argc, argv, "--zoom=", GRID_PIXEL));
+    const int grid_number = raster.GridNumber();
+    const int grid_pixel = raster.GridPixel();
+    const char* output_path = StringParameterOf(argc, argv, "--output=", nullptr);
+
+    //! a few distinct grids, cycled so the caches see what the picker sees
+    const int grid_count = 16;
+    std::vector<ScreenPixel> grids(size_t(grid_count)*grid_number*grid_number);
+    std::mt19937 generator(2020);
+    for(auto& pixel : grids)
+    {
+        pixel = ScreenPixel::FromRGB8(uint8_t(generator()), \
+                            uint8_t(generator()), uint8_t(generator()));
+    }
+    auto grid_view = [&](int idx)
+    {
+        struct ScreenPixelView<ScreenPixel> view;
+        view.data = grids.data() + size_t(idx % grid_count)*grid_number*grid_number;
+        view.width = view.height = view.stride = grid_number;
+        return view;
+    };
+
+    const int size = raster.Size();
+    std::vector<uint32_t> reference(size_t(size)*size);
+
+    std::vector<uint32_t> mask_image(size_t(size)*size, 0u);
+    const auto& mask = raster.Mask();
+    for(int idx = 0; idx < mask.RunCount(); ++idx)
+    {
+        const auto& run = mask.Runs()[idx];
+        std::copy(run.pixels, run.pixels + run.length, \
+                            mask_image.begin() + run.y*size + run.x);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for(int frame = 0; frame < frames; ++frame)
+    {
+        RenderPerCell(grid_view(frame), raster.Scale(), grid_number, grid_pixel, mask_image.data(), \
+                                                        reference.data());
+    }
+    const double per_cell_us = std::chrono::duration<double, std::micro>( \
+                        std::chrono::steady_clock::now() - start).count()/frames;
+
+    start = std::chrono::steady_clock::now();
+    for(int frame = 0; frame < frames; ++frame)
+    {
+        raster.Render(grid_view(frame));
+    }
+    const double raster_us = std::chrono::duration<double, std::micro>( \
+                        std::chrono::steady_clock::now() - start).count()/frames;
+
+    const bool same = 0 == memcmp(raster.Framebuffer(), reference.data(), \
+                                            reference.size()*sizeof(uint32_t));
+
+    //! a still cursor over a blinking caret
+    class MagnifierRaster incremental(scale, grid_number, grid_pixel);
+    class MagnifierRaster full(scale, grid_number, grid_pixel);
+    std::vector<uint32_t> buffers[2] = { std::vector<uint32_t>(size_t(size)*size), \
+                                         std::vector<uint32_t>(size_t(size)*size) };
+    struct RenderSurface surfaces[2];
+    for(int idx = 0; idx < 2; ++idx)
+    {
+        surfaces[idx].pixels = buffers[idx].data();
+        surfaces[idx].width = surfaces[idx].height = surfaces[idx].stride = size;
+    }
+    std::vector<ScreenPixel> caret_grid(grids.begin(), \
+                            grids.begin() + grid_number*grid_number);
+    struct ScreenPixelView<ScreenPixel> caret_view;
+    caret_view.data = caret_grid.data();
+    caret_view.width = caret_view.height = caret_view.stride = grid_number;
+    auto blink = [&](int frame)
+    {
+        caret_grid[3*grid_number + 2] = (frame & 1) == 0 ? \
+                        ScreenPixel::FromRGB8(0, 0, 0) : grids[3*grid_number + 2];
+    };
+
+    bool caret_same = true;
+    uint64_t caret_repaint_area = 0;
+    start = std::chrono::steady_clock::now();
+    for(int frame = 0; frame < frames; ++frame)
+    {
+        blink(frame);
+        incremental.Render(caret_view, &surfaces[frame & 1]);
+        caret_repaint_area += uint64_t(incremental.RepaintArea());
+    }
+    const double caret_us = std::chrono::duration<double, std::micro>( \
+                        std::chrono::steady_clock::now() - start).count()/frames;
+
+    //! both buffers against a full frame of what they hold
+    for(int frame = frames - 2; frame < frames; ++frame)
+    {
+        if( frame < 0 ) { continue; }
+        blink(frame);
+        full.Invalidate();
+        full.Render(caret_view);
+        caret_same = caret_same && 0 == memcmp(full.Framebuffer(), \
+                    buffers[frame & 1].data(), buffers[frame & 1].size()*sizeof(uint32_t));
+    }
+
+    fprintf(stdout, "window %dx%d (x%d), grid %dx%d of %d px, mask %s, %s cell fill\n", \
+                size, size, raster.Scale(), grid_number, grid_number, \
+                grid_pixel*raster.Scale(), mask.VariantName(), \
+                raster.FastPath() ? "specialised" : "generic");
+    fprintf(stdout, "per cell %8.2f us/frame\n", per_cell_us);
+    fprintf(stdout, "raster   %8.2f us/frame x%.1f %s\n", \
+                raster_us, per_cell_us/raster_us, same ? "ok" : "MISMATCH");
+    fprintf(stdout, "caret    %8.2f us/frame, repaint %.0f px/frame (%.1f%%), " \
+                "%llu full frames %s\n", caret_us, double(caret_repaint_area)/frames, \
+                100.0*incremental.MeanRepaintRatio(), \
+                (unsigned long long)incremental.FullFrameCount(), \
+                caret_same ? "ok" : "MISMATCH");
+
+    if( output_path != nullptr && !WriteFramebuffer(output_path, raster.Framebuffer(), size) )
+    {
+        fprintf(stderr, "cannot write %s\n", output_path);
+        return 1;
+    }
+    return same && caret_same ? 0 : 1;
+}
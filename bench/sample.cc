@@ -0,0 +1,175 @@
+//! sample() per call latency: one region at a time through a warm
+//! PointSampler::SampleRegion(), the way the addon serves sample(), with
+//! the p50/p99/max of every region size.
+//!
+//!   export DISPLAY=:99 && Xvfb :99 -screen 0 1920x1080x24 &
+//!   ./build/Release/sample_bench --calls=2000
+//!   ./build/Release/sample_bench --source=synthetic --calls=2000
+//!
+//! Regions up to --target-size a side are expected to stay within
+//! --target-us at p99, the bench exits non zero otherwise (--target-us=0
+//! only prints). The context is opened once, its cost is printed apart.
+
+#include <chrono>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+#include "../src/PointSampler.h"
+#include "../src/SyntheticFrameSource.h"
+#include "../src/linux/ScreenLens.h"
+
+
+typedef std::chrono::steady_clock clock_type;
+
+
+static int
+ParameterOf(int argc, char** argv, const char* name, int default_value)
+{
+    const auto name_length = strlen(name);
+    for(int idx = 1; idx < argc; ++idx)
+    {
+        if( strncmp(argv[idx], name, name_length) == 0 )
+        {
+            return atoi(argv[idx] + name_length);
+        }
+    }
+    return default_value;
+}
+
+
+static std::string
+StringParameterOf(int argc, char** argv, const char* name, const char* default_value)
+{
+    const auto name_length = strlen(name);
+    for(int idx = 1; idx < argc; ++idx)
+    {
+        if( strncmp(argv[idx], name, name_length) == 0 )
+        {
+            return std::string(argv[idx] + name_length);
+        }
+    }
+    return default_value;
+}
+
+
+//! a random desktop as a binary PPM
+static bool
+WriteDesktop(const std::string& path, int width, int height)
+{
+    auto file = fopen(path.c_str(), "wb");
+    if( file == nullptr ) { return false; }
+
+    fprintf(file, "P6\n%d %d\n255\n", width, height);
+    std::mt19937 generator(2020);
+    std::vector<uint8_t> row(size_t(width)*3);
+    for(int y = 0; y < height; ++y)
+    {
+        for(auto& value : row) { value = uint8_t(generator()); }
+        fwrite(row.data(), 1, row.size(), file);
+    }
+    fclose(file);
+    return true;
+}
+
+
+static double
+MicrosecondsSince(clock_type::time_point start)
+{
+    return std::chrono::duration<double, std::micro>(clock_type::now() - start).count();
+}
+
+
+//! the value below which ratio of the sorted latencies fall
+static double
+PercentileOf(const std::vector<double>& sorted, double ratio)
+{
+    const size_t idx = std::min(sorted.size() - 1, size_t(ratio*sorted.size()));
+    return sorted[idx];
+}
+
+
+int
+main(int argc, char** argv)
+{
+    const int calls = std::max(1, ParameterOf(argc, argv, "--calls=", 2000));
+    const int target_size = ParameterOf(argc, argv, "--target-size=", 17);
+    const int target_us = ParameterOf(argc, argv, "--target-us=", 500);
+    const std::string source_name = StringParameterOf(argc, argv, "--source=", "screen");
+
+    const auto open_start = clock_type::now();
+    std::unique_ptr<class FrameSource> frame_source;
+    try
+    {
+        if( source_name == "synthetic" )
+        {
+            const std::string image_path = "/tmp/sample_bench.ppm";
+            if( false == WriteDesktop(image_path, 1920, 1080) )
+            {
+                fprintf(stderr, "cannot write %s\n", image_path.c_str());
+                return 1;
+            }
+            frame_source.reset(new class SyntheticFrameSource(image_path, {}));
+        }
+        else
+        {
+            //! as the addon opens it: no DAMAGE nor XInput2, nothing waits
+            frame_source.reset(new class ScreenLens(nullptr, false));
+        }
+    }
+    catch(const std::exception& error)
+    {
+        fprintf(stderr, "%s\n", error.what());
+        return 1;
+    }
+    class PointSampler point_sampler(frame_source.get());
+    const double open_us = MicrosecondsSince(open_start);
+
+    const int width = frame_source->ScreenWidth();
+    const int height = frame_source->ScreenHeight();
+    fprintf(stdout, "%dx%d %s, context opened in %.1f us, %d calls per size\n", \
+                    width, height, source_name.c_str(), open_us, calls);
+
+    int result = 0;
+    std::mt19937 generator(5);
+    const int sizes[] = {1, 3, 17, 64, 256};
+    for(int size : sizes)
+    {
+        std::vector<uint32_t> colors(size_t(size)*size);
+        std::vector<double> latencies(calls);
+        for(auto& latency : latencies)
+        {
+            //! anywhere, the region may hang over the edges
+            const int left = int(generator() % width) - size/2;
+            const int top = int(generator() % height) - size/2;
+
+            const auto start = clock_type::now();
+            if( false == point_sampler.SampleRegion(left, top, size, size, colors.data()) )
+            {
+                fprintf(stderr, "%dx%d capture failed\n", size, size);
+                return 1;
+            }
+            latency = MicrosecondsSince(start);
+        }
+        std::sort(latencies.begin(), latencies.end());
+
+        const double p99 = PercentileOf(latencies, 0.99);
+        const bool targeted = target_us > 0 && size <= target_size;
+        const bool missed = targeted && p99 > target_us;
+        fprintf(stdout, "%3dx%-3d p50 %8.1f us  p99 %8.1f us  max %8.1f us%s\n", \
+                        size, size, PercentileOf(latencies, 0.50), p99, \
+                        latencies.back(), \
+                        missed ? "  MISSED" : targeted ? "  ok" : "");
+        if( missed )
+        {
+            result = 1;
+        }
+    }
+
+    return result;
+}
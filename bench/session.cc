@@ -0,0 +1,123 @@
+//! Time to first colour of a pick, cold against warm: what Picker() does
+//! before its first frame (open the X side, look up the display profile,
+//! build the pipeline, tick once) with a PickerContext opened for every
+//! pick, and with one kept across picks as a warm session does. There is
+//! no grab here, the picks never wait for a click.
+//!
+//!   export DISPLAY=:99 && Xvfb :99 -screen 0 1920x1080x24 &
+//!   ./build/Release/session_bench --picks=50
+
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+#include "../src/PickerPipeline.h"
+#include "../src/linux/PickerContext.h"
+
+
+typedef std::chrono::steady_clock clock_type;
+
+
+static int
+ParameterOf(int argc, char** argv, const char* name, int default_value)
+{
+    const auto name_length = strlen(name);
+    for(int idx = 1; idx < argc; ++idx)
+    {
+        if( strncmp(argv[idx], name, name_length) == 0 )
+        {
+            return atoi(argv[idx] + name_length);
+        }
+    }
+    return default_value;
+}
+
+
+static double
+MicrosecondsSince(clock_type::time_point start)
+{
+    return std::chrono::duration<double, std::micro>(clock_type::now() - start).count();
+}
+
+
+//! the first colour of a pick on a begun context, false when the
+//! pipeline has none
+static bool
+FirstColor(class PickerContext& context, struct PickerFrame<ScreenPixel>* const frame)
+{
+    auto& screen_lens = context.Lens();
+    screen_lens.SetColorTransform(context.DisplayColorTransform(TargetColorSpace::SRGB));
+
+    class PickerPipeline<ScreenPixel> pipeline(&screen_lens, {}, context.SnapshotPool());
+    if( false == pipeline.Tick() )
+    {
+        return false;
+    }
+    pipeline.Snapshot(frame);
+    return true;
+}
+
+
+static void
+PrintLatencies(const char* name, std::vector<double>& latencies)
+{
+    std::sort(latencies.begin(), latencies.end());
+    fprintf(stdout, "%-5s p50 %9.1f us  p99 %9.1f us  max %9.1f us\n", name, \
+                    latencies[latencies.size()/2], \
+                    latencies[std::min(latencies.size() - 1, latencies.size()*99/100)], \
+                    latencies.back());
+}
+
+
+int
+main(int argc, char** argv)
+{
+    const int picks = std::max(1, ParameterOf(argc, argv, "--picks=", 50));
+
+    std::vector<double> cold_latencies, warm_latencies;
+    struct PickerFrame<ScreenPixel> frame;
+    try
+    {
+        for(int pick = 0; pick < picks; ++pick)
+        {
+            const auto start = clock_type::now();
+            class PickerContext context;
+            context.Begin();
+            if( false == FirstColor(context, &frame) )
+            {
+                fprintf(stderr, "cold pick %d has no colour\n", pick);
+                return 1;
+            }
+            cold_latencies.push_back(MicrosecondsSince(start));
+            context.End();
+        }
+
+        class PickerContext context;
+        for(int pick = 0; pick < picks; ++pick)
+        {
+            const auto start = clock_type::now();
+            context.Begin();
+            if( false == FirstColor(context, &frame) )
+            {
+                fprintf(stderr, "warm pick %d has no colour\n", pick);
+                return 1;
+            }
+            warm_latencies.push_back(MicrosecondsSince(start));
+            context.End();
+        }
+    }
+    catch(const std::exception& error)
+    {
+        fprintf(stderr, "%s\n", error.what());
+        return 1;
+    }
+
+    fprintf(stdout, "time to first colour, %d picks each, last %s\n", picks, frame.color);
+    PrintLatencies("cold", cold_latencies);
+    PrintLatencies("warm", warm_latencies);
+    return 0;
+}
@@ -0,0 +1,537 @@
+//! Every kernel of the pixel pipeline over synthetic frames, as JSON, to
+//! compare one release with the next:
+//!
+//!   ./build/Release/pipeline_bench > pipeline.json
+//!   ./build/Release/pipeline_bench --filter=color --batch-ms=50 --repeats=9
+//!
+//! BGRA conversion (every kernel level the CPU runs, every pixel format),
+//! the colour transform (a Display P3 display to sRGB, built in memory),
+//! region averaging (mean and median over the usual eyedropper sizes),
+//! the magnifier raster (full and one cell frames, grids and scales) and
+//! the mask compositing. Every case is timed in batches of about
+//! --batch-ms, the median and the best of --repeats batches are reported
+//! per call; the logs of the constructors go to stderr.
+
+#include <cmath>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+#include "../src/pixel.h"
+#include "../src/PixelConvert.h"
+#include "../src/ColorProfile.h"
+#include "../src/ColorTransform.h"
+#include "../src/RegionSampler.h"
+#include "../src/MagnifierRaster.h"
+#include "../src/CircleMask.h"
+
+
+typedef std::chrono::steady_clock clock_type;
+
+
+//! where the results nothing else reads go, so they are not optimised out
+static volatile uint32_t sampled_color = 0;
+
+
+static const char*
+StringParameterOf(int argc, char** argv, const char* name, const char* default_value)
+{
+    const auto name_length = strlen(name);
+    for(int idx = 1; idx < argc; ++idx)
+    {
+        if( strncmp(argv[idx], name, name_length) == 0 )
+        {
+            return argv[idx] + name_length;
+        }
+    }
+    return default_value;
+}
+
+
+static int
+ParameterOf(int argc, char** argv, const char* name, int default_value)
+{
+    auto value = StringParameterOf(argc, argv, name, nullptr);
+    return value == nullptr ? default_value : atoi(value);
+}
+
+
+//! the first argument none of the names starts, nullptr when all are known
+static const char*
+UnknownParameterOf(int argc, char** argv, const char* const* names, int name_count)
+{
+    for(int idx = 1; idx < argc; ++idx)
+    {
+        bool known = false;
+        for(int name = 0; name < name_count && known == false; ++name)
+        {
+            known = strncmp(argv[idx], names[name], strlen(names[name])) == 0;
+        }
+        if( known == false )
+        {
+            return argv[idx];
+        }
+    }
+    return nullptr;
+}
+
+
+//! nanoseconds per call of one case
+struct Timing
+{
+    double median_ns = 0;
+    double best_ns = 0;
+    uint64_t calls = 0;
+};
+
+
+//! one JSON object per case, in the order they ran
+class Report
+{
+public:
+    Report(FILE* output, const char* filter, double batch_ms, int repeats)
+    :output_(output), filter_(filter), batch_ms_(batch_ms), repeats_(repeats)
+    {
+    }
+private:
+    FILE* const output_;
+    const std::string filter_;
+    const double batch_ms_;
+    const int repeats_;
+    int case_count_ = 0;
+public:
+    bool Selected(const std::string& name) const
+    {
+        return filter_.empty() || name.find(filter_) != std::string::npos;
+    }
+    //! calls body in batches, pixels per call for the throughput, 0 when
+    //! it makes no sense
+    template <typename Body>
+    void Run(const std::string& name, const std::string& variant, \
+             int width, int height, uint64_t pixels, Body body)
+    {
+        if( false == Selected(name) )
+        {
+            return;
+        }
+
+        //! as many calls as fit in a batch, from a first one
+        const auto first_start = clock_type::now();
+        body();
+        const double first_ns = std::max(1.0, std::chrono::duration<double, \
+                                        std::nano>(clock_type::now() - first_start).count());
+        const uint64_t batch_calls = std::max<uint64_t>(1, uint64_t(batch_ms_*1e6/first_ns));
+
+        std::vector<double> batches;
+        struct Timing timing;
+        for(int repeat = 0; repeat < repeats_; ++repeat)
+        {
+            const auto start = clock_type::now();
+            for(uint64_t call = 0; call < batch_calls; ++call)
+            {
+                body();
+            }
+            batches.push_back(std::chrono::duration<double, std::nano>( \
+                                    clock_type::now() - start).count()/batch_calls);
+            timing.calls += batch_calls;
+        }
+        std::sort(batches.begin(), batches.end());
+        timing.median_ns = batches[batches.size()/2];
+        timing.best_ns = batches.front();
+
+        fprintf(output_, "%s\n    {\"name\": \"%s\", \"variant\": \"%s\", " \
+                        "\"width\": %d, \"height\": %d, \"calls\": %llu, " \
+                        "\"median_ns\": %.1f, \"best_ns\": %.1f, \"ns_per_pixel\": %.4f}", \
+                        case_count_ == 0 ? "" : ",", name.c_str(), variant.c_str(), \
+                        width, height, (unsigned long long)timing.calls, \
+                        timing.median_ns, timing.best_ns, \
+                        pixels == 0 ? 0.0 : timing.median_ns/pixels);
+        fflush(output_);
+        fprintf(stderr, "%-8s %-16s %4dx%-4d %12.1f ns\n", name.c_str(), \
+                        variant.c_str(), width, height, timing.median_ns);
+        case_count_ += 1;
+    }
+};
+
+
+//! a random 32 bits BGRX frame, as X11 SHM captures it
+static std::vector<uint8_t>
+RandomFrame(int width, int height, uint32_t seed)
+{
+    std::vector<uint8_t> pixels(size_t(width)*height*4);
+    std::mt19937 generator(seed);
+    for(auto& value : pixels)
+    {
+        value = uint8_t(generator());
+    }
+    return pixels;
+}
+
+
+static struct CapturedFrame
+CapturedFrameOf(const std::vector<uint8_t>& pixels, int width, int height)
+{
+    struct CapturedFrame frame;
+    frame.data = pixels.data();
+    frame.stride = width*4;
+    frame.bytes_per_pixel = 4;
+    frame.blue_offset = 0;
+    frame.green_offset = 1;
+    frame.red_offset = 2;
+    frame.width = width;
+    frame.height = height;
+    frame.screen_width = width;
+    frame.screen_height = height;
+    return frame;
+}
+
+
+static void
+PutU32(std::vector<uint8_t>& data, size_t offset, uint32_t value)
+{
+    data[offset + 0] = uint8_t(value >> 24);
+    data[offset + 1] = uint8_t(value >> 16);
+    data[offset + 2] = uint8_t(value >> 8);
+    data[offset + 3] = uint8_t(value);
+}
+
+
+static void
+PutS15Fixed16(std::vector<uint8_t>& data, size_t offset, double value)
+{
+    PutU32(data, offset, uint32_t(int32_t(std::lround(value*65536.0))));
+}
+
+
+//! a matrix/TRC profile of a Display P3 screen: the D50 adapted P3
+//! colorants and the sRGB tone curve, as a 'para' type 3
+static std::vector<uint8_t>
+DisplayP3Profile()
+{
+    const char* const signatures[6] = { "rXYZ", "gXYZ", "bXYZ", "rTRC", "gTRC", "bTRC" };
+    const double colorants[3][3] = {
+        {0.5151, 0.2412, -0.0011}, {0.2919, 0.6922, 0.0419}, {0.1571, 0.0666, 0.7841}
+    };
+    const double curve[5] = {2.4, 1/1.055, 0.055/1.055, 1/12.92, 0.04045};
+
+    const size_t table_size = 4 + 6*12;
+    const size_t xyz_size = 20;
+    const size_t para_size = 12 + 5*4;
+    const size_t size = 128 + table_size + 3*xyz_size + 3*para_size;
+    std::vector<uint8_t> data(size, 0);
+
+    auto signature = [](const char* name)
+    {
+        return uint32_t(uint8_t(name[0])) << 24 | uint32_t(uint8_t(name[1])) << 16 | \
+               uint32_t(uint8_t(name[2])) << 8 | uint32_t(uint8_t(name[3]));
+    };
+    PutU32(data, 0, uint32_t(size));
+    PutU32(data, 12, signature("mntr"));
+    PutU32(data, 16, signature("RGB "));
+    PutU32(data, 20, signature("XYZ "));
+    PutU32(data, 36, signature("acsp"));
+    PutU32(data, 128, 6);
+
+    size_t offset = 128 + table_size;
+    for(int idx = 0; idx < 6; ++idx)
+    {
+        const bool is_colorant = idx < 3;
+        const size_t length = is_colorant ? xyz_size : para_size;
+        PutU32(data, 132 + idx*12, signature(signatures[idx]));
+        PutU32(data, 132 + idx*12 + 4, uint32_t(offset));
+        PutU32(data, 132 + idx*12 + 8, uint32_t(length));
+
+        if( is_colorant )
+        {
+            PutU32(data, offset, signature("XYZ "));
+            for(int row = 0; row < 3; ++row)
+            {
+                PutS15Fixed16(data, offset + 8 + row*4, colorants[idx][row]);
+            }
+        }
+        else
+        {
+            PutU32(data, offset, signature("para"));
+            data[offset + 8] = 0;
+            data[offset + 9] = 3;
+            for(int parameter = 0; parameter < 5; ++parameter)
+            {
+                PutS15Fixed16(data, offset + 12 + parameter*4, curve[parameter]);
+            }
+        }
+        offset += length;
+    }
+    return data;
+}
+
+
+static void
+BenchConvert(class Report& report)
+{
+    const int sizes[][2] = { {17, 17}, {64, 64}, {256, 256}, {1920, 1080} };
+    const auto detected = DetectConvertKernelLevel();
+
+    for(const auto& size : sizes)
+    {
+        const int width = size[0], height = size[1];
+        const auto pixels = RandomFrame(width, height, 1);
+        const auto frame = CapturedFrameOf(pixels, width, height);
+        const uint64_t area = uint64_t(width)*height;
+
+        std::vector<PixelRGBA8> rgba8(area);
+        for(auto level : { ConvertKernelLevel::SCALAR, ConvertKernelLevel::SSE2, \
+                           ConvertKernelLevel::AVX2, ConvertKernelLevel::AVX512 })
+        {
+            auto kernel = BGRAToRGBA8RowKernel(level);
+            if( level > detected || kernel == nullptr )
+            {
+                continue;
+            }
+            report.Run("convert", std::string("rgba8-") + ConvertKernelLevelName(level), \
+                       width, height, area, [&]()
+            {
+                for(int y = 0; y < height; ++y)
+                {
+                    kernel(pixels.data() + size_t(y)*frame.stride, \
+                           rgba8.data() + size_t(y)*width, width);
+                }
+            });
+        }
+
+        std::vector<PixelRGB10A2> rgb10a2(area);
+        report.Run("convert", "rgb10a2", width, height, area, [&]()
+        {
+            ConvertCapturedFrame(frame, 0, 0, width, height, rgb10a2.data(), width);
+        });
+        std::vector<PixelRGBA16F> rgba16f(area);
+        report.Run("convert", "rgba16f", width, height, area, [&]()
+        {
+            ConvertCapturedFrame(frame, 0, 0, width, height, rgba16f.data(), width);
+        });
+    }
+}
+
+
+static void
+BenchColor(class Report& report)
+{
+    if( false == report.Selected("color") )
+    {
+        return;
+    }
+
+    const auto profile_data = DisplayP3Profile();
+    class ColorProfile profile(profile_data.data(), profile_data.size());
+    class ColorTransform transform(profile, TargetColorSpace::SRGB);
+    const auto detected = DetectConvertKernelLevel();
+
+    const int sizes[][2] = { {17, 17}, {256, 256}, {1920, 1080} };
+    for(const auto& size : sizes)
+    {
+        const int width = size[0], height = size[1];
+        const uint64_t area = uint64_t(width)*height;
+        const auto pixels = RandomFrame(width, height, 2);
+        std::vector<PixelRGBA8> source(area), rows(area);
+        ConvertCapturedFrame(CapturedFrameOf(pixels, width, height), \
+                             0, 0, width, height, source.data(), width);
+
+        for(auto level : { ConvertKernelLevel::SCALAR, ConvertKernelLevel::SSE2, \
+                           ConvertKernelLevel::AVX2 })
+        {
+            if( level > detected )
+            {
+                continue;
+            }
+            transform.SetKernelLevel(level);
+            report.Run("color", std::string("srgb-") + ConvertKernelLevelName(level), \
+                       width, height, area, [&]()
+            {
+                std::copy(source.begin(), source.end(), rows.begin());
+                transform.TransformRow(rows.data(), int(area));
+            });
+        }
+
+        std::vector<PixelRGBA16F> wide(area);
+        ConvertCapturedFrame(CapturedFrameOf(pixels, width, height), \
+                             0, 0, width, height, wide.data(), width);
+        std::vector<PixelRGBA16F> wide_rows(area);
+        report.Run("color", "srgb-rgba16f", width, height, area, [&]()
+        {
+            std::copy(wide.begin(), wide.end(), wide_rows.begin());
+            transform.TransformRow(wide_rows.data(), int(area));
+        });
+    }
+}
+
+
+static void
+BenchAverage(class Report& report)
+{
+    //! the capture is the grid at least, the sample in its middle
+    for(int sample_size : { 3, 11, 31, 101 })
+    {
+        const int side = std::max(GRID_NUMUBER, sample_size);
+        const uint64_t area = uint64_t(side)*side;
+        const auto pixels = RandomFrame(side, side, 3);
+        std::vector<PixelRGBA8> rgba8(area);
+        ConvertCapturedFrame(CapturedFrameOf(pixels, side, side), \
+                             0, 0, side, side, rgba8.data(), side);
+
+        struct ScreenPixelView<PixelRGBA8> view;
+        view.data = rgba8.data();
+        view.width = side;
+        view.height = side;
+        view.stride = side;
+
+        const int origin = side/2 - sample_size/2;
+        class RegionSampler<PixelRGBA8> sampler;
+        const std::string variant = std::to_string(sample_size) + "x" + std::to_string(sample_size);
+        report.Run("average", "mean-" + variant, side, side, area, [&]()
+        {
+            sampler.Build(view);
+            sampled_color = sampler.Mean(origin, origin, sample_size, sample_size).Packed();
+        });
+        report.Run("average", "median-" + variant, side, side, uint64_t(sample_size)*sample_size, [&]()
+        {
+            sampled_color = sampler.Median(origin, origin, sample_size, sample_size).Packed();
+        });
+    }
+}
+
+
+static void
+BenchRaster(class Report& report)
+{
+    if( false == report.Selected("raster") )
+    {
+        return;
+    }
+
+    const int grids[][2] = { {9, 13}, {GRID_NUMUBER, GRID_PIXEL}, {33, 5} };
+    for(const auto& grid : grids)
+    {
+        const int grid_number = grid[0], grid_pixel = grid[1];
+        const auto pixels = RandomFrame(grid_number, grid_number, 4);
+        std::vector<PixelRGBA8> cells(size_t(grid_number)*grid_number);
+        ConvertCapturedFrame(CapturedFrameOf(pixels, grid_number, grid_number), \
+                             0, 0, grid_number, grid_number, cells.data(), grid_number);
+
+        struct ScreenPixelView<PixelRGBA8> view;
+        view.data = cells.data();
+        view.width = grid_number;
+        view.height = grid_number;
+        view.stride = grid_number;
+
+        for(int scale : { 1, 2 })
+        {
+            class MagnifierRaster raster(scale, grid_number, grid_pixel);
+            const int size = raster.Size();
+            const uint64_t area = uint64_t(size)*size;
+            const std::string variant = std::to_string(grid_number) + "x" + \
+                        std::to_string(grid_pixel) + "@" + std::to_string(scale) + "x";
+
+            report.Run("raster", "full-" + variant, size, size, area, [&]()
+            {
+                raster.Invalidate();
+                raster.Render(view);
+            });
+
+            //! a caret blinking in the centre cell
+            auto& centre = cells[cells.size()/2];
+            report.Run("raster", "cell-" + variant, size, size, area, [&]()
+            {
+                centre.r ^= 0xFF;
+                raster.Render(view);
+            });
+        }
+    }
+}
+
+
+static void
+BenchMask(class Report& report)
+{
+    if( false == report.Selected("mask") )
+    {
+        return;
+    }
+
+    for(int scale : { 1, 2 })
+    {
+        for(int grid_number : { 9, GRID_NUMUBER, 33 })
+        {
+            const int size = MagnifierRaster::WindowSize(grid_number, GRID_PIXEL)*scale;
+            class CircleMask mask(scale, size);
+            std::vector<uint32_t> target(size_t(size)*size, MagnifierRaster::BackgroundPixel());
+            const std::string variant = std::to_string(grid_number) + "@" + std::to_string(scale) + "x";
+
+            report.Run("mask", "runs-" + variant, size, size, uint64_t(size)*size, [&]()
+            {
+                mask.Composite(target.data(), size);
+            });
+        }
+    }
+}
+
+
+int
+main(int argc, char** argv)
+{
+    //! a mistyped option would run the defaults and look like a valid result
+    static const char* const names[] = { "--filter=", "--batch-ms=", "--repeats=", "--output=" };
+    const char* unknown = UnknownParameterOf(argc, argv, names, int(sizeof(names)/sizeof(names[0])));
+    if( unknown != nullptr )
+    {
+        fprintf(stderr, "unknown option %s\n" \
+                        "usage: pipeline_bench [--filter=NAME] [--batch-ms=20] [--repeats=5] [--output=FILE]\n", \
+                        unknown);
+        return 2;
+    }
+
+    const char* filter = StringParameterOf(argc, argv, "--filter=", "");
+    const int batch_ms = std::max(1, ParameterOf(argc, argv, "--batch-ms=", 20));
+    const int repeats = std::max(1, ParameterOf(argc, argv, "--repeats=", 5));
+    const char* output_path = StringParameterOf(argc, argv, "--output=", nullptr);
+
+    FILE* output = stdout;
+    if( output_path != nullptr )
+    {
+        output = fopen(output_path, "w");
+        if( output == nullptr )
+        {
+            fprintf(stderr, "cannot write %s\n", output_path);
+            return 1;
+        }
+    }
+
+    fprintf(output, "{\n  \"kernel_level\": \"%s\",\n  \"batch_ms\": %d,\n" \
+                    "  \"repeats\": %d,\n  \"results\": [", \
+                    ConvertKernelLevelName(DetectConvertKernelLevel()), batch_ms, repeats);
+
+    class Report report(output, filter, batch_ms, repeats);
+    try
+    {
+        BenchConvert(report);
+        BenchColor(report);
+        BenchAverage(report);
+        BenchRaster(report);
+        BenchMask(report);
+    }
+    catch(const std::exception& error)
+    {
+        fprintf(stderr, "%s\n", error.what());
+        return 1;
+    }
+
+    fprintf(output, "\n  ]\n}\n");
+    if( output != stdout )
+    {
+        fclose(output);
+    }
+    return 0;
+}
@@ -0,0 +1,182 @@
+//! Magnifier frames rendered into pooled XShm surfaces and presented in a
+//! window which walks the screen, against the same frames with the
+//! surfaces created and destroyed every frame (the DC/DIB section churn of
+//! the old windows). Runs fine under Xvfb:
+//!
+//!   Xvfb :99 -screen 0 1920x1080x24 &
+//!   DISPLAY=:99 ./build/Release/surface_bench --frames=1000 --buffers=3
+//!
+//! --dpi-change-at=N moves the window to a 2x screen at frame N: the
+//! surfaces are reallocated once and only once, the 2x magnifier and mask
+//! are drawn from then on. Exits 1 when a steady state frame allocated a
+//! surface.
+
+#include <chrono>
+#include <vector>
+#include <random>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+#include "../src/MagnifierRaster.h"
+#include "../src/linux/XShmSurfacePool.h"
+
+
+static const char*
+StringParameterOf(int argc, char** argv, const char* name, const char* default_value)
+{
+    const auto name_length = strlen(name);
+    for(int idx = 1; idx < argc; ++idx)
+    {
+        if( strncmp(argv[idx], name, name_length) == 0 )
+        {
+            return argv[idx] + name_length;
+        }
+    }
+    return default_value;
+}
+
+
+static int
+ParameterOf(int argc, char** argv, const char* name, int default_value)
+{
+    auto value = StringParameterOf(argc, argv, name, nullptr);
+    return value == nullptr ? default_value : atoi(value);
+}
+
+
+int
+main(int argc, char** argv)
+{
+    const int frames = std::max(1, ParameterOf(argc, argv, "--frames=", 1000));
+    const int buffer_count = ParameterOf(argc, argv, "--buffers=", 2);
+    const int dpi_change_at = ParameterOf(argc, argv, "--dpi-change-at=", -1);
+
+    auto display = ::XOpenDisplay(nullptr);
+    if( display == nullptr )
+    {
+        fprintf(stderr, "cannot open display\n");
+        return 1;
+    }
+    const int screen_width = DisplayWidth(display, DefaultScreen(display));
+    const int screen_height = DisplayHeight(display, DefaultScreen(display));
+
+    const int grid_count = 16;
+    std::vector<ScreenPixel> grids(size_t(grid_count)*GRID_NUMUBER*GRID_NUMUBER);
+    std::mt19937 generator(2020);
+    for(auto& pixel : grids)
+    {
+        pixel = ScreenPixel::FromRGB8(uint8_t(generator()), \
+                            uint8_t(generator()), uint8_t(generator()));
+    }
+    auto grid_view = [&](int idx)
+    {
+        struct ScreenPixelView<ScreenPixel> view;
+        view.data = grids.data() + size_t(idx % grid_count)*GRID_NUMUBER*GRID_NUMUBER;
+        view.width = view.height = view.stride = GRID_NUMUBER;
+        return view;
+    };
+    //! a diagonal walk, as a cursor would drag the window
+    auto window_x = [&](int frame)
+    {
+        return (frame*7) % std::max(1, screen_width - UI_WINDOW_SIZE);
+    };
+    auto window_y = [&](int frame)
+    {
+        return (frame*5) % std::max(1, screen_height - UI_WINDOW_SIZE);
+    };
+
+    class MagnifierRaster raster(1);
+    class MagnifierRaster raster_2x(2);
+    bool ok = true;
+
+    //! pooled: one Reserve() per size and DPI, then Acquire/Render/Present;
+    //! a frame whose size and DPI are the previous frame's is steady state
+    double pooled_us = 0;
+    {
+        class XShmSurfacePool pool(display, buffer_count);
+        uint64_t steady_allocations = 0;
+        uint64_t reserve_changes = 0;
+        int previous_dpi = 0;
+
+        const auto start = std::chrono::steady_clock::now();
+        for(int frame = 0; frame < frames; ++frame)
+        {
+            const int dpi = (dpi_change_at >= 0 && frame >= dpi_change_at) ? 192 : 96;
+            auto& frame_raster = MagnifierRaster::ScaleForDPI(dpi) == 2 ? raster_2x : raster;
+            const auto allocations = pool.AllocationCount();
+            if( false == pool.Reserve(frame_raster.Size(), frame_raster.Size(), dpi) )
+            {
+                ok = false;
+                break;
+            }
+
+            auto surface = pool.Acquire();
+            frame_raster.Render(grid_view(frame), surface);
+            pool.Present(window_x(frame), window_y(frame), \
+                        frame_raster.PresentRects(), frame_raster.PresentRectCount());
+
+            if( dpi == previous_dpi )
+            {
+                steady_allocations += pool.AllocationCount() - allocations;
+            }
+            else
+            {
+                reserve_changes += 1;
+            }
+            previous_dpi = dpi;
+        }
+        ::XSync(display, False);
+        pooled_us = std::chrono::duration<double, std::micro>( \
+                        std::chrono::steady_clock::now() - start).count()/frames;
+
+        ok = ok && steady_allocations == 0 && \
+                pool.AllocationCount() == reserve_changes*pool.BufferCount();
+
+        fprintf(stdout, "window %dx%d on %dx%d, %d buffers\n", UI_WINDOW_SIZE, \
+                UI_WINDOW_SIZE, screen_width, screen_height, pool.BufferCount());
+        fprintf(stdout, "pooled    %8.2f us/frame, %llu surfaces allocated " \
+                "for %llu size/DPI, %llu in steady state frames, " \
+                "%llu presents, %llu waits\n", pooled_us, \
+                (unsigned long long)pool.AllocationCount(), \
+                (unsigned long long)reserve_changes, \
+                (unsigned long long)steady_allocations, \
+                (unsigned long long)pool.PresentCount(), \
+                (unsigned long long)pool.WaitCount());
+    }
+
+    //! per frame: a surface is allocated, drawn from scratch, presented
+    //! and released, as CreateDIBSection/DeleteObject did
+    double churn_us = 0;
+    {
+        class XShmSurfacePool pool(display, 2);
+
+        const auto start = std::chrono::steady_clock::now();
+        for(int frame = 0; frame < frames; ++frame)
+        {
+            //! an odd DPI each frame forces the reallocation
+            if( false == pool.Reserve(UI_WINDOW_SIZE, UI_WINDOW_SIZE, 96 + frame%2) )
+            {
+                ok = false;
+                break;
+            }
+            auto surface = pool.Acquire();
+            raster.Render(grid_view(frame), surface);
+            pool.Present(window_x(frame), window_y(frame), \
+                        raster.PresentRects(), raster.PresentRectCount());
+        }
+        ::XSync(display, False);
+        churn_us = std::chrono::duration<double, std::micro>( \
+                        std::chrono::steady_clock::now() - start).count()/frames;
+
+        fprintf(stdout, "per frame %8.2f us/frame, %llu surfaces allocated\n", \
+                churn_us, (unsigned long long)pool.AllocationCount());
+    }
+
+    fprintf(stdout, "pooled x%.1f %s\n", churn_us/pooled_us, \
+                        ok ? "ok" : "STEADY STATE ALLOCATED");
+
+    ::XCloseDisplay(display);
+    return ok ? 0 : 1;
+}
@@ -4,7 +4,19 @@
       'target_name': 'picker',
       'sources': [
 
-        'src/addon.cc'
+        'src/addon.cc',
+        'src/CircleMask.cc',
+        'src/CircleMaskData.cc',
+        'src/ColorProfile.cc',
+        'src/ColorTransform.cc',
+        'src/MagnifierRaster.cc',
+        'src/PickerPipeline.cc',
+        'src/PixelConvert.cc',
+        'src/PointSampler.cc',
+        'src/RegionSampler.cc',
+        'src/SurfacePool.cc',
+        'src/SyntheticFrameSource.cc',
+        'src/TileCache.cc'
       ],
       'include_dirs': ["<!@(node -p \"require('node-addon-api').include\")"],
       'dependencies': ["<!(node -p \"require('node-addon-api').gyp\")"],
@@ -17,7 +29,244 @@
       },
       'msvs_settings': {
         'VCCLCompilerTool': { 'ExceptionHandling': 1 },
-      }
+      },
+      'conditions': [
+        ['OS=="win"', {
+          'defines': [ 'OS_WINDOWS' ],
+          'sources': [ 'src/windows/Picker.cc' ]
+        }],
+        ['OS=="mac"', {
+          'defines': [ 'OS_MACOS' ]
+        }],
+        ['OS=="linux"', {
+          'defines': [ 'OS_LINUX' ],
+          'sources': [
+            'src/linux/Picker.cc',
+            'src/linux/PickerContext.cc',
+            'src/linux/ScreenLens.cc'
+          ],
+          'cflags_cc': [ '-std=c++17' ],
+          'ldflags': [ '-pthread' ],
+          'libraries': [ '-lX11', '-lXext', '-lXdamage', '-lXi' ]
+        }]
+      ]
     }
+  ],
+  'conditions': [
+    ['OS=="linux"', {
+      'targets': [
+        {
+          'target_name': 'capture_bench',
+          'type': 'executable',
+          'sources': [
+            'bench/capture.cc',
+            'src/ColorProfile.cc',
+            'src/ColorTransform.cc',
+            'src/PixelConvert.cc',
+            'src/linux/ScreenLens.cc'
+          ],
+          'defines': [ 'OS_LINUX' ],
+          'cflags!': [ '-fno-exceptions' ],
+          'cflags_cc!': [ '-fno-exceptions' ],
+          'cflags_cc': [ '-std=c++17' ],
+          'libraries': [ '-lX11', '-lXext', '-lXdamage', '-lXi' ]
+        },
+        {
+          'target_name': 'convert_bench',
+          'type': 'executable',
+          'sources': [
+            'bench/convert.cc',
+            'src/PixelConvert.cc'
+          ],
+          'cflags!': [ '-fno-exceptions' ],
+          'cflags_cc!': [ '-fno-exceptions' ],
+          'cflags_cc': [ '-std=c++17' ]
+        },
+        {
+          'target_name': 'color_bench',
+          'type': 'executable',
+          'sources': [
+            'bench/color.cc',
+            'src/ColorProfile.cc',
+            'src/ColorTransform.cc',
+            'src/PixelConvert.cc'
+          ],
+          'cflags!': [ '-fno-exceptions' ],
+          'cflags_cc!': [ '-fno-exceptions' ],
+          'cflags_cc': [ '-std=c++17' ]
+        },
+        {
+          'target_name': 'raster_bench',
+          'type': 'executable',
+          'sources': [
+            'bench/raster.cc',
+            'src/CircleMask.cc',
+            'src/CircleMaskData.cc',
+            'src/MagnifierRaster.cc'
+          ],
+          'defines': [ 'OS_LINUX' ],
+          'cflags!': [ '-fno-exceptions' ],
+          'cflags_cc!': [ '-fno-exceptions' ],
+          'cflags_cc': [ '-std=c++17' ]
+        },
+        {
+          'target_name': 'surface_bench',
+          'type': 'executable',
+          'sources': [
+            'bench/surface.cc',
+            'src/CircleMask.cc',
+            'src/CircleMaskData.cc',
+            'src/MagnifierRaster.cc',
+            'src/SurfacePool.cc',
+            'src/linux/XShmSurfacePool.cc'
+          ],
+          'defines': [ 'OS_LINUX' ],
+          'cflags!': [ '-fno-exceptions' ],
+          'cflags_cc!': [ '-fno-exceptions' ],
+          'cflags_cc': [ '-std=c++17' ],
+          'libraries': [ '-lX11', '-lXext' ]
+        },
+        {
+          'target_name': 'mask_bench',
+          'type': 'executable',
+          'sources': [
+            'bench/mask.cc',
+            'src/CircleMask.cc',
+            'src/CircleMaskData.cc',
+            'src/MagnifierRaster.cc'
+          ],
+          'defines': [ 'OS_LINUX' ],
+          'cflags!': [ '-fno-exceptions' ],
+          'cflags_cc!': [ '-fno-exceptions' ],
+          'cflags_cc': [ '-std=c++17' ],
+          'libraries': [ '-lz' ]
+        },
+        {
+          'target_name': 'pipeline_bench',
+          'type': 'executable',
+          'sources': [
+            'bench/suite.cc',
+            'src/CircleMask.cc',
+            'src/CircleMaskData.cc',
+            'src/ColorProfile.cc',
+            'src/ColorTransform.cc',
+            'src/MagnifierRaster.cc',
+            'src/PixelConvert.cc',
+            'src/RegionSampler.cc'
+          ],
+          'defines': [ 'OS_LINUX' ],
+          'cflags!': [ '-fno-exceptions' ],
+          'cflags_cc!': [ '-fno-exceptions' ],
+          'cflags_cc': [ '-std=c++17' ]
+        },
+        {
+          'target_name': 'handoff_bench',
+          'type': 'executable',
+          'sources': [
+            'bench/handoff.cc',
+            'src/CircleMask.cc',
+            'src/CircleMaskData.cc',
+            'src/ColorProfile.cc',
+            'src/ColorTransform.cc',
+            'src/MagnifierRaster.cc',
+            'src/PickerPipeline.cc',
+            'src/PixelConvert.cc',
+            'src/RegionSampler.cc',
+            'src/SyntheticFrameSource.cc',
+            'src/TileCache.cc'
+          ],
+          'defines': [ 'OS_LINUX' ],
+          'cflags!': [ '-fno-exceptions' ],
+          'cflags_cc!': [ '-fno-exceptions' ],
+          'cflags_cc': [ '-std=c++17' ],
+          'ldflags': [ '-pthread' ]
+        },
+        {
+          'target_name': 'points_bench',
+          'type': 'executable',
+          'sources': [
+            'bench/points.cc',
+            'src/ColorProfile.cc',
+            'src/ColorTransform.cc',
+            'src/PixelConvert.cc',
+            'src/PointSampler.cc',
+            'src/SyntheticFrameSource.cc',
+            'src/linux/ScreenLens.cc'
+          ],
+          'defines': [ 'OS_LINUX' ],
+          'cflags!': [ '-fno-exceptions' ],
+          'cflags_cc!': [ '-fno-exceptions' ],
+          'cflags_cc': [ '-std=c++17' ],
+          'libraries': [ '-lX11', '-lXext', '-lXdamage', '-lXi' ]
+        },
+        {
+          'target_name': 'sample_bench',
+          'type': 'executable',
+          'sources': [
+            'bench/sample.cc',
+            'src/ColorProfile.cc',
+            'src/ColorTransform.cc',
+            'src/PixelConvert.cc',
+            'src/PointSampler.cc',
+            'src/SyntheticFrameSource.cc',
+            'src/linux/ScreenLens.cc'
+          ],
+          'defines': [ 'OS_LINUX' ],
+          'cflags!': [ '-fno-exceptions' ],
+          'cflags_cc!': [ '-fno-exceptions' ],
+          'cflags_cc': [ '-std=c++17' ],
+          'libraries': [ '-lX11', '-lXext', '-lXdamage', '-lXi' ]
+        },
+        {
+          'target_name': 'session_bench',
+          'type': 'executable',
+          'sources': [
+            'bench/session.cc',
+            'src/ColorProfile.cc',
+            'src/ColorTransform.cc',
+            'src/PickerPipeline.cc',
+            'src/PixelConvert.cc',
+            'src/RegionSampler.cc',
+            'src/TileCache.cc',
+            'src/linux/PickerContext.cc',
+            'src/linux/ScreenLens.cc'
+          ],
+          'defines': [ 'OS_LINUX' ],
+          'cflags!': [ '-fno-exceptions' ],
+          'cflags_cc!': [ '-fno-exceptions' ],
+          'cflags_cc': [ '-std=c++17' ],
+          'libraries': [ '-lX11', '-lXext', '-lXdamage', '-lXi' ]
+        },
+        {
+          'target_name': 'motion_driver',
+          'type': 'executable',
+          'sources': [
+            'bench/motion.cc'
+          ],
+          'defines': [ 'OS_LINUX' ],
+          'cflags!': [ '-fno-exceptions' ],
+          'cflags_cc!': [ '-fno-exceptions' ],
+          'cflags_cc': [ '-std=c++17' ],
+          'libraries': [ '-lX11', '-lXtst' ]
+        },
+        {
+          'target_name': 'tile_cache_test',
+          'type': 'executable',
+          'sources': [
+            'test/tile_cache.cc',
+            'src/ColorProfile.cc',
+            'src/ColorTransform.cc',
+            'src/PickerPipeline.cc',
+            'src/PixelConvert.cc',
+            'src/RegionSampler.cc',
+            'src/TileCache.cc'
+          ],
+          'defines': [ 'OS_LINUX' ],
+          'cflags!': [ '-fno-exceptions' ],
+          'cflags_cc!': [ '-fno-exceptions' ],
+          'cflags_cc': [ '-std=c++17' ]
+        }
+      ]
+    }]
   ]
-}
\ No newline at end of file
+}
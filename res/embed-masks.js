@@ -0,0 +1,203 @@
+// Decodes the loupe masks once, at build time, into src/CircleMaskData.cc:
+// premultiplied 0xAARRGGBB palettes and the non transparent runs of every
+// row, so the picker never sees a PNG.
+//
+//   npm run embed-masks
+//
+// Only what the masks use is supported: 8 bits, palette (tRNS for alpha),
+// truecolour or truecolour with alpha, not interlaced.
+
+const fs = require('fs');
+const path = require('path');
+const zlib = require('zlib');
+
+const VARIANTS = [
+    { file: 'Mask@1.png', name: 'MASK_1', scale: 1, shadow: false },
+    { file: 'Mask@2.png', name: 'MASK_2', scale: 2, shadow: false },
+    { file: 'Mask@2+s.png', name: 'MASK_2_SHADOW', scale: 2, shadow: true }
+];
+
+const OUTPUT = path.join(__dirname, '..', 'src', 'CircleMaskData.cc');
+
+function decodePNG(buffer) {
+    let offset = 8;
+    let header = null;
+    let palette = null;
+    let transparency = null;
+    const compressed = [];
+
+    while (offset < buffer.length) {
+        const length = buffer.readUInt32BE(offset);
+        const type = buffer.toString('latin1', offset + 4, offset + 8);
+        const data = buffer.subarray(offset + 8, offset + 8 + length);
+        offset += 12 + length;
+
+        if (type === 'IHDR') {
+            header = {
+                width: data.readUInt32BE(0),
+                height: data.readUInt32BE(4),
+                bitDepth: data[8],
+                colorType: data[9],
+                interlace: data[12]
+            };
+        } else if (type === 'PLTE') {
+            palette = data;
+        } else if (type === 'tRNS') {
+            transparency = data;
+        } else if (type === 'IDAT') {
+            compressed.push(data);
+        }
+    }
+
+    const channels = { 2: 3, 3: 1, 6: 4 }[header.colorType];
+    if (header.bitDepth !== 8 || header.interlace !== 0 || channels === undefined) {
+        throw new Error('unsupported PNG');
+    }
+
+    const raw = zlib.inflateSync(Buffer.concat(compressed));
+    const stride = header.width * channels;
+    const rgba = Buffer.alloc(header.width * header.height * 4);
+    let previous = Buffer.alloc(stride);
+
+    for (let y = 0; y < header.height; ++y) {
+        const filter = raw[y * (stride + 1)];
+        const line = Buffer.from(raw.subarray(y * (stride + 1) + 1, (y + 1) * (stride + 1)));
+
+        for (let x = 0; x < stride; ++x) {
+            const a = x >= channels ? line[x - channels] : 0;
+            const b = previous[x];
+            const c = x >= channels ? previous[x - channels] : 0;
+            let predictor = 0;
+            if (filter === 1) {
+                predictor = a;
+            } else if (filter === 2) {
+                predictor = b;
+            } else if (filter === 3) {
+                predictor = (a + b) >> 1;
+            } else if (filter === 4) {
+                const p = a + b - c;
+                const pa = Math.abs(p - a), pb = Math.abs(p - b), pc = Math.abs(p - c);
+                predictor = (pa <= pb && pa <= pc) ? a : (pb <= pc ? b : c);
+            }
+            line[x] = (line[x] + predictor) & 0xFF;
+        }
+
+        for (let x = 0; x < header.width; ++x) {
+            const pixel = rgba.subarray((y * header.width + x) * 4);
+            if (channels === 1) {
+                const idx = line[x];
+                pixel[0] = palette[idx * 3];
+                pixel[1] = palette[idx * 3 + 1];
+                pixel[2] = palette[idx * 3 + 2];
+                pixel[3] = transparency && idx < transparency.length ? transparency[idx] : 0xFF;
+            } else {
+                pixel[0] = line[x * channels];
+                pixel[1] = line[x * channels + 1];
+                pixel[2] = line[x * channels + 2];
+                pixel[3] = channels === 4 ? line[x * channels + 3] : 0xFF;
+            }
+        }
+        previous = line;
+    }
+
+    return { width: header.width, height: header.height, rgba };
+}
+
+function premultiply(rgba, offset) {
+    const alpha = rgba[offset + 3];
+    const channel = (value) => Math.floor((value * alpha + 127) / 255);
+    return ((alpha << 24) | (channel(rgba[offset]) << 16) |
+            (channel(rgba[offset + 1]) << 8) | channel(rgba[offset + 2])) >>> 0;
+}
+
+function formatArray(values, format, perLine) {
+    const lines = [];
+    for (let idx = 0; idx < values.length; idx += perLine) {
+        lines.push('    ' + values.slice(idx, idx + perLine).map(format).join(', ') + ',');
+    }
+    return lines.join('\n');
+}
+
+function embedVariant(variant) {
+    const image = decodePNG(fs.readFileSync(path.join(__dirname, variant.file)));
+    if (image.width !== image.height) {
+        throw new Error(variant.file + ' is not square');
+    }
+
+    const palette = [];
+    const paletteIndex = new Map();
+    const runs = [];
+    const indices = [];
+
+    for (let y = 0; y < image.height; ++y) {
+        let x = 0;
+        while (x < image.width) {
+            if (image.rgba[(y * image.width + x) * 4 + 3] === 0) {
+                ++x;
+                continue;
+            }
+            const begin = x;
+            for (; x < image.width && image.rgba[(y * image.width + x) * 4 + 3] !== 0; ++x) {
+                const value = premultiply(image.rgba, (y * image.width + x) * 4);
+                if (!paletteIndex.has(value)) {
+                    paletteIndex.set(value, palette.length);
+                    palette.push(value);
+                }
+                indices.push(paletteIndex.get(value));
+            }
+            runs.push(y, begin, x - begin);
+        }
+    }
+
+    if (palette.length > 256) {
+        throw new Error(variant.file + ' has more than 256 premultiplied colours');
+    }
+
+    const hex = (value) => '0x' + value.toString(16).toUpperCase().padStart(8, '0');
+    const code = [
+        `//! ${variant.file}, ${image.width}x${image.height}, ` +
+            `${indices.length} non transparent pixels`,
+        `static const uint32_t ${variant.name}_PALETTE[] =`,
+        '{',
+        formatArray(palette, hex, 6),
+        '};',
+        '',
+        `static const uint16_t ${variant.name}_RUNS[] =`,
+        '{',
+        formatArray(runs, String, 12),
+        '};',
+        '',
+        `static const uint8_t ${variant.name}_INDICES[] =`,
+        '{',
+        formatArray(indices, String, 20),
+        '};'
+    ].join('\n');
+
+    const entry = `    { "${variant.file}", ${image.width}, ${variant.scale}, ` +
+        `${variant.shadow}, ${variant.name}_PALETTE, ${variant.name}_RUNS, ` +
+        `${runs.length / 3}, ${variant.name}_INDICES },`;
+
+    return { code, entry };
+}
+
+const embedded = VARIANTS.map(embedVariant);
+
+fs.writeFileSync(OUTPUT, [
+    '// Generated by res/embed-masks.js from the PNG files in res/, do not edit.',
+    '',
+    '#include "CircleMask.h"',
+    '',
+    '',
+    embedded.map((variant) => variant.code).join('\n\n\n'),
+    '',
+    '',
+    'const struct EmbeddedMask EMBEDDED_MASKS[] =',
+    '{',
+    embedded.map((variant) => variant.entry).join('\n'),
+    '};',
+    '',
+    'const int EMBEDDED_MASK_COUNT = sizeof(EMBEDDED_MASKS)/sizeof(EMBEDDED_MASKS[0]);',
+    ''
+].join('\n'));
+
+console.log('wrote ' + path.relative(process.cwd(), OUTPUT));
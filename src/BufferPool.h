@@ -0,0 +1,183 @@
+#pragma once
+
+#include <mutex>
+#include <memory>
+#include <atomic>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+
+
+//! Byte buffers passed by reference from the capture thread to the
+//! consumers, JS included, and recycled once the last of them let go: a
+//! frame is written once, by PickerPipeline::Snapshot(), and never copied
+//! on its way out. Any thread may release a buffer; every buffer out of
+//! the pool keeps the pool alive.
+class BufferPool : public std::enable_shared_from_this<BufferPool>
+{
+public:
+    //! free buffers kept for reuse, the others are deleted
+    static constexpr size_t MAX_FREE_COUNT = 8;
+public:
+    class Buffer
+    {
+        friend class BufferPool;
+    private:
+        Buffer(size_t capacity)
+        :data_(new uint8_t[capacity]), capacity_(capacity)
+        {
+        }
+        ~Buffer()
+        {
+            delete[] data_;
+        }
+    private:
+        uint8_t* const data_;
+        const size_t capacity_;
+        size_t size_ = 0;
+        std::atomic<uint32_t> references_{0};
+        //! while out of the pool
+        std::shared_ptr<class BufferPool> pool_;
+    public:
+        uint8_t* Data() const { return data_; }
+        size_t Size() const { return size_; }
+        //! someone besides the caller holds it, it must not be written
+        bool Shared() const { return references_.load(std::memory_order_acquire) > 1; }
+        void Retain()
+        {
+            references_.fetch_add(1, std::memory_order_relaxed);
+        }
+        //! the last release returns it to the pool
+        void Release()
+        {
+            if( references_.fetch_sub(1, std::memory_order_acq_rel) == 1 )
+            {
+                auto pool = std::move(pool_);
+                pool->recycle(this);
+            }
+        }
+    };
+public:
+    static std::shared_ptr<class BufferPool> Create()
+    {
+        return std::shared_ptr<class BufferPool>(new BufferPool());
+    }
+    ~BufferPool()
+    {
+        for(auto buffer : free_buffers_)
+        {
+            delete buffer;
+        }
+    }
+private:
+    BufferPool() = default;
+private:
+    std::mutex mutex_;
+    std::vector<class Buffer*> free_buffers_;
+    uint64_t allocated_count_ = 0;
+    uint64_t reused_count_ = 0;
+private:
+    void recycle(class Buffer* buffer)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if( free_buffers_.size() < MAX_FREE_COUNT )
+        {
+            free_buffers_.push_back(buffer);
+        }
+        else
+        {
+            delete buffer;
+        }
+    }
+public:
+    //! a buffer of size bytes, referenced once by the caller
+    class Buffer* Acquire(size_t size)
+    {
+        class Buffer* buffer = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for(size_t idx = 0; idx < free_buffers_.size(); ++idx)
+            {
+                if( free_buffers_[idx]->capacity_ >= size )
+                {
+                    buffer = free_buffers_[idx];
+                    free_buffers_[idx] = free_buffers_.back();
+                    free_buffers_.pop_back();
+                    reused_count_ += 1;
+                    break;
+                }
+            }
+            if( buffer == nullptr )
+            {
+                allocated_count_ += 1;
+            }
+        }
+        if( buffer == nullptr )
+        {
+            buffer = new Buffer(size);
+        }
+        buffer->size_ = size;
+        buffer->references_.store(1, std::memory_order_relaxed);
+        buffer->pool_ = shared_from_this();
+        return buffer;
+    }
+public:
+    uint64_t AllocatedCount()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return allocated_count_;
+    }
+    uint64_t ReusedCount()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return reused_count_;
+    }
+};
+
+
+//! One reference to a pool buffer, copies retain it, the last one gone
+//! returns it
+class SharedBuffer
+{
+public:
+    SharedBuffer() = default;
+    //! takes over the reference of buffer
+    explicit SharedBuffer(class BufferPool::Buffer* buffer)
+    :buffer_(buffer)
+    {
+    }
+    SharedBuffer(const SharedBuffer& other)
+    :buffer_(other.buffer_)
+    {
+        if( buffer_ != nullptr ) { buffer_->Retain(); }
+    }
+    SharedBuffer(SharedBuffer&& other)
+    :buffer_(other.Detach())
+    {
+    }
+    SharedBuffer& operator=(SharedBuffer other)
+    {
+        std::swap(buffer_, other.buffer_);
+        return *this;
+    }
+    ~SharedBuffer()
+    {
+        if( buffer_ != nullptr ) { buffer_->Release(); }
+    }
+private:
+    class BufferPool::Buffer* buffer_ = nullptr;
+public:
+    //! hands the reference over to the caller, Release() is theirs
+    class BufferPool::Buffer* Detach()
+    {
+        auto buffer = buffer_;
+        buffer_ = nullptr;
+        return buffer;
+    }
+public:
+    bool Empty() const { return buffer_ == nullptr; }
+    bool Shared() const { return buffer_ != nullptr && buffer_->Shared(); }
+    uint8_t* Data() const { return buffer_ == nullptr ? nullptr : buffer_->Data(); }
+    size_t Size() const { return buffer_ == nullptr ? 0 : buffer_->Size(); }
+};
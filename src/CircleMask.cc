@@ -0,0 +1,439 @@
+#include "CircleMask.h"
+
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+#include <algorithm>
+
+#include "simd.h"
+
+
+//! SSE2 is the x86-64 baseline, no dispatch needed
+#if defined(__SSE2__) || defined(_M_X64)
+  #define MASK_SSE2 1
+#endif
+
+
+//! src + dst*(255 - src alpha)/255 per channel, rounded, two channels
+//! per multiply; premultiplied inputs never carry into the next channel
+static inline uint32_t
+CompositePixel(uint32_t dst, uint32_t src)
+{
+    const uint32_t inverse_alpha = 0xFF - (src >> 24);
+    auto divide_255 = [](uint32_t values)
+    {
+        values += 0x00800080;
+        return ((values + ((values >> 8) & 0x00FF00FF)) >> 8) & 0x00FF00FF;
+    };
+    const uint32_t blue_red = divide_255((dst & 0x00FF00FF)*inverse_alpha);
+    const uint32_t green_alpha = divide_255(((dst >> 8) & 0x00FF00FF)*inverse_alpha);
+    return src + (blue_red | (green_alpha << 8));
+}
+
+
+void
+CircleMask::CompositeSpan
+(
+    uint32_t* const dst, const uint32_t* const src, int count
+)
+{
+    int idx = 0;
+#ifdef MASK_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i full = _mm_set1_epi16(0xFF);
+    const __m128i half = _mm_set1_epi16(0x80);
+    for(; idx + 4 <= count; idx += 4)
+    {
+        const __m128i source = _mm_loadu_si128((const __m128i*)(src + idx));
+        const __m128i target = _mm_loadu_si128((const __m128i*)(dst + idx));
+
+        //! alpha in both 16 bits halves of its pixel, then one pixel per
+        //! 64 bits for the low and the high pair
+        __m128i alpha = _mm_srli_epi32(source, 24);
+        alpha = _mm_or_si128(alpha, _mm_slli_epi32(alpha, 16));
+        const __m128i inverse_low  = _mm_sub_epi16(full, _mm_unpacklo_epi32(alpha, alpha));
+        const __m128i inverse_high = _mm_sub_epi16(full, _mm_unpackhi_epi32(alpha, alpha));
+
+        __m128i low  = _mm_mullo_epi16(_mm_unpacklo_epi8(target, zero), inverse_low);
+        __m128i high = _mm_mullo_epi16(_mm_unpackhi_epi8(target, zero), inverse_high);
+        low  = _mm_add_epi16(low, half);
+        high = _mm_add_epi16(high, half);
+        low  = _mm_srli_epi16(_mm_add_epi16(low, _mm_srli_epi16(low, 8)), 8);
+        high = _mm_srli_epi16(_mm_add_epi16(high, _mm_srli_epi16(high, 8)), 8);
+
+        const __m128i result = _mm_add_epi8(source, _mm_packus_epi16(low, high));
+        _mm_storeu_si128((__m128i*)(dst + idx), result);
+    }
+#endif
+    for(; idx < count; ++idx)
+    {
+        dst[idx] = CompositePixel(dst[idx], src[idx]);
+    }
+}
+
+
+CircleMask::CircleMask(int scale, int size, bool shadow)
+{
+    fprintf(stderr, "%s\n", __PRETTY_FUNCTION__);
+
+    size_ = size;
+
+    //! the variant drawn for this scale, else the smallest one drawn for a
+    //! multiple of it; a window of another layout gets the smallest one at
+    //! least its size, else the largest one, resampled
+    const bool default_layout = size_ == UI_WINDOW_SIZE*scale;
+    const struct EmbeddedMask* variant = nullptr;
+    for(int idx = 0; idx < EMBEDDED_MASK_COUNT; ++idx)
+    {
+        const auto& candidate = EMBEDDED_MASKS[idx];
+        if( candidate.shadow != shadow || scale <= 0 || size_ <= 0 )
+        {
+            continue;
+        }
+        if( default_layout )
+        {
+            if( candidate.scale % scale != 0 )
+            {
+                continue;
+            }
+            if( variant == nullptr || candidate.scale < variant->scale )
+            {
+                variant = &candidate;
+            }
+        }
+        else if( variant == nullptr || \
+                 (variant->size < size_ && candidate.size > variant->size) || \
+                 (candidate.size >= size_ && candidate.size < variant->size) )
+        {
+            variant = &candidate;
+        }
+    }
+    if( variant == nullptr )
+    {
+        fprintf(stderr, "CircleMask Constructor Error 0 scale %d size %d\n", scale, size);
+        throw std::runtime_error("CircleMask Constructor Error 0");
+    }
+    variant_name_ = variant->name;
+
+    if( default_layout == false )
+    {
+        resampleRuns(*variant);
+        return;
+    }
+
+    //! centred in the window, a variant a few pixels off its size loses
+    //! or gains an even border
+    const int factor = variant->scale/scale;
+    if( factor == 1 )
+    {
+        placeRuns(*variant, (size_ - variant->size)/2);
+    }
+    else
+    {
+        filterRuns(*variant, factor);
+    }
+}
+
+
+void
+CircleMask::placeRuns
+(
+    const struct EmbeddedMask& variant, int offset
+)
+{
+    auto clip = [&](const uint16_t* run, int* const begin, int* const end)
+    {
+        const int y = run[0] + offset;
+        *begin = std::max(0, run[1] + offset);
+        *end = std::min(size_, run[1] + run[2] + offset);
+        return y >= 0 && y < size_ && *begin < *end;
+    };
+
+    int pixel_count = 0;
+    for(int idx = 0; idx < variant.run_count; ++idx)
+    {
+        int begin = 0, end = 0;
+        if( clip(variant.runs + idx*3, &begin, &end) )
+        {
+            run_count_ += 1;
+            pixel_count += end - begin;
+        }
+    }
+    runs_ = new struct Run[std::max(1, run_count_)];
+    pixels_ = new uint32_t[std::max(1, pixel_count)];
+
+    const uint8_t* indices = variant.indices;
+    uint32_t* pixels = pixels_;
+    struct Run* run = runs_;
+    for(int idx = 0; idx < variant.run_count; ++idx)
+    {
+        const uint16_t* embedded_run = variant.runs + idx*3;
+        int begin = 0, end = 0;
+        if( clip(embedded_run, &begin, &end) )
+        {
+            const uint8_t* run_indices = indices + (begin - embedded_run[1] - offset);
+            for(int x = begin; x < end; ++x)
+            {
+                pixels[x - begin] = variant.palette[run_indices[x - begin]];
+            }
+            run->y = embedded_run[0] + offset;
+            run->x = begin;
+            run->length = end - begin;
+            run->pixels = pixels;
+            pixels += run->length;
+            ++run;
+        }
+        indices += embedded_run[2];
+    }
+}
+
+
+uint32_t*
+CircleMask::expandVariant
+(
+    const struct EmbeddedMask& variant
+)
+{
+    const int variant_size = variant.size;
+    auto expanded = new uint32_t[variant_size*variant_size]();
+    const uint8_t* indices = variant.indices;
+    for(int idx = 0; idx < variant.run_count; ++idx)
+    {
+        const uint16_t* run = variant.runs + idx*3;
+        uint32_t* row = expanded + run[0]*variant_size + run[1];
+        for(int x = 0; x < run[2]; ++x)
+        {
+            row[x] = variant.palette[*indices++];
+        }
+    }
+    return expanded;
+}
+
+
+void
+CircleMask::filterRuns
+(
+    const struct EmbeddedMask& variant, int factor
+)
+{
+    //! expand the runs, then box filter by the scale factor
+    const int variant_size = variant.size;
+    auto expanded = expandVariant(variant);
+
+    const int filtered_size = variant_size/factor;
+    auto filtered = new uint32_t[filtered_size*filtered_size];
+    const uint32_t area = uint32_t(factor*factor);
+    for(int y = 0; y < filtered_size; ++y)
+    {
+        for(int x = 0; x < filtered_size; ++x)
+        {
+            uint32_t sums[4] = {0, 0, 0, 0};
+            for(int dy = 0; dy < factor; ++dy)
+            {
+                for(int dx = 0; dx < factor; ++dx)
+                {
+                    const uint32_t pixel = expanded[ \
+                        (y*factor + dy)*variant_size + x*factor + dx];
+                    for(int channel = 0; channel < 4; ++channel)
+                    {
+                        sums[channel] += (pixel >> (channel*8)) & 0xFF;
+                    }
+                }
+            }
+            uint32_t pixel = 0;
+            for(int channel = 0; channel < 4; ++channel)
+            {
+                pixel |= ((sums[channel] + area/2)/area) << (channel*8);
+            }
+            filtered[y*filtered_size + x] = pixel;
+        }
+    }
+    delete[] expanded;
+
+    extractRuns(filtered, filtered_size, (size_ - filtered_size)/2);
+    delete[] filtered;
+}
+
+
+void
+CircleMask::resampleRuns
+(
+    const struct EmbeddedMask& variant
+)
+{
+    //! area weighted, one axis at a time: target pixel t covers the
+    //! variant pixels [t*ratio, (t + 1)*ratio)
+    const int variant_size = variant.size;
+    auto expanded = expandVariant(variant);
+
+    const double ratio = double(variant_size)/size_;
+    const int max_taps = int(std::ceil(ratio)) + 1;
+    auto first_taps = new int[size_];
+    auto weights = new float[size_*max_taps]();
+    for(int target = 0; target < size_; ++target)
+    {
+        const double begin = target*ratio;
+        const double end = std::min(double(variant_size), (target + 1)*ratio);
+        first_taps[target] = std::min(int(begin), variant_size - 1);
+        for(int tap = 0; tap < max_taps; ++tap)
+        {
+            const int source = first_taps[target] + tap;
+            const double overlap = std::min(end, source + 1.0) - std::max(begin, double(source));
+            weights[target*max_taps + tap] = overlap > 0 ? float(overlap/ratio) : 0.0f;
+        }
+    }
+    auto weighted_sum = [&](int target, auto&& channels_of, float* const sums)
+    {
+        sums[0] = sums[1] = sums[2] = sums[3] = 0;
+        for(int tap = 0; tap < max_taps; ++tap)
+        {
+            const float weight = weights[target*max_taps + tap];
+            const int source = first_taps[target] + tap;
+            if( weight == 0 || source >= variant_size )
+            {
+                continue;
+            }
+            const float* channels = channels_of(source);
+            for(int channel = 0; channel < 4; ++channel)
+            {
+                sums[channel] += weight*channels[channel];
+            }
+        }
+    };
+
+    //! variant_size rows of size_ pixels, 4 channels each
+    auto rows = new float[size_t(variant_size)*size_*4];
+    float source_channels[4];
+    for(int y = 0; y < variant_size; ++y)
+    {
+        const uint32_t* row = expanded + y*variant_size;
+        for(int x = 0; x < size_; ++x)
+        {
+            weighted_sum(x, [&](int source) -> const float*
+            {
+                for(int channel = 0; channel < 4; ++channel)
+                {
+                    source_channels[channel] = float((row[source] >> (channel*8)) & 0xFF);
+                }
+                return source_channels;
+            }, rows + (size_t(y)*size_ + x)*4);
+        }
+    }
+    delete[] expanded;
+
+    auto resampled = new uint32_t[size_t(size_)*size_];
+    for(int y = 0; y < size_; ++y)
+    {
+        for(int x = 0; x < size_; ++x)
+        {
+            float sums[4];
+            weighted_sum(y, [&](int source) -> const float*
+            {
+                return rows + (size_t(source)*size_ + x)*4;
+            }, sums);
+
+            //! premultiplied: no channel above alpha after rounding
+            const uint32_t alpha = uint32_t(std::min(255.0f, sums[3] + 0.5f));
+            uint32_t pixel = alpha << 24;
+            for(int channel = 0; channel < 3; ++channel)
+            {
+                pixel |= std::min(alpha, uint32_t(sums[channel] + 0.5f)) << (channel*8);
+            }
+            resampled[size_t(y)*size_ + x] = alpha == 0 ? 0 : pixel;
+        }
+    }
+    delete[] rows;
+    delete[] weights;
+    delete[] first_taps;
+
+    extractRuns(resampled, size_, 0);
+    delete[] resampled;
+}
+
+
+void
+CircleMask::extractRuns
+(
+    const uint32_t* const image, int image_size, int offset
+)
+{
+    auto window_pixel = [&](int x, int y) -> uint32_t
+    {
+        const int source_x = x - offset;
+        const int source_y = y - offset;
+        if( source_x < 0 || source_y < 0 || \
+            source_x >= image_size || source_y >= image_size )
+        {
+            return 0;
+        }
+        return image[source_y*image_size + source_x];
+    };
+
+    //! two passes: count, then fill
+    for(int pass = 0; pass < 2; ++pass)
+    {
+        int run_count = 0;
+        int pixel_idx = 0;
+        for(int y = 0; y < size_; ++y)
+        {
+            int x = 0;
+            while( x < size_ )
+            {
+                if( (window_pixel(x, y) >> 24) == 0 )
+                {
+                    ++x;
+                    continue;
+                }
+
+                const int begin = x;
+                for(; x < size_ && (window_pixel(x, y) >> 24) != 0; ++x)
+                {
+                    if( pass == 1 )
+                    {
+                        pixels_[pixel_idx] = window_pixel(x, y);
+                    }
+                    ++pixel_idx;
+                }
+                if( pass == 1 )
+                {
+                    auto& run = runs_[run_count];
+                    run.y = y;
+                    run.x = begin;
+                    run.length = x - begin;
+                    run.pixels = pixels_ + pixel_idx - run.length;
+                }
+                ++run_count;
+            }
+        }
+
+        if( pass == 0 )
+        {
+            run_count_ = run_count;
+            runs_ = new struct Run[std::max(1, run_count)];
+            pixels_ = new uint32_t[std::max(1, pixel_idx)];
+        }
+    }
+}
+
+
+CircleMask::~CircleMask()
+{
+    fprintf(stderr, "%s\n", __PRETTY_FUNCTION__);
+
+    delete[] runs_;
+    delete[] pixels_;
+}
+
+
+void
+CircleMask::Composite
+(
+    uint32_t* const pixels, int stride
+) const
+{
+    for(int idx = 0; idx < run_count_; ++idx)
+    {
+        const auto& run = runs_[idx];
+        CompositeSpan(pixels + run.y*stride + run.x, run.pixels, run.length);
+    }
+}
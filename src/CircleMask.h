@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+
+#include "parameters.h"
+
+
+//! One of res/Mask@*.png as res/embed-masks.js embeds it: the non
+//! transparent runs of every row, as palette indices
+struct EmbeddedMask
+{
+    const char* name;
+    //! width and height, the masks are square
+    int size;
+    int scale;
+    //! drawn for a window with a shadow margin (macOS)
+    bool shadow;
+    //! premultiplied 0xAARRGGBB
+    const uint32_t* palette;
+    //! y, x, length of each run, row major
+    const uint16_t* runs;
+    int run_count;
+    //! one per pixel of the runs, in order
+    const uint8_t* indices;
+};
+
+//! CircleMaskData.cc, generated
+extern const struct EmbeddedMask EMBEDDED_MASKS[];
+extern const int EMBEDDED_MASK_COUNT;
+
+
+//! The ring drawn over the magnifier, for one display scale. The variant
+//! of that scale (and shadow margin) is expanded once into premultiplied
+//! runs placed in the size*size window; a scale without its own variant is
+//! box filtered down from a larger one, a window of another grid or zoom
+//! than the default UI_WINDOW_SIZE*scale is resampled from the closest
+//! variant. Compositing only walks the runs, the transparent inside of the
+//! ring costs nothing.
+class CircleMask
+{
+public:
+    CircleMask(int scale, int size, bool shadow = UI_WINDOW_MARGIN > 0);
+    ~CircleMask();
+public:
+    struct Run
+    {
+        int y = 0;
+        int x = 0;
+        int length = 0;
+        //! premultiplied 0xAARRGGBB, length of them
+        const uint32_t* pixels = nullptr;
+    };
+private:
+    int size_ = 0;
+    const char* variant_name_ = nullptr;
+    uint32_t* pixels_ = nullptr;
+    struct Run* runs_ = nullptr;
+    int run_count_ = 0;
+private:
+    //! the runs of a variant of this scale, moved by offset and clipped
+    void placeRuns(const struct EmbeddedMask& variant, int offset);
+    //! a variant of factor times this scale, box filtered down
+    void filterRuns(const struct EmbeddedMask& variant, int factor);
+    //! a variant of any size, area weighted to size_
+    void resampleRuns(const struct EmbeddedMask& variant);
+    //! the runs of a variant as a variant.size*variant.size image, new[]
+    static uint32_t* expandVariant(const struct EmbeddedMask& variant);
+    //! the non transparent runs of an image_size*image_size image moved by
+    //! offset, clipped to the window
+    void extractRuns(const uint32_t* const image, int image_size, int offset);
+public:
+    //! dst = src + dst*(1 - src alpha) on premultiplied pixels
+    static void CompositeSpan(uint32_t* const dst, const uint32_t* const src, int count);
+public:
+    //! every run over the top left Size()*Size() of the surface rows
+    void Composite(uint32_t* const pixels, int stride) const;
+public:
+    int Size() const { return size_; }
+    const char* VariantName() const { return variant_name_; }
+    const struct Run* Runs() const { return runs_; }
+    int RunCount() const { return run_count_; }
+};
@@ -0,0 +1,2587 @@
+// Generated by res/embed-masks.js from the PNG files in res/, do not edit.
+
+#include "CircleMask.h"
+
+
+//! Mask@1.png, 171x171, 3236 non transparent pixels
+static const uint32_t MASK_1_PALETTE[] =
+{
+    0x06040404, 0x24151515, 0x47292929, 0x653B3B3B, 0x834D4D4D, 0x9E5C5C5C,
+    0xB0676767, 0xC3727272, 0xD77E7E7E, 0xE5868686, 0xEF8C8C8C, 0xFB939393,
+    0xFF969696, 0x150C0C0C, 0x4F2E2E2E, 0x7B484848, 0xA9636363, 0xFC959595,
+    0xFFA4A4A4, 0xFFB0B0B0, 0xFFBCBCBC, 0xFFCACACA, 0xFFD5D5D5, 0xFFDEDEDE,
+    0xFFE7E7E7, 0xFFEDEDED, 0xFFF2F2F2, 0xFFF6F6F6, 0xFFFCFCFC, 0xFFFFFFFF,
+    0x1F121212, 0x62393939, 0xA05D5D5D, 0xFF9A9A9A, 0xFFB2B2B2, 0xFFC7C7C7,
+    0xFFD9D9D9, 0xFFEBEBEB, 0x8F545454, 0xFE9E9E9E, 0x9F5D5D5D, 0xFFADADAD,
+    0xFFCECECE, 0xFFD8D8D8, 0xFFBEBEBE, 0xFFB5B5B5, 0xFF9C9C9C, 0x2B191919,
+    0x93565656, 0xEC8B8B8B, 0xFFD1D1D1, 0xFFD2D2D2, 0xFFBFBFBF, 0xFD9C9C9C,
+    0xF3A0A0A0, 0xDF9B9B9B, 0xC48D8D8D, 0xA3787878, 0x88666666, 0x6E545454,
+    0x513F3F3F, 0x31262626, 0x20191919, 0x0B090909, 0x0B060606, 0xC9757575,
+    0xFFA1A1A1, 0xFFE3E3E3, 0xF89F9F9F, 0xD7979797, 0xAA7D7D7D, 0xFFB4B4B4,
+    0xFFE1E1E1, 0xFFF5F5F5, 0x7B5D5D5D, 0x1C161616, 0x97585858, 0xF6949494,
+    0xE29B9B9B, 0x281F1F1F, 0x956F6F6F, 0x190F0F0F, 0xF9979797, 0xFFB7B7B7,
+    0xE69D9D9D, 0x8D6A6A6A, 0x14101010, 0x1A0F0F0F, 0x8A515151, 0xFFF8F8F8,
+    0xFFCCCCCC, 0xAD7F7F7F, 0x231B1B1B, 0x02010101, 0xFFF4F4F4, 0xFFC2C2C2,
+    0x644C4C4C, 0xFFF0F0F0, 0x341E1E1E, 0xCE787878, 0xCD929292, 0x372B2B2B,
+    0xC8909090, 0x43272727, 0xDD818181, 0xFFFAFAFA, 0xFFDADADA, 0x42333333,
+    0xCF797979, 0x74585858, 0x5A353535, 0xBE898989, 0xFFFBFBFB, 0xFC9F9F9F,
+    0x3D242424, 0xFFA9A9A9, 0xB4838383, 0xFEA0A0A0, 0xF7A1A1A1, 0xF09F9F9F,
+    0xEB9F9F9F, 0x120E0E0E, 0x4B3A3A3A, 0x87666666, 0xB76B6B6B, 0x30252525,
+};
+
+static const uint16_t MASK_1_RUNS[] =
+{
+    0, 72, 27, 1, 67, 37, 2, 63, 45, 3, 59, 53,
+    4, 56, 59, 5, 54, 31, 5, 86, 31, 6, 51, 22,
+    6, 98, 22, 7, 49, 19, 7, 103, 19, 8, 47, 17,
+    8, 107, 17, 9, 45, 16, 9, 110, 16, 10, 43, 15,
+    10, 113, 15, 11, 41, 14, 11, 116, 14, 12, 40, 13,
+    12, 118, 13, 13, 38, 13, 13, 120, 13, 14, 37, 12,
+    14, 122, 12, 15, 35, 12, 15, 124, 12, 16, 34, 11,
+    16, 126, 11, 17, 33, 11, 17, 127, 11, 18, 31, 11,
+    18, 129, 11, 19, 30, 11, 19, 130, 11, 20, 29, 10,
+    20, 132, 10, 21, 28, 10, 21, 133, 10, 22, 27, 10,
+    22, 134, 10, 23, 26, 9, 23, 136, 9, 24, 25, 9,
+    24, 137, 9, 25, 24, 9, 25, 138, 9, 26, 23, 9,
+    26, 139, 9, 27, 22, 9, 27, 140, 9, 28, 21, 9,
+    28, 141, 9, 29, 20, 9, 29, 142, 9, 30, 19, 9,
+    30, 143, 9, 31, 18, 9, 31, 144, 9, 32, 18, 8,
+    32, 145, 8, 33, 17, 8, 33, 146, 8, 34, 16, 8,
+    34, 147, 8, 35, 15, 8, 35, 148, 8, 36, 15, 8,
+    36, 148, 8, 37, 14, 8, 37, 149, 8, 38, 13, 8,
+    38, 150, 8, 39, 13, 7, 39, 151, 7, 40, 12, 8,
+    40, 151, 8, 41, 11, 8, 41, 152, 8, 42, 11, 7,
+    42, 153, 7, 43, 10, 8, 43, 153, 8, 44, 10, 7,
+    44, 154, 7, 45, 9, 7, 45, 155, 7, 46, 9, 7,
+    46, 155, 7, 47, 8, 7, 47, 156, 7, 48, 8, 7,
+    48, 156, 7, 49, 7, 7, 49, 157, 7, 50, 7, 7,
+    50, 157, 7, 51, 6, 7, 51, 158, 7, 52, 6, 7,
+    52, 158, 7, 53, 6, 6, 53, 159, 6, 54, 5, 7,
+    54, 159, 7, 55, 5, 6, 55, 160, 6, 56, 4, 7,
+    56, 160, 7, 57, 4, 7, 57, 160, 7, 58, 4, 6,
+    58, 161, 6, 59, 3, 7, 59, 161, 7, 60, 3, 7,
+    60, 161, 7, 61, 3, 6, 61, 162, 6, 62, 3, 6,
+    62, 162, 6, 63, 2, 7, 63, 162, 7, 64, 2, 6,
+    64, 163, 6, 65, 2, 6, 65, 163, 6, 66, 2, 6,
+    66, 163, 6, 67, 1, 7, 67, 163, 7, 68, 1, 6,
+    68, 164, 6, 69, 1, 6, 69, 164, 6, 70, 1, 6,
+    70, 164, 6, 71, 1, 6, 71, 164, 6, 72, 0, 7,
+    72, 164, 7, 73, 0, 6, 73, 165, 6, 74, 0, 6,
+    74, 165, 6, 75, 0, 6, 75, 165, 6, 76, 0, 6,
+    76, 165, 6, 77, 0, 6, 77, 165, 6, 78, 0, 6,
+    78, 165, 6, 79, 0, 6, 79, 165, 6, 80, 0, 6,
+    80, 165, 6, 81, 0, 6, 81, 165, 6, 82, 0, 6,
+    82, 165, 6, 83, 0, 6, 83, 165, 6, 84, 0, 6,
+    84, 165, 6, 85, 0, 5, 85, 166, 5, 86, 0, 6,
+    86, 165, 6, 87, 0, 6, 87, 165, 6, 88, 0, 6,
+    88, 165, 6, 89, 0, 6, 89, 165, 6, 90, 0, 6,
+    90, 165, 6, 91, 0, 6, 91, 165, 6, 92, 0, 6,
+    92, 165, 6, 93, 0, 6, 93, 165, 6, 94, 0, 6,
+    94, 165, 6, 95, 0, 6, 95, 165, 6, 96, 0, 6,
+    96, 165, 6, 97, 0, 6, 97, 165, 6, 98, 0, 7,
+    98, 164, 7, 99, 1, 6, 99, 164, 6, 100, 1, 6,
+    100, 164, 6, 101, 1, 6, 101, 164, 6, 102, 1, 6,
+    102, 164, 6, 103, 1, 7, 103, 163, 7, 104, 2, 6,
+    104, 163, 6, 105, 2, 6, 105, 163, 6, 106, 2, 6,
+    106, 163, 6, 107, 2, 7, 107, 162, 7, 108, 3, 6,
+    108, 162, 6, 109, 3, 6, 109, 162, 6, 110, 3, 7,
+    110, 161, 7, 111, 3, 7, 111, 161, 7, 112, 4, 6,
+    112, 161, 6, 113, 4, 7, 113, 160, 7, 114, 4, 7,
+    114, 160, 7, 115, 5, 6, 115, 160, 6, 116, 5, 7,
+    116, 159, 7, 117, 6, 6, 117, 159, 6, 118, 6, 7,
+    118, 158, 7, 119, 6, 7, 119, 158, 7, 120, 7, 7,
+    120, 157, 7, 121, 7, 7, 121, 157, 7, 122, 8, 7,
+    122, 156, 7, 123, 8, 7, 123, 156, 7, 124, 9, 7,
+    124, 155, 7, 125, 9, 7, 125, 155, 7, 126, 10, 7,
+    126, 154, 7, 127, 10, 8, 127, 153, 8, 128, 11, 7,
+    128, 153, 7, 129, 11, 8, 129, 152, 8, 130, 12, 8,
+    130, 151, 8, 131, 13, 7, 131, 151, 7, 132, 13, 8,
+    132, 150, 8, 133, 14, 8, 133, 149, 8, 134, 15, 8,
+    134, 148, 8, 135, 15, 8, 135, 148, 8, 136, 16, 8,
+    136, 147, 8, 137, 17, 8, 137, 146, 8, 138, 18, 8,
+    138, 145, 8, 139, 18, 9, 139, 144, 9, 140, 19, 9,
+    140, 143, 9, 141, 20, 9, 141, 142, 9, 142, 21, 9,
+    142, 141, 9, 143, 22, 9, 143, 140, 9, 144, 23, 9,
+    144, 139, 9, 145, 24, 9, 145, 138, 9, 146, 25, 9,
+    146, 137, 9, 147, 26, 9, 147, 136, 9, 148, 27, 10,
+    148, 134, 10, 149, 28, 10, 149, 133, 10, 150, 29, 10,
+    150, 132, 10, 151, 30, 11, 151, 130, 11, 152, 31, 11,
+    152, 129, 11, 153, 33, 11, 153, 127, 11, 154, 34, 11,
+    154, 126, 11, 155, 35, 12, 155, 124, 12, 156, 37, 12,
+    156, 122, 12, 157, 38, 13, 157, 120, 13, 158, 40, 13,
+    158, 118, 13, 159, 41, 14, 159, 116, 14, 160, 43, 15,
+    160, 113, 15, 161, 45, 16, 161, 110, 16, 162, 47, 17,
+    162, 107, 17, 163, 49, 19, 163, 103, 19, 164, 51, 22,
+    164, 98, 22, 165, 54, 31, 165, 86, 31, 166, 56, 59,
+    167, 59, 53, 168, 63, 45, 169, 67, 37, 170, 72, 27,
+};
+
+static const uint8_t MASK_1_INDICES[] =
+{
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 10, 11, 12, 11, 10, 10, 9, 8, 7,
+    6, 5, 4, 3, 2, 1, 0, 13, 14, 15, 16, 8, 17, 18, 19, 20, 21, 22, 23, 24,
+    25, 26, 27, 27, 28, 29, 28, 27, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 8,
+    16, 15, 14, 13, 30, 31, 32, 8, 33, 34, 35, 36, 37, 28, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 28,
+    37, 36, 35, 34, 33, 8, 32, 31, 30, 0, 2, 38, 8, 39, 20, 22, 37, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 37, 22, 20, 39, 8, 38,
+    2, 0, 0, 2, 40, 10, 41, 42, 37, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 26,
+    24, 43, 21, 44, 45, 41, 18, 39, 46, 46, 12, 12, 12, 46, 46, 39, 18, 41, 45, 44,
+    21, 43, 24, 26, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 37, 42, 41, 10, 40, 2,
+    0, 47, 48, 49, 41, 50, 26, 29, 29, 29, 29, 29, 29, 29, 28, 24, 51, 52, 41, 33,
+    53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 62, 63, 63, 62, 62, 61, 60, 59, 58, 57,
+    56, 55, 54, 53, 33, 41, 52, 51, 24, 28, 29, 29, 29, 29, 29, 29, 29, 26, 50, 41,
+    49, 48, 47, 64, 3, 65, 66, 21, 26, 29, 29, 29, 29, 29, 29, 28, 67, 35, 19, 33,
+    68, 69, 70, 59, 62, 62, 59, 70, 69, 68, 33, 19, 35, 67, 28, 29, 29, 29, 29, 29,
+    29, 26, 21, 66, 65, 3, 64, 13, 4, 49, 71, 72, 28, 29, 29, 29, 29, 29, 73, 22,
+    45, 33, 54, 56, 74, 75, 75, 74, 56, 54, 33, 45, 22, 73, 29, 29, 29, 29, 29, 28,
+    72, 71, 49, 4, 13, 30, 76, 77, 52, 25, 29, 29, 29, 29, 29, 27, 22, 19, 33, 78,
+    57, 79, 79, 80, 78, 33, 19, 22, 27, 29, 29, 29, 29, 29, 25, 52, 77, 76, 30, 81,
+    48, 82, 35, 73, 29, 29, 29, 29, 29, 72, 83, 33, 84, 85, 86, 86, 85, 84, 33, 83,
+    72, 29, 29, 29, 29, 29, 73, 35, 82, 48, 87, 64, 88, 77, 35, 27, 29, 29, 29, 29,
+    89, 90, 66, 68, 91, 92, 92, 70, 68, 66, 90, 27, 29, 29, 29, 29, 27, 35, 77, 88,
+    64, 93, 31, 9, 20, 94, 29, 29, 29, 29, 26, 95, 46, 55, 96, 96, 55, 33, 95, 97,
+    29, 29, 29, 29, 94, 20, 9, 31, 93, 98, 99, 41, 37, 29, 29, 29, 29, 97, 20, 33,
+    100, 101, 61, 102, 33, 20, 97, 29, 29, 29, 29, 37, 41, 99, 98, 64, 38, 53, 43, 29,
+    29, 29, 29, 26, 52, 33, 102, 92, 92, 102, 46, 52, 26, 29, 29, 29, 29, 43, 53, 38,
+    64, 103, 104, 20, 27, 29, 29, 29, 105, 35, 33, 100, 79, 79, 100, 33, 35, 105, 29, 29,
+    29, 27, 20, 104, 103, 0, 88, 39, 72, 29, 29, 29, 29, 106, 39, 84, 107, 107, 84, 39,
+    106, 29, 29, 29, 29, 72, 39, 88, 0, 47, 108, 45, 27, 29, 29, 29, 97, 34, 68, 109,
+    59, 68, 34, 97, 29, 29, 29, 27, 83, 108, 47, 110, 77, 22, 29, 29, 29, 28, 50, 46,
+    111, 63, 63, 111, 46, 50, 28, 29, 29, 29, 22, 77, 110, 0, 38, 18, 37, 29, 29, 29,
+    26, 41, 54, 60, 60, 54, 41, 26, 29, 29, 29, 37, 18, 38, 0, 13, 7, 71, 89, 29,
+    29, 29, 106, 53, 111, 63, 63, 111, 46, 36, 29, 29, 29, 89, 71, 7, 13, 1, 104, 35,
+    29, 29, 29, 112, 20, 113, 96, 96, 113, 20, 112, 29, 29, 29, 35, 104, 1, 114, 49, 22,
+    29, 29, 29, 26, 115, 84, 75, 75, 84, 115, 97, 29, 29, 29, 22, 49, 114, 14, 82, 72,
+    29, 29, 29, 67, 39, 116, 93, 93, 116, 39, 67, 29, 29, 29, 67, 82, 14, 110, 53, 37,
+    29, 29, 29, 22, 46, 74, 74, 46, 22, 29, 29, 29, 37, 53, 31, 3, 39, 25, 29, 29,
+    29, 35, 39, 60, 60, 39, 35, 29, 29, 29, 97, 117, 3, 3, 117, 97, 29, 29, 28, 20,
+    118, 61, 61, 118, 20, 28, 29, 29, 97, 117, 3, 110, 113, 97, 29, 29, 28, 83, 119, 75,
+    75, 119, 83, 28, 29, 29, 97, 113, 110, 14, 53, 25, 29, 29, 112, 71, 120, 86, 86, 120,
+    71, 112, 29, 29, 25, 53, 14, 114, 82, 37, 29, 29, 28, 71, 84, 63, 63, 84, 71, 28,
+    29, 29, 37, 82, 114, 1, 49, 67, 29, 29, 28, 83, 120, 63, 63, 120, 83, 28, 29, 29,
+    67, 49, 1, 13, 104, 36, 29, 29, 29, 20, 119, 121, 121, 119, 20, 29, 29, 29, 43, 104,
+    13, 0, 7, 35, 29, 29, 29, 35, 118, 75, 75, 118, 35, 29, 29, 29, 35, 7, 0, 38,
+    45, 29, 29, 29, 22, 39, 101, 101, 39, 22, 29, 29, 29, 71, 38, 110, 18, 89, 29, 29,
+    67, 53, 60, 60, 53, 67, 29, 29, 89, 18, 110, 47, 77, 25, 29, 29, 26, 39, 74, 74,
+    39, 97, 29, 29, 37, 77, 47, 0, 108, 22, 29, 29, 112, 115, 111, 111, 115, 112, 29, 29,
+    22, 108, 0, 88, 45, 29, 29, 29, 20, 84, 93, 93, 84, 20, 29, 29, 29, 45, 88, 103,
+    39, 27, 29, 29, 43, 113, 75, 75, 113, 43, 29, 29, 27, 39, 103, 64, 104, 72, 29, 29,
+    97, 33, 96, 96, 33, 97, 29, 29, 72, 104, 64, 88, 20, 29, 29, 28, 41, 111, 111, 41,
+    28, 29, 29, 20, 38, 98, 53, 27, 29, 29, 50, 54, 0, 0, 54, 50, 29, 29, 27, 53,
+    98, 93, 99, 36, 29, 29, 97, 46, 122, 122, 46, 97, 29, 29, 106, 99, 93, 31, 41, 29,
+    29, 29, 34, 111, 111, 34, 29, 29, 29, 41, 3, 64, 9, 24, 29, 29, 36, 68, 63, 63,
+    68, 36, 29, 29, 24, 9, 64, 88, 20, 29, 29, 105, 66, 109, 109, 66, 105, 29, 29, 44,
+    88, 87, 77, 94, 29, 29, 21, 84, 84, 21, 29, 29, 94, 77, 87, 48, 35, 29, 29, 26,
+    46, 107, 107, 46, 26, 29, 29, 35, 48, 30, 82, 27, 29, 29, 52, 100, 100, 52, 29, 29,
+    27, 82, 30, 76, 35, 29, 29, 97, 46, 79, 79, 46, 97, 29, 29, 35, 76, 13, 77, 27,
+    29, 29, 20, 56, 56, 20, 29, 29, 27, 77, 13, 4, 44, 29, 29, 26, 33, 92, 92, 33,
+    26, 29, 29, 52, 4, 64, 49, 97, 29, 29, 95, 100, 100, 95, 29, 29, 97, 49, 64, 31,
+    45, 29, 29, 89, 33, 101, 101, 33, 89, 29, 29, 45, 3, 65, 72, 29, 29, 90, 78, 78,
+    90, 29, 29, 72, 99, 47, 66, 29, 29, 29, 66, 96, 96, 66, 29, 29, 29, 66, 98, 48,
+    21, 29, 29, 72, 68, 68, 72, 29, 29, 21, 76, 0, 49, 26, 29, 29, 83, 70, 70, 83,
+    29, 29, 26, 49, 0, 2, 41, 29, 29, 27, 33, 62, 62, 33, 27, 29, 29, 41, 2, 5,
+    50, 29, 29, 22, 78, 78, 22, 29, 29, 50, 40, 0, 10, 94, 29, 29, 19, 85, 85, 19,
+    29, 29, 94, 10, 0, 2, 41, 29, 29, 73, 33, 86, 86, 33, 73, 29, 29, 41, 2, 38,
+    90, 29, 29, 22, 78, 78, 22, 29, 29, 90, 38, 8, 37, 29, 29, 45, 80, 80, 45, 29,
+    29, 37, 8, 30, 39, 29, 29, 28, 46, 92, 92, 33, 28, 29, 29, 39, 1, 3, 20, 29,
+    29, 67, 54, 54, 67, 29, 29, 20, 3, 40, 22, 29, 29, 35, 56, 102, 35, 29, 29, 22,
+    40, 8, 97, 29, 29, 41, 74, 74, 41, 29, 29, 25, 8, 13, 46, 29, 29, 28, 33, 75,
+    62, 17, 112, 29, 29, 46, 13, 14, 34, 29, 29, 24, 118, 68, 24, 29, 29, 34, 14, 15,
+    35, 29, 29, 51, 69, 69, 51, 29, 29, 35, 15, 16, 36, 29, 29, 52, 70, 70, 52, 29,
+    29, 36, 16, 8, 37, 29, 29, 41, 59, 59, 41, 29, 29, 37, 8, 0, 17, 28, 29, 29,
+    33, 75, 62, 33, 29, 29, 28, 17, 0, 1, 18, 29, 29, 26, 53, 53, 26, 29, 29, 18,
+    47, 2, 19, 29, 29, 67, 54, 54, 67, 29, 29, 19, 2, 3, 44, 29, 29, 43, 55, 55,
+    43, 29, 29, 44, 3, 4, 21, 29, 29, 21, 56, 56, 21, 29, 29, 90, 88, 5, 22, 29,
+    29, 44, 57, 57, 44, 29, 29, 22, 40, 6, 23, 29, 29, 83, 123, 123, 83, 29, 29, 23,
+    124, 7, 67, 29, 29, 19, 96, 96, 19, 29, 29, 24, 65, 8, 25, 29, 29, 18, 122, 122,
+    18, 29, 29, 25, 8, 9, 26, 29, 29, 66, 101, 101, 66, 29, 29, 26, 9, 10, 89, 29,
+    29, 33, 75, 62, 33, 29, 29, 89, 10, 10, 89, 29, 29, 33, 75, 75, 33, 29, 29, 89,
+    10, 11, 28, 29, 29, 12, 63, 63, 12, 29, 29, 28, 11, 12, 29, 29, 29, 12, 12, 29,
+    29, 29, 12, 11, 28, 29, 29, 12, 63, 63, 12, 29, 29, 28, 11, 10, 89, 29, 29, 33,
+    75, 75, 33, 29, 29, 89, 10, 10, 89, 29, 29, 33, 75, 62, 33, 29, 29, 89, 10, 9,
+    26, 29, 29, 66, 101, 101, 66, 29, 29, 26, 9, 8, 25, 29, 29, 18, 122, 122, 18, 29,
+    29, 25, 8, 7, 67, 29, 29, 19, 96, 96, 19, 29, 29, 24, 65, 6, 23, 29, 29, 83,
+    123, 123, 83, 29, 29, 23, 124, 5, 22, 29, 29, 44, 57, 57, 44, 29, 29, 22, 40, 4,
+    90, 29, 29, 21, 56, 56, 21, 29, 29, 90, 88, 3, 44, 29, 29, 43, 55, 55, 43, 29,
+    29, 44, 3, 2, 19, 29, 29, 67, 54, 54, 67, 29, 29, 19, 2, 1, 18, 29, 29, 26,
+    53, 53, 26, 29, 29, 18, 47, 0, 17, 28, 29, 29, 33, 75, 62, 33, 29, 29, 28, 17,
+    0, 8, 37, 29, 29, 41, 59, 59, 41, 29, 29, 37, 8, 16, 36, 29, 29, 52, 70, 70,
+    52, 29, 29, 36, 16, 15, 35, 29, 29, 51, 69, 69, 51, 29, 29, 35, 15, 14, 34, 29,
+    29, 24, 118, 118, 24, 29, 29, 34, 14, 13, 46, 29, 29, 28, 33, 75, 75, 33, 28, 29,
+    29, 46, 13, 8, 97, 29, 29, 19, 74, 74, 19, 29, 29, 97, 8, 40, 22, 29, 29, 35,
+    56, 56, 35, 29, 29, 22, 40, 3, 20, 29, 29, 67, 54, 54, 67, 29, 29, 20, 3, 30,
+    39, 29, 29, 28, 33, 92, 92, 33, 28, 29, 29, 39, 1, 8, 37, 29, 29, 45, 80, 80,
+    45, 29, 29, 37, 8, 38, 90, 29, 29, 22, 78, 78, 22, 29, 29, 90, 38, 2, 41, 29,
+    29, 73, 33, 86, 86, 33, 73, 29, 29, 41, 2, 0, 10, 94, 29, 29, 19, 85, 85, 19,
+    29, 29, 94, 10, 0, 40, 50, 29, 29, 22, 78, 78, 22, 29, 29, 50, 40, 2, 41, 29,
+    29, 27, 33, 62, 62, 33, 27, 29, 29, 41, 2, 0, 49, 26, 29, 29, 83, 70, 70, 83,
+    29, 29, 26, 10, 0, 48, 21, 29, 29, 72, 68, 68, 72, 29, 29, 21, 76, 47, 66, 29,
+    29, 29, 66, 96, 96, 66, 29, 29, 29, 66, 98, 65, 72, 29, 29, 90, 78, 78, 90, 29,
+    29, 72, 99, 31, 45, 29, 29, 89, 33, 101, 101, 33, 89, 29, 29, 45, 3, 64, 49, 97,
+    29, 29, 95, 100, 100, 95, 29, 29, 97, 49, 64, 4, 52, 29, 29, 26, 33, 92, 92, 33,
+    97, 29, 29, 52, 4, 13, 77, 27, 29, 29, 20, 56, 56, 20, 29, 29, 27, 77, 13, 76,
+    35, 29, 29, 97, 46, 79, 79, 46, 97, 29, 29, 35, 76, 30, 82, 27, 29, 29, 52, 100,
+    100, 52, 29, 29, 27, 82, 30, 48, 35, 29, 29, 26, 46, 107, 107, 46, 26, 29, 29, 35,
+    48, 87, 77, 94, 29, 29, 21, 84, 84, 21, 29, 29, 94, 77, 87, 88, 44, 29, 29, 105,
+    66, 109, 109, 66, 105, 29, 29, 44, 88, 64, 9, 37, 29, 29, 36, 68, 63, 63, 68, 36,
+    29, 29, 37, 9, 64, 3, 41, 29, 29, 29, 34, 111, 111, 19, 29, 29, 29, 41, 3, 93,
+    99, 106, 29, 29, 97, 46, 122, 122, 46, 97, 29, 29, 106, 99, 93, 98, 53, 27, 29, 29,
+    50, 54, 0, 0, 54, 42, 29, 29, 27, 53, 98, 38, 20, 29, 29, 28, 41, 111, 111, 41,
+    28, 29, 29, 20, 38, 64, 104, 72, 29, 29, 97, 46, 96, 96, 33, 97, 29, 29, 72, 104,
+    64, 103, 39, 27, 29, 29, 43, 113, 75, 75, 113, 43, 29, 29, 27, 39, 103, 88, 83, 29,
+    29, 29, 20, 84, 93, 93, 84, 20, 29, 29, 29, 83, 38, 0, 108, 22, 29, 29, 112, 115,
+    111, 111, 115, 105, 29, 29, 22, 108, 0, 47, 77, 25, 29, 29, 97, 39, 74, 74, 39, 97,
+    29, 29, 37, 77, 47, 110, 18, 89, 29, 29, 67, 53, 60, 60, 53, 67, 29, 29, 89, 18,
+    110, 38, 45, 29, 29, 29, 22, 39, 101, 101, 39, 51, 29, 29, 29, 45, 38, 0, 7, 21,
+    29, 29, 29, 35, 118, 75, 75, 118, 35, 29, 29, 29, 35, 7, 0, 13, 104, 36, 29, 29,
+    29, 20, 119, 86, 86, 119, 20, 29, 29, 29, 36, 104, 13, 1, 49, 67, 29, 29, 28, 83,
+    120, 63, 63, 120, 83, 28, 29, 29, 67, 49, 1, 103, 82, 37, 29, 29, 28, 71, 84, 63,
+    63, 84, 34, 28, 29, 29, 37, 82, 103, 14, 53, 25, 29, 29, 112, 71, 120, 86, 86, 120,
+    34, 112, 29, 29, 25, 53, 14, 110, 113, 97, 29, 29, 28, 83, 119, 75, 75, 119, 83, 28,
+    29, 29, 97, 113, 110, 3, 117, 97, 29, 29, 28, 20, 118, 61, 125, 118, 20, 28, 29, 29,
+    97, 117, 3, 3, 39, 25, 29, 29, 29, 35, 39, 60, 60, 39, 35, 29, 29, 29, 97, 117,
+    3, 110, 53, 37, 29, 29, 29, 22, 46, 74, 74, 46, 22, 29, 29, 29, 37, 53, 31, 14,
+    82, 67, 29, 29, 29, 72, 39, 116, 93, 93, 116, 39, 72, 29, 29, 29, 67, 82, 14, 114,
+    49, 43, 29, 29, 29, 97, 115, 78, 75, 75, 78, 115, 97, 29, 29, 29, 43, 49, 114, 1,
+    104, 35, 29, 29, 29, 112, 20, 113, 96, 96, 113, 20, 112, 29, 29, 29, 35, 104, 1, 13,
+    7, 71, 89, 29, 29, 29, 36, 46, 111, 0, 0, 111, 46, 36, 29, 29, 29, 89, 45, 7,
+    13, 0, 38, 18, 37, 29, 29, 29, 26, 41, 54, 122, 122, 54, 41, 26, 29, 29, 29, 37,
+    18, 38, 0, 110, 77, 22, 29, 29, 29, 28, 50, 46, 111, 63, 63, 111, 46, 42, 28, 29,
+    29, 29, 22, 77, 110, 47, 108, 83, 27, 29, 29, 29, 97, 34, 68, 59, 59, 68, 34, 97,
+    29, 29, 29, 27, 83, 108, 47, 0, 88, 39, 72, 29, 29, 29, 29, 106, 66, 84, 107, 107,
+    84, 66, 106, 29, 29, 29, 29, 72, 39, 38, 0, 103, 104, 20, 27, 29, 29, 29, 112, 35,
+    33, 100, 79, 79, 100, 33, 21, 112, 29, 29, 29, 27, 20, 104, 103, 64, 38, 53, 43, 29,
+    29, 29, 29, 26, 52, 33, 102, 92, 92, 102, 33, 52, 26, 29, 29, 29, 29, 36, 53, 38,
+    64, 98, 99, 19, 37, 29, 29, 29, 29, 97, 20, 46, 102, 61, 61, 102, 46, 20, 97, 29,
+    29, 29, 29, 37, 19, 99, 98, 93, 31, 9, 20, 94, 29, 29, 29, 29, 97, 95, 46, 55,
+    96, 96, 55, 33, 52, 97, 29, 29, 29, 29, 94, 20, 9, 31, 93, 64, 88, 77, 35, 27,
+    29, 29, 29, 29, 27, 90, 66, 118, 70, 62, 62, 70, 118, 66, 90, 27, 29, 29, 29, 29,
+    27, 35, 77, 88, 13, 87, 48, 82, 35, 27, 29, 29, 29, 29, 29, 72, 83, 33, 78, 85,
+    121, 121, 85, 78, 33, 83, 72, 29, 29, 29, 29, 29, 27, 35, 82, 48, 87, 30, 76, 77,
+    52, 25, 29, 29, 29, 29, 29, 27, 22, 19, 33, 78, 80, 79, 79, 80, 78, 33, 19, 22,
+    27, 29, 29, 29, 29, 29, 25, 52, 77, 76, 30, 13, 4, 49, 45, 72, 28, 29, 29, 29,
+    29, 29, 73, 22, 45, 33, 54, 56, 74, 75, 75, 74, 56, 54, 33, 45, 22, 73, 29, 29,
+    29, 29, 29, 29, 72, 45, 49, 4, 13, 64, 3, 65, 66, 21, 26, 29, 29, 29, 29, 29,
+    29, 28, 67, 35, 19, 33, 68, 69, 70, 59, 62, 62, 59, 70, 69, 68, 33, 19, 35, 67,
+    28, 29, 29, 29, 29, 29, 29, 26, 21, 66, 65, 3, 64, 47, 48, 10, 41, 50, 94, 29,
+    29, 29, 29, 29, 29, 29, 28, 24, 51, 52, 41, 33, 53, 54, 55, 56, 57, 58, 59, 60,
+    125, 62, 62, 0, 0, 62, 62, 125, 60, 59, 58, 57, 56, 55, 54, 53, 33, 41, 52, 51,
+    24, 28, 29, 29, 29, 29, 29, 29, 29, 94, 50, 41, 10, 48, 47, 0, 2, 40, 10, 41,
+    90, 37, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 26, 67, 22, 21, 44, 45, 41, 18,
+    39, 46, 46, 12, 12, 12, 46, 46, 39, 18, 41, 45, 44, 21, 22, 67, 26, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 37, 90, 41, 10, 40, 2, 0, 0, 2, 38, 8, 39, 20,
+    22, 37, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 37,
+    22, 20, 39, 8, 38, 2, 0, 30, 3, 32, 8, 46, 34, 35, 36, 37, 28, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 28, 37, 36, 35, 34, 46, 8, 32, 3, 30, 13, 14, 15, 16, 8, 17, 18, 19,
+    44, 21, 22, 23, 24, 25, 94, 27, 27, 29, 29, 29, 27, 27, 94, 25, 24, 23, 22, 21,
+    44, 19, 18, 17, 8, 16, 15, 14, 13, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+    10, 11, 12, 11, 10, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+};
+
+
+//! Mask@2.png, 344x344, 11741 non transparent pixels
+static const uint32_t MASK_2_PALETTE[] =
+{
+    0x03020202, 0x1C101010, 0x361F1F1F, 0x4E2D2D2D, 0x63393939, 0x79454545,
+    0x894E4E4E, 0x9C595959, 0xAB626262, 0xBC6C6C6C, 0xCC757575, 0xCF777777,
+    0xDD7F7F7F, 0xE7848484, 0xF0898989, 0xF98F8F8F, 0xFF929292, 0xEA868686,
+    0xD4797979, 0x42262626, 0xA8606060, 0xC7727272, 0xE3828282, 0xFC909090,
+    0xA35D5D5D, 0xF68D8D8D, 0xFF9E9E9E, 0xFFA9A9A9, 0xFFB2B2B2, 0xFFBBBBBB,
+    0xFFC4C4C4, 0xFFCCCCCC, 0xFFD4D4D4, 0xFFDADADA, 0xFFE2E2E2, 0xFFE9E9E9,
+    0xFFEBEBEB, 0xFFEFEFEF, 0xFFF3F3F3, 0xFFF9F9F9, 0xFFFBFBFB, 0xFFFFFFFF,
+    0xFFF6F6F6, 0xFFEDEDED, 0x48292929, 0xFF9C9C9C, 0xFFACACAC, 0xFFC9C9C9,
+    0xFFD8D8D8, 0xFFE5E5E5, 0xFFF1F1F1, 0xFFFDFDFD, 0x2D1A1A1A, 0x6E3F3F3F,
+    0xFF999999, 0xFFAFAFAF, 0xFFC1C1C1, 0x73424242, 0xB4676767, 0xFF989898,
+    0xFFC7C7C7, 0xFFDCDCDC, 0xFFDFDFDF, 0x120A0A0A, 0x56313131, 0xFFA1A1A1,
+    0x24151515, 0x7F494949, 0xFF959595, 0xFFD0D0D0, 0xFFA6A6A6, 0xFFA3A3A3,
+    0xFFB7B7B7, 0xFFBEBEBE, 0x0C070707, 0xFF979797, 0xF99D9D9D, 0xF09E9E9E,
+    0xE89C9C9C, 0xD6959595, 0xC68D8D8D, 0xB3818181, 0x9C737373, 0x81616161,
+    0x634B4B4B, 0x5C464646, 0x3E303030, 0x31262626, 0x20191919, 0x0B090909,
+    0x1C161616, 0x241C1C1C, 0x4A393939, 0x3F242424, 0xEC9D9D9D, 0xCF919191,
+    0xAB7D7D7D, 0x523F3F3F, 0xFC9B9B9B, 0x926C6C6C, 0x39212121, 0xBB878787,
+    0x7B5D5D5D, 0x281F1F1F, 0xDF999999, 0xA2777777, 0xFF9B9B9B, 0xFFD7D7D7,
+    0xA87B7B7B, 0xE29A9A9A, 0x180E0E0E, 0x844C4C4C, 0x07040404, 0xF59F9F9F,
+    0x95555555, 0xFFB4B4B4, 0x3C2E2E2E, 0x372A2A2A, 0xAE7F7F7F, 0x8C505050,
+    0x5D353535, 0x89666666, 0xCB8F8F8F, 0x43333333, 0x14101010, 0xB0656565,
+    0x6A505050, 0x72565656, 0x3A2D2D2D, 0xC28A8A8A,
+};
+
+static const uint16_t MASK_2_RUNS[] =
+{
+    0, 153, 38, 1, 145, 54, 2, 140, 64, 3, 135, 74,
+    4, 130, 84, 5, 127, 90, 6, 123, 98, 7, 120, 104,
+    8, 117, 110, 9, 114, 116, 10, 111, 59, 10, 173, 60,
+    11, 109, 45, 11, 190, 45, 12, 106, 41, 12, 197, 41,
+    13, 104, 37, 13, 203, 37, 14, 101, 36, 14, 207, 36,
+    15, 99, 33, 15, 212, 33, 16, 97, 32, 16, 215, 32,
+    17, 95, 30, 17, 219, 30, 18, 93, 29, 18, 222, 29,
+    19, 91, 28, 19, 225, 28, 20, 89, 27, 20, 228, 27,
+    21, 88, 26, 21, 230, 26, 22, 86, 25, 22, 233, 25,
+    23, 84, 25, 23, 235, 25, 24, 82, 25, 24, 237, 25,
+    25, 81, 23, 25, 240, 23, 26, 79, 23, 26, 242, 23,
+    27, 78, 22, 27, 244, 22, 28, 76, 22, 28, 246, 22,
+    29, 75, 21, 29, 248, 21, 30, 73, 22, 30, 249, 22,
+    31, 72, 21, 31, 251, 21, 32, 70, 21, 32, 253, 21,
+    33, 69, 20, 33, 255, 20, 34, 68, 20, 34, 256, 20,
+    35, 66, 20, 35, 258, 20, 36, 65, 19, 36, 260, 19,
+    37, 64, 19, 37, 261, 19, 38, 63, 18, 38, 263, 18,
+    39, 61, 19, 39, 264, 19, 40, 60, 19, 40, 265, 19,
+    41, 59, 18, 41, 267, 18, 42, 58, 18, 42, 268, 18,
+    43, 57, 18, 43, 269, 18, 44, 56, 17, 44, 271, 17,
+    45, 55, 17, 45, 272, 17, 46, 53, 18, 46, 273, 17,
+    47, 52, 17, 47, 275, 17, 48, 51, 17, 48, 276, 17,
+    49, 50, 17, 49, 277, 17, 50, 49, 17, 50, 278, 17,
+    51, 48, 17, 51, 279, 17, 52, 47, 17, 52, 280, 17,
+    53, 46, 17, 53, 281, 17, 54, 46, 16, 54, 282, 16,
+    55, 45, 16, 55, 284, 15, 56, 44, 15, 56, 285, 15,
+    57, 43, 15, 57, 286, 15, 58, 42, 15, 58, 287, 15,
+    59, 41, 15, 59, 288, 15, 60, 40, 16, 60, 288, 16,
+    61, 39, 16, 61, 289, 16, 62, 39, 15, 62, 290, 15,
+    63, 38, 15, 63, 291, 15, 64, 37, 15, 64, 292, 15,
+    65, 36, 15, 65, 293, 15, 66, 35, 15, 66, 294, 15,
+    67, 35, 14, 67, 295, 14, 68, 34, 14, 68, 296, 14,
+    69, 33, 14, 69, 297, 14, 70, 32, 15, 70, 297, 15,
+    71, 32, 14, 71, 298, 14, 72, 31, 14, 72, 299, 14,
+    73, 30, 14, 73, 300, 14, 74, 30, 14, 74, 300, 14,
+    75, 29, 14, 75, 301, 14, 76, 28, 14, 76, 302, 14,
+    77, 28, 13, 77, 303, 13, 78, 27, 14, 78, 303, 14,
+    79, 26, 14, 79, 304, 14, 80, 26, 13, 80, 305, 13,
+    81, 25, 13, 81, 306, 13, 82, 24, 14, 82, 306, 14,
+    83, 24, 13, 83, 307, 13, 84, 23, 14, 84, 307, 14,
+    85, 23, 13, 85, 308, 13, 86, 22, 13, 86, 309, 13,
+    87, 21, 14, 87, 309, 14, 88, 21, 13, 88, 310, 13,
+    89, 20, 13, 89, 311, 13, 90, 20, 13, 90, 311, 13,
+    91, 19, 13, 91, 312, 13, 92, 19, 13, 92, 312, 13,
+    93, 18, 13, 93, 313, 13, 94, 18, 13, 94, 313, 13,
+    95, 17, 13, 95, 314, 13, 96, 17, 12, 96, 315, 12,
+    97, 16, 13, 97, 315, 13, 98, 16, 12, 98, 316, 12,
+    99, 15, 13, 99, 316, 13, 100, 15, 12, 100, 317, 12,
+    101, 14, 13, 101, 317, 13, 102, 14, 12, 102, 318, 12,
+    103, 14, 12, 103, 318, 12, 104, 13, 12, 104, 319, 12,
+    105, 13, 12, 105, 319, 12, 106, 12, 13, 106, 319, 13,
+    107, 12, 12, 107, 320, 12, 108, 11, 13, 108, 320, 13,
+    109, 11, 12, 109, 321, 12, 110, 11, 12, 110, 321, 12,
+    111, 10, 12, 111, 322, 12, 112, 10, 12, 112, 322, 12,
+    113, 10, 12, 113, 322, 12, 114, 9, 12, 114, 323, 12,
+    115, 9, 12, 115, 323, 12, 116, 9, 11, 116, 324, 11,
+    117, 8, 12, 117, 324, 12, 118, 8, 12, 118, 324, 12,
+    119, 8, 11, 119, 325, 11, 120, 7, 12, 120, 325, 12,
+    121, 7, 12, 121, 325, 12, 122, 7, 11, 122, 326, 11,
+    123, 6, 12, 123, 326, 12, 124, 6, 12, 124, 326, 12,
+    125, 6, 11, 125, 327, 11, 126, 6, 11, 126, 327, 11,
+    127, 5, 12, 127, 327, 12, 128, 5, 12, 128, 327, 12,
+    129, 5, 11, 129, 328, 11, 130, 4, 12, 130, 328, 12,
+    131, 4, 12, 131, 328, 12, 132, 4, 11, 132, 329, 11,
+    133, 4, 11, 133, 329, 11, 134, 4, 11, 134, 329, 11,
+    135, 3, 12, 135, 329, 12, 136, 3, 12, 136, 329, 12,
+    137, 3, 11, 137, 330, 11, 138, 3, 11, 138, 330, 11,
+    139, 3, 11, 139, 330, 11, 140, 2, 12, 140, 330, 12,
+    141, 2, 11, 141, 331, 11, 142, 2, 11, 142, 331, 11,
+    143, 2, 11, 143, 331, 11, 144, 2, 11, 144, 331, 11,
+    145, 2, 11, 145, 331, 12, 146, 1, 12, 146, 331, 12,
+    147, 1, 11, 147, 332, 11, 148, 1, 11, 148, 332, 11,
+    149, 1, 11, 149, 332, 11, 150, 1, 11, 150, 332, 11,
+    151, 1, 11, 151, 332, 11, 152, 1, 11, 152, 332, 11,
+    153, 0, 12, 153, 332, 12, 154, 0, 11, 154, 333, 11,
+    155, 0, 11, 155, 333, 11, 156, 0, 11, 156, 333, 11,
+    157, 0, 11, 157, 333, 11, 158, 0, 11, 158, 333, 11,
+    159, 0, 11, 159, 333, 11, 160, 0, 11, 160, 333, 11,
+    161, 0, 11, 161, 333, 11, 162, 0, 11, 162, 333, 11,
+    163, 0, 11, 163, 333, 11, 164, 0, 11, 164, 333, 11,
+    165, 0, 11, 165, 333, 11, 166, 0, 11, 166, 333, 11,
+    167, 0, 11, 167, 333, 11, 168, 0, 11, 168, 333, 11,
+    169, 0, 11, 169, 333, 11, 170, 0, 10, 170, 334, 10,
+    171, 0, 10, 171, 334, 10, 172, 0, 10, 172, 334, 10,
+    173, 0, 11, 173, 334, 10, 174, 0, 11, 174, 333, 11,
+    175, 0, 11, 175, 333, 11, 176, 0, 11, 176, 333, 11,
+    177, 0, 11, 177, 333, 11, 178, 0, 11, 178, 333, 11,
+    179, 0, 11, 179, 333, 11, 180, 0, 11, 180, 333, 11,
+    181, 0, 11, 181, 333, 11, 182, 0, 11, 182, 333, 11,
+    183, 0, 11, 183, 333, 11, 184, 0, 11, 184, 333, 11,
+    185, 0, 11, 185, 333, 11, 186, 0, 11, 186, 333, 11,
+    187, 0, 11, 187, 333, 11, 188, 0, 11, 188, 333, 11,
+    189, 0, 11, 189, 333, 11, 190, 0, 12, 190, 332, 12,
+    191, 1, 11, 191, 332, 11, 192, 1, 11, 192, 332, 11,
+    193, 1, 11, 193, 332, 11, 194, 1, 11, 194, 332, 11,
+    195, 1, 11, 195, 332, 11, 196, 1, 11, 196, 332, 11,
+    197, 1, 12, 197, 331, 12, 198, 1, 12, 198, 331, 12,
+    199, 2, 11, 199, 331, 11, 200, 2, 11, 200, 331, 11,
+    201, 2, 11, 201, 331, 11, 202, 2, 11, 202, 331, 11,
+    203, 2, 12, 203, 330, 12, 204, 3, 11, 204, 330, 11,
+    205, 3, 11, 205, 330, 11, 206, 3, 11, 206, 330, 11,
+    207, 3, 12, 207, 329, 12, 208, 3, 12, 208, 329, 12,
+    209, 4, 11, 209, 329, 11, 210, 4, 11, 210, 329, 11,
+    211, 4, 11, 211, 329, 11, 212, 4, 12, 212, 328, 12,
+    213, 4, 12, 213, 328, 12, 214, 5, 11, 214, 328, 11,
+    215, 5, 12, 215, 327, 12, 216, 5, 12, 216, 327, 12,
+    217, 6, 11, 217, 327, 11, 218, 6, 11, 218, 327, 11,
+    219, 6, 12, 219, 326, 12, 220, 6, 12, 220, 326, 12,
+    221, 7, 11, 221, 326, 11, 222, 7, 12, 222, 325, 12,
+    223, 7, 12, 223, 325, 12, 224, 8, 11, 224, 325, 11,
+    225, 8, 12, 225, 324, 12, 226, 8, 12, 226, 324, 12,
+    227, 9, 11, 227, 324, 11, 228, 9, 12, 228, 323, 12,
+    229, 9, 12, 229, 323, 12, 230, 10, 12, 230, 322, 12,
+    231, 10, 12, 231, 322, 12, 232, 10, 12, 232, 322, 12,
+    233, 11, 12, 233, 321, 12, 234, 11, 12, 234, 321, 12,
+    235, 11, 13, 235, 320, 13, 236, 12, 12, 236, 320, 12,
+    237, 12, 13, 237, 319, 13, 238, 13, 12, 238, 319, 12,
+    239, 13, 12, 239, 319, 12, 240, 14, 12, 240, 318, 12,
+    241, 14, 12, 241, 318, 12, 242, 14, 13, 242, 317, 13,
+    243, 15, 12, 243, 317, 12, 244, 15, 13, 244, 316, 13,
+    245, 16, 12, 245, 316, 12, 246, 16, 13, 246, 315, 13,
+    247, 17, 12, 247, 315, 12, 248, 17, 13, 248, 314, 13,
+    249, 18, 13, 249, 313, 13, 250, 18, 13, 250, 313, 13,
+    251, 19, 13, 251, 312, 13, 252, 19, 13, 252, 312, 13,
+    253, 20, 13, 253, 311, 13, 254, 20, 13, 254, 311, 13,
+    255, 21, 13, 255, 310, 13, 256, 21, 14, 256, 309, 14,
+    257, 22, 13, 257, 309, 13, 258, 23, 13, 258, 308, 13,
+    259, 23, 13, 259, 307, 14, 260, 24, 13, 260, 307, 13,
+    261, 24, 14, 261, 306, 14, 262, 25, 13, 262, 306, 13,
+    263, 26, 13, 263, 305, 13, 264, 26, 14, 264, 304, 14,
+    265, 27, 14, 265, 303, 14, 266, 28, 13, 266, 303, 13,
+    267, 28, 14, 267, 302, 14, 268, 29, 14, 268, 301, 14,
+    269, 30, 14, 269, 300, 14, 270, 30, 14, 270, 300, 14,
+    271, 31, 14, 271, 299, 14, 272, 32, 14, 272, 298, 14,
+    273, 32, 15, 273, 297, 15, 274, 33, 14, 274, 297, 14,
+    275, 34, 14, 275, 296, 14, 276, 35, 14, 276, 295, 14,
+    277, 35, 15, 277, 294, 15, 278, 36, 15, 278, 293, 15,
+    279, 37, 15, 279, 292, 15, 280, 38, 15, 280, 291, 15,
+    281, 39, 15, 281, 290, 15, 282, 39, 16, 282, 289, 16,
+    283, 40, 16, 283, 288, 16, 284, 41, 16, 284, 287, 16,
+    285, 42, 15, 285, 287, 15, 286, 43, 15, 286, 286, 15,
+    287, 44, 15, 287, 285, 15, 288, 45, 16, 288, 284, 15,
+    289, 46, 16, 289, 282, 16, 290, 46, 17, 290, 281, 17,
+    291, 47, 17, 291, 280, 17, 292, 48, 17, 292, 279, 17,
+    293, 49, 17, 293, 278, 17, 294, 50, 17, 294, 277, 17,
+    295, 51, 17, 295, 276, 17, 296, 52, 17, 296, 275, 17,
+    297, 53, 18, 297, 273, 18, 298, 55, 17, 298, 272, 17,
+    299, 56, 17, 299, 271, 17, 300, 57, 18, 300, 269, 18,
+    301, 58, 18, 301, 268, 18, 302, 59, 18, 302, 267, 18,
+    303, 60, 19, 303, 265, 19, 304, 61, 19, 304, 264, 19,
+    305, 63, 18, 305, 263, 18, 306, 64, 19, 306, 261, 19,
+    307, 65, 19, 307, 260, 19, 308, 66, 20, 308, 258, 20,
+    309, 68, 20, 309, 256, 20, 310, 69, 20, 310, 255, 20,
+    311, 70, 21, 311, 253, 21, 312, 72, 21, 312, 251, 21,
+    313, 73, 22, 313, 249, 22, 314, 75, 21, 314, 248, 21,
+    315, 76, 22, 315, 246, 22, 316, 78, 22, 316, 244, 22,
+    317, 79, 23, 317, 242, 23, 318, 81, 23, 318, 240, 23,
+    319, 82, 25, 319, 237, 25, 320, 84, 25, 320, 235, 25,
+    321, 86, 25, 321, 233, 25, 322, 87, 27, 322, 230, 27,
+    323, 89, 27, 323, 228, 27, 324, 91, 28, 324, 225, 28,
+    325, 93, 29, 325, 222, 29, 326, 95, 30, 326, 219, 30,
+    327, 97, 32, 327, 215, 32, 328, 99, 33, 328, 212, 33,
+    329, 101, 35, 329, 208, 35, 330, 104, 37, 330, 203, 37,
+    331, 106, 41, 331, 197, 41, 332, 108, 46, 332, 190, 46,
+    333, 111, 59, 333, 174, 59, 334, 114, 116, 335, 117, 110,
+    336, 120, 104, 337, 123, 98, 338, 127, 90, 339, 130, 84,
+    340, 135, 74, 341, 140, 64, 342, 145, 54, 343, 153, 38,
+};
+
+static const uint8_t MASK_2_INDICES[] =
+{
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 14, 15, 16, 16, 16,
+    14, 14, 17, 12, 12, 18, 10, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 0, 1,
+    19, 4, 6, 20, 21, 22, 23, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 23, 22, 21, 20, 6, 4, 19, 1, 0, 1, 3, 5, 24, 10, 25, 16, 16,
+    16, 16, 16, 16, 16, 16, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+    39, 40, 41, 41, 41, 39, 39, 42, 37, 37, 43, 35, 35, 34, 33, 32, 31, 30, 29, 28,
+    27, 26, 16, 16, 16, 16, 16, 16, 16, 16, 25, 10, 24, 5, 44, 1, 1, 3, 6, 9,
+    17, 16, 16, 16, 16, 16, 16, 45, 46, 29, 47, 48, 49, 50, 51, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 51, 50, 49, 48, 47, 29, 46, 45, 16,
+    16, 16, 16, 16, 16, 17, 9, 6, 3, 1, 0, 52, 53, 8, 22, 16, 16, 16, 16, 16,
+    54, 55, 56, 32, 49, 39, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 39, 49,
+    32, 56, 55, 54, 16, 16, 16, 16, 16, 22, 8, 53, 52, 0, 52, 57, 58, 14, 16, 16,
+    16, 16, 59, 55, 60, 61, 50, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 50, 62, 60, 55, 59, 16, 16, 16, 16,
+    14, 58, 57, 52, 63, 64, 24, 13, 16, 16, 16, 16, 65, 29, 32, 43, 51, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 43, 32, 29, 65, 16, 16, 16, 16, 13, 24,
+    64, 63, 66, 57, 9, 23, 16, 16, 16, 45, 29, 48, 38, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 38, 48, 29, 45, 16,
+    16, 16, 23, 9, 57, 66, 52, 67, 18, 16, 16, 16, 68, 55, 69, 36, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 42, 36, 49, 61, 32, 31, 30, 29, 28, 27, 70, 65, 26, 54, 54, 68, 16,
+    16, 16, 59, 54, 54, 65, 65, 71, 27, 27, 28, 72, 73, 60, 69, 48, 34, 36, 42, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 43, 69, 55, 68, 16, 16, 16, 18, 67, 52, 66, 67, 18, 16,
+    16, 16, 54, 29, 33, 39, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 40, 36, 61, 31, 73, 55, 71, 68, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 68, 71, 55, 73, 31, 61, 36, 40,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 39, 33, 29, 54, 16, 16, 16, 18, 67, 66, 74, 53, 21, 16, 16, 16, 59, 72,
+    62, 40, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 51, 43, 48, 60, 28, 65, 16, 16, 16, 16, 16, 16, 16, 16, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 88, 89, 90, 88, 91, 86, 86, 92, 85, 84, 83,
+    82, 81, 80, 79, 78, 77, 76, 75, 16, 16, 16, 16, 16, 16, 16, 16, 65, 28, 30, 48,
+    43, 51, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 40, 62, 72, 59, 16, 16, 16, 21, 53, 74, 93, 24, 25, 16, 16, 75, 72, 61, 40,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 38, 33,
+    56, 46, 75, 16, 16, 16, 16, 16, 16, 76, 94, 95, 96, 83, 97, 88, 88, 97, 83, 96,
+    95, 94, 76, 16, 16, 16, 16, 16, 16, 75, 46, 56, 33, 38, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 40, 61, 72, 75, 16, 16, 25, 24,
+    93, 63, 57, 18, 16, 16, 16, 55, 48, 40, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 51, 36, 69, 72, 65, 16, 16, 16, 16, 16, 98, 78, 80, 99,
+    97, 89, 89, 97, 99, 80, 78, 98, 16, 16, 16, 16, 16, 65, 72, 69, 36, 51, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 40, 33, 55, 16, 16, 16,
+    18, 57, 63, 100, 20, 15, 16, 16, 45, 60, 37, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 43, 69, 28, 59, 16, 16, 16, 16, 54, 94, 101, 102, 103,
+    103, 102, 101, 78, 54, 16, 16, 16, 16, 59, 28, 69, 43, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 37, 60, 45, 16, 16, 15, 20, 100, 0, 64, 21,
+    16, 16, 16, 28, 61, 51, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    40, 62, 73, 26, 16, 16, 16, 16, 98, 104, 105, 92, 0, 0, 92, 105, 104, 98, 16, 16,
+    16, 16, 26, 73, 62, 40, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    51, 61, 28, 16, 16, 16, 21, 64, 0, 74, 53, 12, 16, 16, 106, 60, 38, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 39, 107, 28, 68, 16, 16, 16, 75, 78,
+    108, 86, 86, 105, 109, 54, 16, 16, 16, 68, 28, 107, 39, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 38, 60, 45, 16, 16, 12, 53, 74, 110, 111, 14, 16, 16,
+    70, 107, 40, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 39, 107, 28, 68,
+    16, 16, 16, 76, 95, 102, 89, 112, 84, 80, 113, 16, 16, 16, 68, 28, 107, 39, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 40, 107, 70, 16, 16, 14, 111, 110, 1,
+    114, 25, 16, 16, 55, 34, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 39,
+    48, 115, 68, 16, 16, 16, 77, 96, 116, 117, 96, 77, 16, 16, 16, 68, 115, 48, 39, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 34, 55, 16, 16, 25, 114, 1, 1,
+    114, 15, 16, 16, 72, 35, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 49,
+    29, 75, 16, 16, 16, 113, 118, 117, 117, 118, 113, 16, 16, 16, 75, 29, 49, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 35, 72, 16, 16, 15, 114, 1, 63, 119, 25,
+    16, 16, 72, 43, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 42, 31, 65, 16,
+    16, 16, 113, 81, 116, 116, 81, 113, 16, 16, 16, 65, 31, 42, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 43, 72, 16, 16, 25, 119, 63, 74, 67, 14, 16, 16, 72, 43,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 49, 72, 68, 16, 16, 106, 95, 97,
+    97, 95, 106, 16, 16, 68, 72, 49, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    43, 72, 16, 16, 14, 67, 74, 120, 13, 16, 16, 28, 35, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 40, 32, 70, 16, 16, 16, 94, 121, 89, 89, 121, 94, 16, 16, 16, 70,
+    32, 40, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 35, 28, 16, 16, 13, 4, 100,
+    21, 16, 16, 27, 49, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 42, 60, 106, 16,
+    16, 54, 122, 123, 123, 122, 54, 16, 16, 106, 60, 42, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 49, 27, 16, 16, 21, 100, 1, 20, 16, 16, 26, 48, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 50, 56, 68, 16, 16, 76, 108, 124, 124, 105, 76, 16, 16, 68,
+    56, 50, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 48, 65, 16, 16, 20, 1, 112,
+    5, 25, 16, 75, 31, 40, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 37, 29, 68, 16,
+    16, 77, 83, 0, 0, 83, 77, 16, 16, 68, 29, 37, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 40, 31, 75, 16, 25, 5, 112, 19, 12, 16, 16, 72, 38, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 37, 29, 68, 16, 16, 78, 84, 84, 78, 16, 16, 68, 29, 43, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 38, 72, 16, 16, 12, 19, 63, 7, 16, 16, 70,
+    49, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 50, 29, 68, 16, 16, 109, 97, 97, 109,
+    16, 16, 68, 29, 50, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 49, 70, 16, 16, 7,
+    63, 64, 13, 16, 75, 31, 51, 41, 41, 41, 41, 41, 41, 41, 41, 41, 42, 56, 68, 16,
+    16, 109, 97, 97, 109, 16, 16, 68, 56, 42, 41, 41, 41, 41, 41, 41, 41, 41, 41, 51,
+    31, 75, 16, 13, 64, 1, 125, 16, 16, 28, 50, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    40, 31, 54, 16, 16, 78, 85, 85, 78, 16, 16, 54, 31, 40, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 50, 28, 16, 16, 125, 1, 4, 14, 16, 54, 48, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 48, 26, 16, 16, 113, 126, 126, 113, 16, 16, 26, 48, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 48, 54, 16, 14, 4, 110, 125, 16, 16, 115, 42, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 36, 46, 16, 16, 98, 99, 0, 0, 99, 98, 16, 16, 46, 36,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 42, 115, 16, 16, 125, 110, 3, 17, 16, 59, 48,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 39, 56, 68, 16, 68, 80, 124, 124, 80, 68, 16,
+    68, 56, 39, 41, 41, 41, 41, 41, 41, 41, 41, 41, 48, 59, 16, 17, 3, 112, 114, 16,
+    16, 46, 50, 41, 41, 41, 41, 41, 41, 41, 41, 41, 33, 45, 16, 16, 104, 117, 117, 104,
+    16, 16, 45, 48, 41, 41, 41, 41, 41, 41, 41, 41, 41, 50, 46, 16, 16, 114, 112, 52,
+    18, 16, 68, 47, 51, 41, 41, 41, 41, 41, 41, 41, 41, 37, 28, 16, 16, 113, 127, 127,
+    76, 16, 16, 55, 37, 41, 41, 41, 41, 41, 41, 41, 41, 51, 47, 68, 16, 18, 52, 4,
+    25, 16, 65, 49, 41, 41, 41, 41, 41, 41, 41, 41, 51, 69, 75, 16, 68, 81, 112, 112,
+    81, 68, 16, 75, 69, 51, 41, 41, 41, 41, 41, 41, 41, 41, 49, 65, 16, 25, 4, 112,
+    7, 16, 16, 29, 39, 41, 41, 41, 41, 41, 41, 41, 41, 43, 46, 16, 16, 94, 86, 86,
+    94, 16, 16, 46, 43, 41, 41, 41, 41, 41, 41, 41, 41, 39, 29, 16, 16, 7, 112, 66,
+    11, 16, 68, 32, 41, 41, 41, 41, 41, 41, 41, 41, 41, 69, 68, 16, 59, 82, 82, 59,
+    16, 68, 69, 41, 41, 41, 41, 41, 41, 41, 41, 41, 32, 68, 16, 11, 66, 44, 14, 16,
+    26, 35, 41, 41, 41, 41, 41, 41, 41, 41, 42, 28, 16, 16, 78, 87, 87, 78, 16, 16,
+    28, 42, 41, 41, 41, 41, 41, 41, 41, 41, 35, 26, 16, 14, 44, 57, 23, 16, 55, 42,
+    41, 41, 41, 41, 41, 41, 41, 41, 62, 45, 16, 68, 108, 108, 68, 16, 45, 62, 41, 41,
+    41, 41, 41, 41, 41, 41, 42, 55, 16, 23, 57, 112, 24, 16, 16, 30, 51, 41, 41, 41,
+    41, 41, 41, 41, 40, 56, 16, 16, 113, 92, 92, 113, 16, 16, 56, 40, 41, 41, 41, 41,
+    41, 41, 41, 51, 30, 16, 16, 24, 112, 110, 21, 16, 75, 61, 41, 41, 41, 41, 41, 41,
+    41, 41, 43, 71, 16, 16, 122, 89, 89, 122, 16, 16, 71, 36, 41, 41, 41, 41, 41, 41,
+    41, 41, 61, 59, 16, 21, 110, 52, 12, 16, 26, 35, 41, 41, 41, 41, 41, 41, 41, 41,
+    33, 75, 16, 98, 127, 127, 98, 16, 68, 48, 41, 41, 41, 41, 41, 41, 41, 41, 36, 26,
+    16, 12, 52, 93, 14, 16, 70, 38, 41, 41, 41, 41, 41, 41, 41, 51, 30, 16, 16, 78,
+    91, 91, 78, 16, 16, 73, 40, 41, 41, 41, 41, 41, 41, 41, 42, 27, 16, 14, 93, 64,
+    15, 16, 55, 39, 41, 41, 41, 41, 41, 41, 41, 42, 46, 16, 16, 101, 0, 0, 101, 16,
+    16, 27, 38, 41, 41, 41, 41, 41, 41, 41, 40, 72, 16, 15, 64, 53, 16, 16, 73, 51,
+    41, 41, 41, 41, 41, 41, 41, 49, 26, 16, 54, 127, 127, 54, 16, 45, 49, 41, 41, 41,
+    41, 41, 41, 41, 51, 56, 16, 16, 57, 111, 16, 16, 31, 41, 41, 41, 41, 41, 41, 41,
+    41, 32, 68, 16, 113, 128, 128, 113, 16, 68, 32, 41, 41, 41, 41, 41, 41, 41, 41, 31,
+    16, 16, 67, 0, 114, 16, 68, 48, 41, 41, 41, 41, 41, 41, 41, 51, 30, 16, 16, 104,
+    124, 124, 104, 16, 16, 30, 51, 41, 41, 41, 41, 41, 41, 41, 48, 68, 16, 119, 0, 20,
+    16, 68, 62, 41, 41, 41, 41, 41, 41, 41, 39, 28, 16, 16, 101, 101, 16, 16, 28, 39,
+    41, 41, 41, 41, 41, 41, 41, 62, 68, 16, 114, 0, 112, 8, 16, 59, 49, 41, 41, 41,
+    41, 41, 41, 41, 42, 27, 16, 68, 121, 121, 68, 16, 70, 42, 41, 41, 41, 41, 41, 41,
+    41, 49, 59, 16, 24, 0, 112, 125, 16, 54, 35, 41, 41, 41, 41, 41, 41, 41, 37, 65,
+    16, 106, 85, 85, 106, 16, 65, 43, 41, 41, 41, 41, 41, 41, 41, 35, 54, 16, 125, 112,
+    112, 58, 16, 106, 35, 41, 41, 41, 41, 41, 41, 41, 49, 54, 16, 76, 86, 86, 76, 16,
+    54, 49, 41, 41, 41, 41, 41, 41, 41, 35, 54, 16, 58, 112, 112, 125, 16, 106, 36, 41,
+    41, 41, 41, 41, 41, 41, 34, 75, 16, 113, 91, 91, 113, 16, 75, 34, 41, 41, 41, 41,
+    41, 41, 41, 36, 106, 16, 125, 112, 0, 8, 16, 106, 36, 41, 41, 41, 41, 41, 41, 41,
+    61, 68, 16, 78, 124, 124, 78, 16, 68, 33, 41, 41, 41, 41, 41, 41, 41, 36, 106, 16,
+    8, 0, 0, 24, 16, 54, 35, 41, 41, 41, 41, 41, 41, 41, 107, 16, 16, 104, 89, 89,
+    104, 16, 16, 107, 41, 41, 41, 41, 41, 41, 41, 35, 54, 16, 20, 0, 114, 16, 59, 35,
+    41, 41, 41, 41, 41, 41, 41, 32, 16, 16, 79, 0, 0, 79, 16, 16, 32, 41, 41, 41,
+    41, 41, 41, 41, 35, 59, 16, 114, 111, 16, 68, 49, 41, 41, 41, 41, 41, 41, 41, 69,
+    16, 16, 122, 0, 122, 16, 16, 69, 41, 41, 41, 41, 41, 41, 41, 49, 68, 16, 6, 53,
+    16, 68, 62, 41, 41, 41, 41, 41, 41, 41, 69, 16, 16, 80, 80, 16, 16, 32, 41, 41,
+    41, 41, 41, 41, 41, 62, 68, 16, 57, 3, 23, 16, 48, 41, 41, 41, 41, 41, 41, 41,
+    107, 16, 16, 129, 129, 16, 16, 107, 41, 41, 41, 41, 41, 41, 41, 48, 16, 23, 3, 2,
+    25, 16, 31, 41, 41, 41, 41, 41, 41, 41, 33, 16, 16, 80, 80, 16, 16, 33, 41, 41,
+    41, 41, 41, 41, 41, 31, 16, 25, 2, 66, 17, 16, 73, 41, 41, 41, 41, 41, 41, 41,
+    62, 68, 16, 95, 95, 16, 68, 62, 41, 41, 41, 41, 41, 41, 41, 73, 16, 17, 66, 74,
+    18, 16, 55, 51, 41, 41, 41, 41, 41, 41, 34, 68, 16, 79, 0, 0, 79, 16, 68, 34,
+    41, 41, 41, 41, 41, 41, 51, 55, 16, 12, 74, 112, 9, 16, 70, 39, 41, 41, 41, 41,
+    41, 41, 49, 75, 16, 104, 112, 112, 104, 16, 75, 49, 41, 41, 41, 41, 41, 41, 39, 70,
+    16, 9, 112, 24, 16, 26, 38, 41, 41, 41, 41, 41, 41, 37, 106, 16, 78, 89, 89, 78,
+    16, 106, 37, 41, 41, 41, 41, 41, 41, 38, 26, 16, 24, 57, 16, 59, 36, 41, 41, 41,
+    41, 41, 41, 42, 65, 16, 113, 124, 124, 113, 16, 65, 42, 41, 41, 41, 41, 41, 41, 36,
+    59, 16, 57, 44, 23, 16, 61, 41, 41, 41, 41, 41, 41, 40, 46, 16, 76, 103, 103, 76,
+    16, 46, 40, 41, 41, 41, 41, 41, 41, 61, 16, 23, 44, 66, 14, 16, 60, 41, 41, 41,
+    41, 41, 41, 41, 72, 16, 54, 123, 123, 54, 16, 72, 41, 41, 41, 41, 41, 41, 41, 60,
+    16, 14, 66, 112, 11, 16, 115, 41, 41, 41, 41, 41, 41, 41, 30, 16, 68, 84, 84, 68,
+    16, 30, 41, 41, 41, 41, 41, 41, 41, 115, 16, 11, 112, 7, 16, 65, 39, 41, 41, 41,
+    41, 41, 41, 32, 16, 16, 121, 121, 16, 16, 32, 41, 41, 41, 41, 41, 41, 39, 65, 16,
+    7, 4, 16, 68, 36, 41, 41, 41, 41, 41, 41, 49, 68, 16, 101, 101, 16, 68, 49, 41,
+    41, 41, 41, 41, 41, 43, 68, 16, 4, 52, 25, 16, 107, 41, 41, 41, 41, 41, 41, 38,
+    45, 16, 104, 104, 16, 45, 38, 41, 41, 41, 41, 41, 41, 107, 16, 25, 52, 112, 18, 16,
+    29, 41, 41, 41, 41, 41, 41, 40, 27, 16, 113, 124, 124, 113, 16, 27, 40, 41, 41, 41,
+    41, 41, 41, 29, 16, 18, 112, 114, 16, 71, 39, 41, 41, 41, 41, 41, 41, 73, 16, 54,
+    117, 117, 54, 16, 73, 41, 41, 41, 41, 41, 41, 39, 71, 16, 114, 3, 16, 68, 35, 41,
+    41, 41, 41, 41, 41, 48, 16, 16, 127, 127, 16, 16, 48, 41, 41, 41, 41, 41, 41, 35,
+    68, 16, 3, 110, 17, 16, 69, 41, 41, 41, 41, 41, 41, 43, 68, 16, 101, 101, 16, 68,
+    43, 41, 41, 41, 41, 41, 41, 69, 16, 17, 110, 125, 16, 55, 41, 41, 41, 41, 41, 41,
+    40, 71, 16, 78, 0, 0, 78, 16, 71, 40, 41, 41, 41, 41, 41, 41, 55, 16, 125, 4,
+    16, 54, 38, 41, 41, 41, 41, 41, 41, 73, 16, 98, 91, 91, 98, 16, 73, 41, 41, 41,
+    41, 41, 41, 38, 54, 16, 4, 1, 14, 16, 48, 41, 41, 41, 41, 41, 41, 33, 16, 16,
+    126, 127, 16, 16, 33, 41, 41, 41, 41, 41, 41, 48, 16, 14, 1, 58, 16, 72, 41, 41,
+    41, 41, 41, 41, 38, 54, 16, 129, 122, 16, 54, 38, 41, 41, 41, 41, 41, 41, 72, 16,
+    9, 4, 16, 54, 42, 41, 41, 41, 41, 41, 41, 55, 16, 113, 112, 89, 113, 16, 55, 41,
+    41, 41, 41, 41, 41, 42, 54, 16, 4, 110, 14, 16, 48, 41, 41, 41, 41, 41, 41, 69,
+    16, 75, 86, 92, 68, 16, 69, 41, 41, 41, 41, 41, 41, 48, 16, 14, 110, 20, 16, 28,
+    41, 41, 41, 41, 41, 41, 43, 68, 16, 105, 108, 16, 68, 37, 41, 41, 41, 41, 41, 41,
+    28, 16, 20, 44, 16, 75, 50, 41, 41, 41, 41, 41, 51, 46, 16, 78, 78, 16, 46, 51,
+    41, 41, 41, 41, 41, 50, 75, 16, 44, 112, 12, 16, 31, 41, 41, 41, 41, 41, 41, 69,
+    16, 54, 87, 117, 75, 16, 69, 41, 41, 41, 41, 41, 41, 31, 16, 12, 74, 111, 16, 70,
+    51, 41, 41, 41, 41, 41, 37, 75, 16, 82, 108, 16, 75, 37, 41, 41, 41, 41, 41, 51,
+    70, 16, 111, 66, 25, 16, 49, 41, 41, 41, 41, 41, 41, 28, 16, 94, 0, 0, 77, 16,
+    55, 41, 41, 41, 41, 41, 41, 49, 16, 25, 66, 125, 16, 72, 41, 41, 41, 41, 41, 41,
+    48, 16, 68, 86, 92, 68, 16, 48, 41, 41, 41, 41, 41, 41, 72, 16, 125, 44, 16, 68,
+    50, 41, 41, 41, 41, 41, 39, 45, 16, 81, 101, 16, 45, 39, 41, 41, 41, 41, 41, 50,
+    68, 16, 44, 0, 18, 16, 60, 41, 41, 41, 41, 41, 41, 56, 16, 113, 89, 89, 76, 16,
+    56, 41, 41, 41, 41, 41, 41, 60, 16, 18, 0, 4, 16, 26, 39, 41, 41, 41, 41, 41,
+    43, 68, 16, 126, 126, 16, 16, 35, 41, 41, 41, 41, 41, 39, 26, 16, 4, 74, 13, 16,
+    107, 41, 41, 41, 41, 41, 41, 28, 16, 109, 109, 16, 46, 41, 41, 41, 41, 41, 41, 48,
+    16, 13, 74, 67, 16, 27, 41, 41, 41, 41, 41, 41, 62, 16, 68, 117, 117, 68, 16, 48,
+    41, 41, 41, 41, 41, 41, 27, 16, 67, 63, 14, 16, 49, 41, 41, 41, 41, 41, 51, 71,
+    16, 129, 129, 16, 65, 40, 41, 41, 41, 41, 41, 49, 16, 14, 63, 119, 16, 28, 41, 41,
+    41, 41, 41, 41, 69, 16, 98, 124, 124, 98, 16, 31, 41, 41, 41, 41, 41, 41, 55, 16,
+    119, 1, 25, 16, 35, 41, 41, 41, 41, 41, 42, 54, 16, 99, 99, 16, 59, 42, 41, 41,
+    41, 41, 41, 49, 16, 25, 1, 114, 16, 72, 41, 41, 41, 41, 41, 41, 30, 16, 113, 0,
+    0, 113, 16, 30, 41, 41, 41, 41, 41, 41, 28, 16, 114, 1, 15, 16, 43, 41, 41, 41,
+    41, 41, 42, 68, 16, 127, 127, 16, 68, 38, 41, 41, 41, 41, 41, 35, 16, 15, 1, 114,
+    16, 72, 41, 41, 41, 41, 41, 41, 56, 16, 94, 94, 16, 56, 41, 41, 41, 41, 41, 41,
+    115, 16, 114, 110, 25, 16, 36, 41, 41, 41, 41, 41, 38, 68, 16, 84, 84, 16, 68, 38,
+    41, 41, 41, 41, 41, 36, 16, 25, 110, 6, 16, 115, 41, 41, 41, 41, 41, 41, 73, 16,
+    78, 78, 16, 73, 41, 41, 41, 41, 41, 41, 72, 16, 6, 63, 14, 16, 35, 41, 41, 41,
+    41, 41, 50, 68, 16, 85, 85, 16, 68, 50, 41, 41, 41, 41, 41, 35, 16, 14, 63, 5,
+    16, 55, 41, 41, 41, 41, 41, 41, 29, 16, 78, 78, 16, 29, 41, 41, 41, 41, 41, 41,
+    55, 16, 5, 112, 13, 16, 34, 41, 41, 41, 41, 41, 50, 68, 16, 97, 97, 16, 68, 50,
+    41, 41, 41, 41, 41, 34, 16, 13, 112, 120, 16, 70, 41, 41, 41, 41, 41, 41, 56, 16,
+    78, 78, 16, 56, 41, 41, 41, 41, 41, 41, 70, 16, 120, 11, 16, 107, 41, 41, 41, 41,
+    41, 42, 68, 16, 84, 127, 16, 68, 42, 41, 41, 41, 41, 41, 107, 16, 11, 93, 16, 106,
+    40, 41, 41, 41, 41, 41, 60, 16, 77, 113, 16, 60, 41, 41, 41, 41, 41, 40, 106, 16,
+    93, 8, 16, 60, 41, 41, 41, 41, 41, 40, 106, 16, 102, 99, 16, 106, 40, 41, 41, 41,
+    41, 41, 60, 16, 8, 110, 15, 68, 38, 41, 41, 41, 41, 41, 32, 16, 76, 0, 112, 98,
+    16, 32, 41, 41, 41, 41, 41, 38, 68, 15, 110, 5, 16, 115, 41, 41, 41, 41, 41, 41,
+    70, 16, 108, 96, 16, 70, 41, 41, 41, 41, 41, 41, 115, 16, 5, 0, 22, 16, 34, 41,
+    41, 41, 41, 41, 49, 16, 59, 124, 124, 59, 16, 49, 41, 41, 41, 41, 41, 34, 16, 22,
+    0, 44, 16, 65, 41, 41, 41, 41, 41, 41, 72, 16, 122, 122, 16, 72, 41, 41, 41, 41,
+    41, 41, 65, 16, 44, 20, 16, 31, 41, 41, 41, 41, 41, 42, 68, 16, 123, 123, 16, 68,
+    42, 41, 41, 41, 41, 41, 31, 16, 20, 63, 15, 16, 38, 41, 41, 41, 41, 41, 31, 16,
+    94, 94, 16, 31, 41, 41, 41, 41, 41, 38, 16, 15, 63, 53, 16, 28, 41, 41, 41, 41,
+    41, 41, 65, 16, 121, 121, 16, 65, 41, 41, 41, 41, 41, 41, 28, 16, 53, 21, 16, 33,
+    41, 41, 41, 41, 41, 49, 16, 106, 89, 89, 106, 16, 49, 41, 41, 41, 41, 41, 33, 16,
+    21, 66, 16, 75, 40, 41, 41, 41, 41, 41, 29, 16, 122, 122, 16, 29, 41, 41, 41, 41,
+    41, 40, 59, 16, 66, 67, 16, 72, 41, 41, 41, 41, 41, 39, 75, 16, 97, 97, 16, 75,
+    39, 41, 41, 41, 41, 41, 29, 16, 67, 18, 16, 61, 41, 41, 41, 41, 41, 48, 16, 113,
+    113, 16, 107, 41, 41, 41, 41, 41, 34, 16, 18, 52, 16, 59, 40, 41, 41, 41, 41, 41,
+    28, 16, 81, 81, 16, 28, 41, 41, 41, 41, 41, 51, 45, 16, 52, 67, 16, 72, 41, 41,
+    41, 41, 41, 42, 68, 16, 87, 87, 16, 68, 42, 41, 41, 41, 41, 41, 73, 16, 67, 18,
+    16, 62, 41, 41, 41, 41, 41, 32, 16, 77, 77, 16, 69, 41, 41, 41, 41, 41, 34, 16,
+    18, 66, 16, 54, 40, 41, 41, 41, 41, 41, 55, 16, 105, 105, 16, 55, 41, 41, 41, 41,
+    41, 51, 54, 16, 66, 57, 16, 29, 41, 41, 41, 41, 41, 42, 16, 16, 103, 103, 16, 16,
+    42, 41, 41, 41, 41, 41, 29, 16, 57, 9, 16, 33, 41, 41, 41, 41, 41, 32, 16, 77,
+    77, 16, 32, 41, 41, 41, 41, 41, 48, 16, 9, 74, 15, 68, 39, 41, 41, 41, 41, 41,
+    28, 16, 108, 108, 16, 28, 41, 41, 41, 41, 41, 42, 16, 15, 74, 3, 16, 55, 41, 41,
+    41, 41, 41, 40, 68, 16, 117, 117, 16, 68, 40, 41, 41, 41, 41, 41, 27, 16, 3, 114,
+    16, 69, 41, 41, 41, 41, 41, 62, 16, 113, 76, 16, 62, 41, 41, 41, 41, 41, 47, 16,
+    114, 12, 16, 36, 41, 41, 41, 41, 41, 73, 16, 129, 122, 16, 73, 41, 41, 41, 41, 41,
+    35, 16, 12, 66, 16, 45, 41, 41, 41, 41, 41, 41, 26, 16, 84, 127, 16, 26, 41, 41,
+    41, 41, 41, 51, 106, 16, 66, 53, 16, 29, 41, 41, 41, 41, 41, 43, 16, 54, 112, 89,
+    75, 16, 43, 41, 41, 41, 41, 41, 72, 16, 53, 58, 16, 48, 41, 41, 41, 41, 41, 69,
+    16, 109, 78, 16, 69, 41, 41, 41, 41, 41, 48, 16, 58, 0, 14, 16, 38, 41, 41, 41,
+    41, 41, 28, 16, 105, 108, 16, 28, 41, 41, 41, 41, 41, 50, 16, 14, 0, 52, 16, 65,
+    41, 41, 41, 41, 41, 51, 59, 16, 86, 86, 16, 59, 51, 41, 41, 41, 41, 41, 26, 16,
+    52, 53, 16, 29, 41, 41, 41, 41, 41, 35, 16, 98, 98, 16, 35, 41, 41, 41, 41, 41,
+    72, 16, 53, 8, 16, 107, 41, 41, 41, 41, 41, 69, 16, 109, 109, 16, 31, 41, 41, 41,
+    41, 41, 69, 16, 8, 22, 16, 43, 41, 41, 41, 41, 41, 115, 16, 118, 118, 16, 115, 41,
+    41, 41, 41, 41, 35, 16, 22, 1, 16, 59, 41, 41, 41, 41, 41, 41, 106, 16, 85, 85,
+    16, 106, 41, 41, 41, 41, 41, 51, 75, 16, 1, 64, 16, 55, 41, 41, 41, 41, 41, 37,
+    16, 75, 112, 112, 75, 16, 37, 41, 41, 41, 41, 41, 55, 16, 3, 6, 16, 60, 41, 41,
+    41, 41, 41, 48, 16, 94, 94, 16, 48, 41, 41, 41, 41, 41, 60, 16, 6, 9, 16, 61,
+    41, 41, 41, 41, 41, 56, 16, 129, 129, 16, 56, 41, 41, 41, 41, 41, 61, 16, 9, 17,
+    16, 50, 41, 41, 41, 41, 41, 46, 16, 102, 102, 16, 27, 41, 41, 41, 41, 41, 50, 16,
+    17, 1, 16, 54, 41, 41, 41, 41, 41, 51, 75, 16, 103, 103, 16, 75, 51, 41, 41, 41,
+    41, 41, 106, 16, 1, 44, 16, 55, 41, 41, 41, 41, 41, 43, 16, 98, 98, 16, 43, 41,
+    41, 41, 41, 41, 55, 16, 3, 5, 16, 56, 41, 41, 41, 41, 41, 48, 16, 78, 78, 16,
+    48, 41, 41, 41, 41, 41, 56, 16, 5, 24, 16, 32, 41, 41, 41, 41, 41, 60, 16, 129,
+    80, 16, 60, 41, 41, 41, 41, 41, 32, 16, 24, 10, 16, 49, 41, 41, 41, 41, 41, 115,
+    16, 99, 99, 16, 28, 41, 41, 41, 41, 41, 49, 16, 10, 25, 16, 39, 41, 41, 41, 41,
+    41, 65, 16, 97, 97, 16, 65, 41, 41, 41, 41, 41, 39, 16, 25, 0, 1, 16, 45, 41,
+    41, 41, 41, 41, 40, 16, 68, 89, 89, 68, 16, 40, 41, 41, 41, 41, 41, 45, 16, 1,
+    93, 16, 46, 41, 41, 41, 41, 41, 43, 16, 76, 76, 16, 43, 41, 41, 41, 41, 41, 46,
+    16, 93, 4, 16, 29, 41, 41, 41, 41, 41, 62, 16, 78, 78, 16, 62, 41, 41, 41, 41,
+    41, 29, 16, 4, 6, 16, 47, 41, 41, 41, 41, 41, 69, 16, 95, 95, 16, 69, 41, 41,
+    41, 41, 41, 47, 16, 6, 20, 16, 48, 41, 41, 41, 41, 41, 30, 16, 96, 96, 16, 30,
+    41, 41, 41, 41, 41, 48, 16, 8, 21, 16, 49, 41, 41, 41, 41, 41, 115, 16, 83, 83,
+    16, 115, 41, 41, 41, 41, 41, 49, 16, 21, 22, 16, 50, 41, 41, 41, 41, 41, 70, 16,
+    97, 97, 16, 70, 41, 41, 41, 41, 41, 50, 16, 22, 0, 23, 16, 51, 41, 41, 41, 41,
+    41, 54, 16, 88, 88, 16, 54, 41, 41, 41, 41, 41, 51, 16, 23, 0, 1, 16, 45, 41,
+    41, 41, 41, 41, 39, 16, 75, 59, 16, 39, 41, 41, 41, 41, 41, 45, 16, 1, 2, 16,
+    70, 41, 41, 41, 41, 41, 36, 16, 76, 76, 16, 36, 41, 41, 41, 41, 41, 27, 16, 2,
+    3, 16, 55, 41, 41, 41, 41, 41, 34, 16, 77, 77, 16, 34, 41, 41, 41, 41, 41, 28,
+    16, 3, 4, 16, 72, 41, 41, 41, 41, 41, 48, 16, 109, 109, 16, 48, 41, 41, 41, 41,
+    41, 29, 16, 4, 5, 16, 56, 41, 41, 41, 41, 41, 69, 16, 95, 95, 16, 69, 41, 41,
+    41, 41, 41, 30, 16, 5, 119, 16, 60, 41, 41, 41, 41, 41, 60, 16, 101, 101, 16, 60,
+    41, 41, 41, 41, 41, 31, 16, 119, 7, 16, 69, 41, 41, 41, 41, 41, 73, 16, 108, 108,
+    16, 73, 41, 41, 41, 41, 41, 32, 16, 7, 8, 16, 48, 41, 41, 41, 41, 41, 72, 16,
+    99, 99, 16, 72, 41, 41, 41, 41, 41, 33, 16, 8, 9, 16, 34, 41, 41, 41, 41, 41,
+    55, 16, 102, 102, 16, 55, 41, 41, 41, 41, 41, 34, 16, 9, 21, 16, 49, 41, 41, 41,
+    41, 41, 27, 16, 84, 126, 16, 27, 41, 41, 41, 41, 41, 49, 16, 21, 18, 16, 36, 41,
+    41, 41, 41, 41, 70, 16, 97, 97, 16, 70, 41, 41, 41, 41, 41, 36, 16, 18, 12, 16,
+    36, 41, 41, 41, 41, 41, 65, 16, 123, 123, 16, 65, 41, 41, 41, 41, 41, 50, 16, 12,
+    13, 16, 50, 41, 41, 41, 41, 41, 26, 16, 117, 117, 16, 26, 41, 41, 41, 41, 41, 38,
+    16, 13, 14, 16, 50, 41, 41, 41, 41, 41, 59, 16, 90, 90, 16, 59, 41, 41, 41, 41,
+    41, 39, 16, 14, 14, 16, 42, 41, 41, 41, 41, 41, 59, 16, 90, 90, 16, 59, 41, 41,
+    41, 41, 41, 39, 16, 14, 25, 16, 39, 41, 41, 41, 41, 41, 68, 16, 124, 124, 16, 68,
+    41, 41, 41, 41, 41, 40, 16, 25, 16, 16, 39, 41, 41, 41, 41, 41, 16, 16, 16, 16,
+    41, 41, 41, 41, 41, 41, 16, 16, 16, 16, 41, 41, 41, 41, 41, 41, 16, 16, 16, 16,
+    41, 41, 41, 41, 41, 41, 16, 16, 16, 16, 41, 41, 41, 41, 41, 41, 16, 16, 16, 16,
+    41, 41, 41, 41, 41, 41, 16, 16, 14, 16, 39, 41, 41, 41, 41, 41, 59, 16, 90, 16,
+    16, 41, 41, 41, 41, 41, 41, 16, 16, 14, 16, 39, 41, 41, 41, 41, 41, 59, 16, 90,
+    124, 16, 68, 41, 41, 41, 41, 41, 40, 16, 25, 13, 16, 42, 41, 41, 41, 41, 41, 45,
+    16, 103, 90, 16, 59, 41, 41, 41, 41, 41, 39, 16, 14, 22, 16, 50, 41, 41, 41, 41,
+    41, 26, 16, 117, 90, 16, 59, 41, 41, 41, 41, 41, 39, 16, 14, 12, 16, 50, 41, 41,
+    41, 41, 41, 65, 16, 86, 117, 16, 26, 41, 41, 41, 41, 41, 38, 16, 13, 18, 16, 36,
+    41, 41, 41, 41, 41, 70, 16, 97, 123, 16, 65, 41, 41, 41, 41, 41, 50, 16, 12, 18,
+    16, 36, 41, 41, 41, 41, 41, 70, 16, 97, 97, 16, 70, 41, 41, 41, 41, 41, 36, 16,
+    18, 21, 16, 49, 41, 41, 41, 41, 41, 46, 16, 126, 126, 16, 27, 41, 41, 41, 41, 41,
+    35, 16, 21, 9, 16, 34, 41, 41, 41, 41, 41, 55, 16, 102, 102, 16, 55, 41, 41, 41,
+    41, 41, 34, 16, 9, 8, 16, 48, 41, 41, 41, 41, 41, 72, 16, 99, 99, 16, 72, 41,
+    41, 41, 41, 41, 33, 16, 8, 7, 16, 69, 41, 41, 41, 41, 41, 73, 16, 108, 108, 16,
+    73, 41, 41, 41, 41, 41, 32, 16, 7, 119, 16, 60, 41, 41, 41, 41, 41, 60, 16, 101,
+    101, 16, 60, 41, 41, 41, 41, 41, 31, 16, 119, 5, 16, 56, 41, 41, 41, 41, 41, 69,
+    16, 95, 95, 16, 69, 41, 41, 41, 41, 41, 30, 16, 5, 4, 16, 72, 41, 41, 41, 41,
+    41, 48, 16, 109, 109, 16, 48, 41, 41, 41, 41, 41, 29, 16, 4, 3, 16, 55, 41, 41,
+    41, 41, 41, 34, 16, 77, 77, 16, 34, 41, 41, 41, 41, 41, 28, 16, 3, 2, 16, 70,
+    41, 41, 41, 41, 41, 36, 16, 76, 76, 16, 36, 41, 41, 41, 41, 41, 27, 16, 2, 1,
+    16, 45, 41, 41, 41, 41, 41, 39, 16, 75, 59, 16, 39, 41, 41, 41, 41, 41, 45, 16,
+    1, 0, 23, 16, 51, 41, 41, 41, 41, 41, 54, 16, 88, 88, 16, 54, 41, 41, 41, 41,
+    41, 51, 16, 23, 0, 22, 16, 50, 41, 41, 41, 41, 41, 70, 16, 97, 97, 16, 70, 41,
+    41, 41, 41, 41, 50, 16, 22, 21, 16, 49, 41, 41, 41, 41, 41, 115, 16, 83, 83, 16,
+    115, 41, 41, 41, 41, 41, 49, 16, 21, 20, 16, 48, 41, 41, 41, 41, 41, 30, 16, 96,
+    96, 16, 30, 41, 41, 41, 41, 41, 48, 16, 8, 6, 16, 47, 41, 41, 41, 41, 41, 69,
+    16, 95, 95, 16, 69, 41, 41, 41, 41, 41, 31, 16, 6, 4, 16, 29, 41, 41, 41, 41,
+    41, 62, 16, 78, 78, 16, 62, 41, 41, 41, 41, 41, 29, 16, 4, 93, 16, 46, 41, 41,
+    41, 41, 41, 43, 16, 76, 76, 16, 43, 41, 41, 41, 41, 41, 46, 16, 19, 1, 16, 45,
+    41, 41, 41, 41, 41, 40, 16, 68, 89, 89, 68, 16, 40, 41, 41, 41, 41, 41, 45, 16,
+    1, 0, 25, 16, 39, 41, 41, 41, 41, 41, 65, 16, 97, 97, 16, 65, 41, 41, 41, 41,
+    41, 39, 16, 25, 0, 10, 16, 49, 41, 41, 41, 41, 41, 115, 16, 99, 99, 16, 28, 41,
+    41, 41, 41, 41, 49, 16, 10, 24, 16, 32, 41, 41, 41, 41, 41, 60, 16, 129, 129, 16,
+    30, 41, 41, 41, 41, 41, 32, 16, 24, 5, 16, 56, 41, 41, 41, 41, 41, 48, 16, 78,
+    78, 16, 48, 41, 41, 41, 41, 41, 56, 16, 5, 3, 16, 55, 41, 41, 41, 41, 41, 43,
+    16, 98, 98, 16, 43, 41, 41, 41, 41, 41, 55, 16, 3, 1, 16, 106, 41, 41, 41, 41,
+    41, 51, 75, 16, 103, 103, 16, 75, 51, 41, 41, 41, 41, 41, 106, 16, 1, 17, 16, 38,
+    41, 41, 41, 41, 41, 46, 16, 102, 102, 16, 27, 41, 41, 41, 41, 41, 50, 16, 17, 9,
+    16, 61, 41, 41, 41, 41, 41, 56, 16, 129, 129, 16, 56, 41, 41, 41, 41, 41, 61, 16,
+    9, 6, 16, 60, 41, 41, 41, 41, 41, 48, 16, 94, 94, 16, 48, 41, 41, 41, 41, 41,
+    60, 16, 6, 64, 16, 55, 41, 41, 41, 41, 41, 37, 16, 75, 112, 112, 75, 16, 37, 41,
+    41, 41, 41, 41, 55, 16, 64, 1, 16, 54, 41, 41, 41, 41, 41, 41, 106, 16, 85, 85,
+    16, 106, 41, 41, 41, 41, 41, 51, 75, 16, 1, 22, 16, 43, 41, 41, 41, 41, 41, 115,
+    16, 118, 118, 16, 115, 41, 41, 41, 41, 41, 35, 16, 22, 8, 16, 107, 41, 41, 41, 41,
+    41, 69, 16, 109, 109, 16, 31, 41, 41, 41, 41, 41, 69, 16, 8, 53, 16, 29, 41, 41,
+    41, 41, 41, 35, 16, 98, 98, 16, 35, 41, 41, 41, 41, 41, 72, 16, 53, 52, 16, 65,
+    41, 41, 41, 41, 41, 51, 59, 16, 86, 86, 16, 59, 51, 41, 41, 41, 41, 41, 26, 16,
+    52, 0, 14, 16, 38, 41, 41, 41, 41, 41, 28, 16, 105, 108, 16, 28, 41, 41, 41, 41,
+    41, 50, 16, 14, 0, 58, 16, 48, 41, 41, 41, 41, 41, 69, 16, 109, 78, 16, 69, 41,
+    41, 41, 41, 41, 48, 16, 58, 57, 16, 29, 41, 41, 41, 41, 41, 43, 16, 54, 112, 89,
+    75, 16, 43, 41, 41, 41, 41, 41, 29, 16, 57, 52, 16, 26, 41, 41, 41, 41, 41, 41,
+    26, 16, 84, 127, 16, 26, 41, 41, 41, 41, 41, 41, 26, 16, 52, 13, 16, 43, 41, 41,
+    41, 41, 41, 73, 16, 129, 122, 16, 73, 41, 41, 41, 41, 41, 43, 16, 13, 24, 16, 69,
+    41, 41, 41, 41, 41, 62, 16, 113, 76, 16, 62, 41, 41, 41, 41, 41, 69, 16, 24, 120,
+    16, 55, 41, 41, 41, 41, 41, 40, 68, 16, 117, 117, 16, 68, 40, 41, 41, 41, 41, 41,
+    55, 16, 120, 63, 23, 68, 39, 41, 41, 41, 41, 41, 28, 16, 108, 108, 16, 28, 41, 41,
+    41, 41, 41, 39, 68, 23, 63, 21, 16, 33, 41, 41, 41, 41, 41, 32, 16, 77, 94, 16,
+    32, 41, 41, 41, 41, 41, 33, 16, 21, 57, 16, 29, 41, 41, 41, 41, 41, 42, 16, 16,
+    103, 103, 16, 16, 42, 41, 41, 41, 41, 41, 29, 16, 5, 66, 16, 54, 40, 41, 41, 41,
+    41, 41, 55, 16, 105, 105, 16, 55, 41, 41, 41, 41, 41, 51, 54, 16, 66, 18, 16, 62,
+    41, 41, 41, 41, 41, 69, 16, 77, 94, 16, 69, 41, 41, 41, 41, 41, 34, 16, 18, 67,
+    16, 72, 41, 41, 41, 41, 41, 42, 68, 16, 87, 87, 16, 68, 42, 41, 41, 41, 41, 41,
+    73, 16, 67, 52, 16, 59, 40, 41, 41, 41, 41, 41, 28, 16, 81, 118, 16, 28, 41, 41,
+    41, 41, 41, 51, 45, 16, 52, 18, 16, 61, 41, 41, 41, 41, 41, 107, 16, 113, 113, 16,
+    107, 41, 41, 41, 41, 41, 34, 16, 18, 67, 16, 72, 41, 41, 41, 41, 41, 39, 75, 16,
+    97, 97, 16, 75, 39, 41, 41, 41, 41, 41, 29, 16, 67, 66, 16, 75, 40, 41, 41, 41,
+    41, 41, 29, 16, 122, 122, 16, 29, 41, 41, 41, 41, 41, 40, 59, 16, 66, 21, 16, 33,
+    41, 41, 41, 41, 41, 49, 16, 106, 89, 89, 106, 16, 49, 41, 41, 41, 41, 41, 33, 16,
+    21, 53, 16, 28, 41, 41, 41, 41, 41, 41, 65, 16, 121, 121, 16, 65, 41, 41, 41, 41,
+    41, 41, 28, 16, 53, 63, 15, 16, 38, 41, 41, 41, 41, 41, 31, 16, 94, 94, 16, 31,
+    41, 41, 41, 41, 41, 38, 16, 15, 63, 20, 16, 31, 41, 41, 41, 41, 41, 42, 68, 16,
+    123, 123, 16, 68, 42, 41, 41, 41, 41, 41, 31, 16, 8, 44, 16, 65, 41, 41, 41, 41,
+    41, 41, 72, 16, 122, 122, 16, 72, 41, 41, 41, 41, 41, 41, 65, 16, 44, 0, 22, 16,
+    34, 41, 41, 41, 41, 41, 49, 16, 54, 124, 124, 59, 16, 49, 41, 41, 41, 41, 41, 34,
+    16, 22, 0, 67, 16, 115, 41, 41, 41, 41, 41, 41, 71, 16, 105, 96, 16, 70, 41, 41,
+    41, 41, 41, 41, 115, 16, 67, 110, 15, 68, 38, 41, 41, 41, 41, 41, 32, 16, 76, 0,
+    112, 76, 16, 32, 41, 41, 41, 41, 41, 38, 68, 15, 110, 8, 16, 60, 41, 41, 41, 41,
+    41, 40, 106, 16, 102, 99, 16, 106, 40, 41, 41, 41, 41, 41, 60, 16, 8, 93, 16, 106,
+    40, 41, 41, 41, 41, 41, 60, 16, 77, 113, 16, 60, 41, 41, 41, 41, 41, 40, 45, 16,
+    93, 11, 16, 107, 41, 41, 41, 41, 41, 42, 68, 16, 84, 127, 16, 68, 42, 41, 41, 41,
+    41, 41, 107, 16, 11, 120, 16, 70, 41, 41, 41, 41, 41, 41, 56, 16, 78, 78, 16, 56,
+    41, 41, 41, 41, 41, 41, 70, 16, 120, 112, 13, 16, 34, 41, 41, 41, 41, 41, 50, 68,
+    16, 97, 97, 16, 68, 50, 41, 41, 41, 41, 41, 34, 16, 13, 112, 5, 16, 55, 41, 41,
+    41, 41, 41, 41, 29, 16, 109, 109, 16, 29, 41, 41, 41, 41, 41, 41, 55, 16, 5, 63,
+    14, 16, 35, 41, 41, 41, 41, 41, 50, 68, 16, 97, 85, 16, 68, 50, 41, 41, 41, 41,
+    41, 35, 16, 14, 63, 6, 16, 72, 41, 41, 41, 41, 41, 41, 73, 16, 109, 78, 16, 73,
+    41, 41, 41, 41, 41, 41, 72, 16, 6, 110, 25, 16, 43, 41, 41, 41, 41, 41, 38, 68,
+    16, 97, 84, 16, 68, 38, 41, 41, 41, 41, 41, 36, 16, 15, 110, 114, 16, 72, 41, 41,
+    41, 41, 41, 41, 56, 16, 78, 94, 16, 56, 41, 41, 41, 41, 41, 41, 115, 16, 114, 1,
+    15, 16, 43, 41, 41, 41, 41, 41, 38, 68, 16, 126, 126, 16, 68, 38, 41, 41, 41, 41,
+    41, 35, 16, 15, 1, 114, 16, 72, 41, 41, 41, 41, 41, 41, 30, 16, 113, 0, 0, 113,
+    16, 30, 41, 41, 41, 41, 41, 41, 28, 16, 114, 1, 25, 16, 35, 41, 41, 41, 41, 41,
+    42, 54, 16, 99, 99, 16, 59, 42, 41, 41, 41, 41, 41, 49, 16, 25, 1, 119, 16, 28,
+    41, 41, 41, 41, 41, 41, 69, 16, 98, 124, 124, 98, 16, 31, 41, 41, 41, 41, 41, 41,
+    55, 16, 119, 63, 14, 16, 49, 41, 41, 41, 41, 41, 51, 71, 16, 129, 129, 16, 26, 40,
+    41, 41, 41, 41, 41, 49, 16, 14, 63, 67, 16, 27, 41, 41, 41, 41, 41, 41, 62, 16,
+    68, 117, 117, 68, 16, 48, 41, 41, 41, 41, 41, 41, 27, 16, 67, 74, 13, 16, 48, 41,
+    41, 41, 41, 41, 41, 55, 16, 109, 109, 16, 46, 41, 41, 41, 41, 41, 41, 48, 16, 13,
+    74, 4, 16, 26, 39, 41, 41, 41, 41, 41, 43, 68, 16, 126, 126, 16, 16, 35, 41, 41,
+    41, 41, 41, 40, 26, 16, 4, 0, 18, 16, 60, 41, 41, 41, 41, 41, 41, 56, 16, 113,
+    112, 89, 113, 16, 73, 41, 41, 41, 41, 41, 41, 60, 16, 18, 0, 44, 16, 68, 50, 41,
+    41, 41, 41, 41, 39, 45, 16, 81, 101, 16, 45, 39, 41, 41, 41, 41, 41, 50, 68, 16,
+    44, 125, 16, 72, 41, 41, 41, 41, 41, 41, 48, 16, 68, 116, 92, 68, 16, 48, 41, 41,
+    41, 41, 41, 41, 72, 16, 125, 66, 25, 16, 49, 41, 41, 41, 41, 41, 41, 55, 16, 94,
+    0, 77, 16, 55, 41, 41, 41, 41, 41, 41, 49, 16, 25, 66, 111, 16, 70, 51, 41, 41,
+    41, 41, 41, 37, 75, 16, 82, 108, 16, 75, 37, 41, 41, 41, 41, 41, 51, 70, 16, 111,
+    74, 12, 16, 31, 41, 41, 41, 41, 41, 41, 69, 16, 54, 87, 117, 59, 16, 69, 41, 41,
+    41, 41, 41, 41, 31, 16, 12, 74, 44, 16, 75, 50, 41, 41, 41, 41, 41, 51, 46, 16,
+    78, 78, 16, 46, 51, 41, 41, 41, 41, 41, 50, 75, 16, 44, 20, 16, 28, 41, 41, 41,
+    41, 41, 41, 43, 68, 16, 105, 105, 16, 68, 43, 41, 41, 41, 41, 41, 41, 28, 16, 20,
+    110, 14, 16, 48, 41, 41, 41, 41, 41, 41, 69, 16, 75, 86, 86, 75, 16, 69, 41, 41,
+    41, 41, 41, 41, 48, 16, 14, 110, 4, 16, 106, 42, 41, 41, 41, 41, 41, 41, 55, 16,
+    77, 112, 112, 77, 16, 55, 41, 41, 41, 41, 41, 41, 42, 106, 16, 4, 9, 16, 72, 41,
+    41, 41, 41, 41, 41, 38, 54, 16, 129, 101, 16, 54, 38, 41, 41, 41, 41, 41, 41, 72,
+    16, 9, 1, 14, 16, 33, 41, 41, 41, 41, 41, 41, 33, 16, 16, 126, 126, 16, 16, 33,
+    41, 41, 41, 41, 41, 41, 33, 16, 14, 1, 4, 16, 54, 38, 41, 41, 41, 41, 41, 41,
+    73, 16, 98, 91, 91, 98, 16, 73, 41, 41, 41, 41, 41, 41, 38, 54, 16, 4, 58, 16,
+    55, 41, 41, 41, 41, 41, 41, 40, 71, 16, 94, 0, 0, 94, 16, 71, 40, 41, 41, 41,
+    41, 41, 41, 55, 16, 58, 110, 17, 16, 69, 41, 41, 41, 41, 41, 41, 36, 68, 16, 129,
+    129, 16, 68, 36, 41, 41, 41, 41, 41, 41, 69, 16, 17, 110, 3, 16, 68, 36, 41, 41,
+    41, 41, 41, 41, 107, 16, 16, 83, 83, 16, 16, 107, 41, 41, 41, 41, 41, 41, 36, 68,
+    16, 3, 114, 16, 71, 39, 41, 41, 41, 41, 41, 41, 73, 16, 59, 123, 123, 59, 16, 73,
+    41, 41, 41, 41, 41, 41, 40, 71, 16, 114, 112, 18, 16, 29, 41, 41, 41, 41, 41, 41,
+    40, 27, 16, 76, 124, 124, 76, 16, 27, 40, 41, 41, 41, 41, 41, 41, 29, 16, 18, 112,
+    52, 25, 16, 107, 41, 41, 41, 41, 41, 41, 38, 106, 16, 109, 109, 16, 106, 38, 41, 41,
+    41, 41, 41, 41, 48, 16, 25, 52, 4, 16, 68, 36, 41, 41, 41, 41, 41, 41, 49, 68,
+    16, 101, 101, 16, 68, 49, 41, 41, 41, 41, 41, 41, 43, 68, 16, 4, 7, 16, 65, 39,
+    41, 41, 41, 41, 41, 41, 32, 16, 16, 121, 121, 16, 16, 32, 41, 41, 41, 41, 41, 41,
+    39, 71, 16, 7, 112, 11, 16, 115, 41, 41, 41, 41, 41, 41, 41, 30, 16, 68, 84, 84,
+    68, 16, 30, 41, 41, 41, 41, 41, 41, 41, 115, 16, 11, 74, 66, 14, 16, 47, 41, 41,
+    41, 41, 41, 41, 41, 72, 16, 106, 123, 123, 98, 16, 72, 41, 41, 41, 41, 41, 41, 41,
+    47, 16, 14, 66, 44, 23, 16, 61, 41, 41, 41, 41, 41, 41, 40, 27, 16, 76, 103, 103,
+    76, 16, 27, 40, 41, 41, 41, 41, 41, 41, 61, 16, 23, 44, 57, 16, 59, 36, 41, 41,
+    41, 41, 41, 41, 42, 65, 16, 113, 124, 124, 113, 16, 65, 42, 41, 41, 41, 41, 41, 41,
+    36, 59, 16, 57, 24, 16, 26, 38, 41, 41, 41, 41, 41, 41, 37, 106, 16, 94, 89, 89,
+    94, 16, 106, 37, 41, 41, 41, 41, 41, 41, 38, 26, 16, 24, 112, 21, 16, 70, 39, 41,
+    41, 41, 41, 41, 41, 49, 68, 16, 109, 112, 112, 109, 16, 68, 49, 41, 41, 41, 41, 41,
+    41, 39, 70, 16, 21, 112, 110, 12, 16, 28, 51, 41, 41, 41, 41, 41, 41, 34, 68, 16,
+    104, 0, 0, 104, 16, 68, 34, 41, 41, 41, 41, 41, 41, 51, 28, 16, 12, 110, 52, 14,
+    16, 73, 41, 41, 41, 41, 41, 41, 41, 62, 68, 16, 79, 0, 0, 79, 16, 68, 62, 41,
+    41, 41, 41, 41, 41, 41, 73, 16, 14, 52, 19, 15, 16, 31, 41, 41, 41, 41, 41, 41,
+    41, 33, 16, 16, 122, 122, 16, 16, 33, 41, 41, 41, 41, 41, 41, 41, 31, 16, 15, 19,
+    120, 16, 16, 48, 41, 41, 41, 41, 41, 41, 41, 107, 16, 16, 129, 129, 16, 16, 107, 41,
+    41, 41, 41, 41, 41, 41, 48, 16, 16, 120, 5, 16, 68, 62, 41, 41, 41, 41, 41, 41,
+    41, 69, 16, 16, 80, 80, 16, 16, 69, 41, 41, 41, 41, 41, 41, 41, 62, 68, 16, 5,
+    6, 16, 68, 49, 41, 41, 41, 41, 41, 41, 41, 69, 16, 16, 122, 0, 122, 16, 16, 69,
+    41, 41, 41, 41, 41, 41, 41, 49, 68, 16, 6, 114, 16, 59, 35, 41, 41, 41, 41, 41,
+    41, 41, 32, 16, 16, 79, 0, 0, 79, 16, 16, 32, 41, 41, 41, 41, 41, 41, 41, 35,
+    59, 16, 114, 0, 24, 16, 54, 35, 41, 41, 41, 41, 41, 41, 41, 107, 16, 16, 104, 89,
+    89, 104, 16, 16, 107, 41, 41, 41, 41, 41, 41, 41, 35, 54, 16, 20, 0, 0, 8, 16,
+    106, 36, 41, 41, 41, 41, 41, 41, 41, 33, 68, 16, 78, 124, 124, 78, 16, 68, 33, 41,
+    41, 41, 41, 41, 41, 41, 36, 106, 16, 8, 0, 112, 125, 16, 106, 36, 41, 41, 41, 41,
+    41, 41, 41, 34, 75, 16, 113, 91, 91, 113, 16, 75, 34, 41, 41, 41, 41, 41, 41, 41,
+    36, 106, 16, 125, 112, 112, 58, 16, 106, 35, 41, 41, 41, 41, 41, 41, 41, 49, 54, 16,
+    76, 86, 116, 76, 16, 54, 49, 41, 41, 41, 41, 41, 41, 41, 35, 106, 16, 58, 112, 112,
+    125, 16, 54, 35, 41, 41, 41, 41, 41, 41, 41, 43, 65, 16, 106, 85, 85, 106, 16, 65,
+    43, 41, 41, 41, 41, 41, 41, 41, 35, 54, 16, 125, 112, 112, 8, 16, 59, 49, 41, 41,
+    41, 41, 41, 41, 41, 42, 70, 16, 75, 121, 121, 75, 16, 70, 42, 41, 41, 41, 41, 41,
+    41, 41, 49, 59, 16, 8, 112, 0, 20, 16, 68, 62, 41, 41, 41, 41, 41, 41, 41, 39,
+    28, 16, 16, 101, 101, 16, 16, 28, 39, 41, 41, 41, 41, 41, 41, 41, 62, 68, 16, 20,
+    0, 0, 114, 16, 68, 48, 41, 41, 41, 41, 41, 41, 41, 51, 56, 16, 16, 104, 124, 124,
+    104, 16, 16, 56, 51, 41, 41, 41, 41, 41, 41, 41, 48, 68, 16, 114, 0, 111, 16, 16,
+    31, 41, 41, 41, 41, 41, 41, 41, 41, 32, 68, 16, 113, 117, 117, 113, 16, 68, 32, 41,
+    41, 41, 41, 41, 41, 41, 41, 69, 16, 16, 111, 57, 16, 16, 73, 51, 41, 41, 41, 41,
+    41, 41, 41, 49, 26, 16, 54, 127, 127, 54, 16, 45, 49, 41, 41, 41, 41, 41, 41, 41,
+    51, 56, 16, 16, 57, 64, 15, 16, 28, 39, 41, 41, 41, 41, 41, 41, 41, 42, 46, 16,
+    16, 101, 0, 0, 101, 16, 16, 27, 38, 41, 41, 41, 41, 41, 41, 41, 40, 72, 16, 15,
+    64, 93, 14, 16, 70, 38, 41, 41, 41, 41, 41, 41, 41, 51, 30, 16, 16, 78, 91, 91,
+    78, 16, 16, 73, 40, 41, 41, 41, 41, 41, 41, 41, 42, 27, 16, 14, 19, 52, 12, 16,
+    26, 35, 41, 41, 41, 41, 41, 41, 41, 41, 33, 75, 16, 98, 127, 127, 98, 16, 68, 107,
+    41, 41, 41, 41, 41, 41, 41, 41, 36, 26, 16, 12, 52, 110, 21, 16, 59, 61, 41, 41,
+    41, 41, 41, 41, 41, 41, 36, 71, 16, 16, 80, 89, 89, 80, 16, 16, 71, 36, 41, 41,
+    41, 41, 41, 41, 41, 41, 61, 59, 16, 21, 110, 112, 24, 16, 16, 30, 51, 41, 41, 41,
+    41, 41, 41, 41, 40, 56, 16, 16, 113, 92, 92, 113, 16, 16, 56, 40, 41, 41, 41, 41,
+    41, 41, 41, 51, 30, 16, 16, 24, 112, 57, 23, 16, 55, 42, 41, 41, 41, 41, 41, 41,
+    41, 41, 62, 45, 16, 68, 105, 105, 68, 16, 45, 62, 41, 41, 41, 41, 41, 41, 41, 41,
+    42, 55, 16, 23, 57, 44, 14, 16, 26, 35, 41, 41, 41, 41, 41, 41, 41, 41, 42, 28,
+    16, 16, 78, 87, 87, 78, 16, 16, 28, 42, 41, 41, 41, 41, 41, 41, 41, 41, 35, 26,
+    16, 14, 44, 66, 11, 16, 68, 32, 41, 41, 41, 41, 41, 41, 41, 41, 41, 69, 68, 16,
+    54, 82, 82, 54, 16, 68, 69, 41, 41, 41, 41, 41, 41, 41, 41, 41, 32, 68, 16, 11,
+    66, 112, 7, 16, 16, 29, 39, 41, 41, 41, 41, 41, 41, 41, 41, 43, 46, 16, 16, 94,
+    116, 116, 94, 16, 16, 46, 43, 41, 41, 41, 41, 41, 41, 41, 41, 39, 29, 16, 16, 7,
+    112, 4, 25, 16, 65, 35, 41, 41, 41, 41, 41, 41, 41, 41, 51, 69, 68, 16, 68, 81,
+    112, 112, 81, 68, 16, 68, 69, 51, 41, 41, 41, 41, 41, 41, 41, 41, 35, 65, 16, 25,
+    4, 52, 18, 16, 68, 47, 51, 41, 41, 41, 41, 41, 41, 41, 41, 37, 55, 16, 16, 113,
+    84, 126, 113, 16, 16, 55, 37, 41, 41, 41, 41, 41, 41, 41, 41, 51, 47, 68, 16, 18,
+    52, 112, 114, 16, 16, 46, 50, 41, 41, 41, 41, 41, 41, 41, 41, 41, 48, 45, 16, 16,
+    104, 87, 87, 104, 16, 16, 45, 48, 41, 41, 41, 41, 41, 41, 41, 41, 41, 50, 46, 16,
+    16, 114, 112, 3, 17, 16, 59, 48, 41, 41, 41, 41, 41, 41, 41, 41, 41, 39, 73, 68,
+    16, 75, 81, 89, 89, 81, 59, 16, 68, 73, 39, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    48, 59, 16, 17, 3, 110, 58, 16, 16, 72, 42, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    35, 46, 16, 16, 76, 99, 0, 0, 99, 76, 16, 16, 46, 35, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 42, 72, 16, 16, 58, 110, 4, 14, 16, 54, 48, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 48, 26, 16, 16, 113, 126, 126, 113, 16, 16, 26, 48, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 48, 54, 16, 14, 4, 1, 125, 16, 16, 28, 50, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 40, 31, 54, 16, 16, 78, 97, 97, 78, 16, 16, 54, 31, 40,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 50, 28, 16, 16, 125, 1, 64, 13, 16, 75, 31,
+    51, 41, 41, 41, 41, 41, 41, 41, 41, 41, 42, 56, 68, 16, 16, 109, 92, 92, 109, 16,
+    16, 68, 56, 42, 41, 41, 41, 41, 41, 41, 41, 41, 41, 51, 31, 75, 16, 13, 64, 63,
+    7, 16, 16, 70, 49, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 50, 29, 68, 16, 16,
+    109, 97, 97, 109, 16, 16, 68, 29, 50, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 49,
+    70, 16, 16, 7, 63, 19, 12, 16, 16, 29, 38, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 43, 29, 16, 16, 16, 78, 84, 84, 78, 16, 16, 16, 72, 43, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 38, 29, 16, 16, 12, 19, 112, 67, 25, 16, 59, 31, 40, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 37, 29, 68, 16, 16, 77, 102, 0, 0, 102, 77, 16,
+    16, 68, 29, 37, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 40, 31, 59, 16, 25, 111,
+    112, 66, 125, 16, 16, 65, 33, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 50, 56,
+    68, 16, 16, 76, 105, 124, 124, 105, 76, 16, 16, 68, 56, 50, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 33, 65, 16, 16, 125, 66, 44, 18, 16, 16, 27, 49, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 42, 60, 106, 16, 16, 54, 122, 123, 123, 122, 54, 16,
+    16, 106, 60, 42, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 49, 27, 16, 16, 18,
+    44, 0, 4, 13, 16, 16, 28, 36, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 40,
+    32, 70, 16, 16, 16, 94, 121, 89, 89, 121, 94, 16, 16, 16, 70, 32, 40, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 36, 28, 16, 16, 13, 4, 0, 74, 67, 14, 16, 16,
+    72, 43, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 34, 72, 68, 16, 16, 106,
+    95, 97, 97, 95, 106, 16, 16, 68, 72, 34, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 43, 72, 16, 16, 14, 67, 74, 63, 119, 25, 16, 16, 72, 43, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 42, 31, 65, 16, 16, 16, 113, 81, 128, 128, 81, 113,
+    16, 16, 16, 65, 31, 42, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 43, 72,
+    16, 16, 25, 119, 63, 1, 114, 15, 16, 16, 72, 35, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 49, 29, 75, 16, 16, 16, 113, 118, 117, 87, 118, 113, 16, 16, 16,
+    75, 29, 49, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 35, 72, 16, 16,
+    15, 114, 1, 1, 114, 25, 16, 16, 55, 34, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 39, 48, 115, 68, 16, 16, 16, 77, 96, 128, 117, 96, 77, 16, 16, 16, 68,
+    115, 48, 39, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 34, 55, 16, 16,
+    25, 114, 1, 110, 111, 14, 16, 16, 70, 107, 40, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 39, 107, 28, 68, 16, 16, 16, 76, 122, 127, 89, 0, 84, 129, 113, 16,
+    16, 16, 68, 28, 107, 39, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 40,
+    107, 70, 16, 16, 14, 111, 110, 74, 53, 12, 16, 16, 45, 60, 38, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 39, 107, 28, 68, 16, 16, 16, 75, 78, 108, 86,
+    86, 105, 109, 54, 16, 16, 16, 68, 28, 107, 39, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 38, 47, 45, 16, 16, 12, 53, 74, 0, 64, 21, 16, 16, 68, 115,
+    34, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 40, 62, 73, 26,
+    16, 16, 16, 16, 98, 104, 105, 123, 123, 105, 104, 98, 16, 16, 16, 16, 26, 73, 62, 40,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 34, 115, 68, 16, 16,
+    21, 64, 0, 93, 8, 15, 16, 16, 65, 31, 38, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 43, 69, 28, 59, 16, 16, 16, 16, 54, 78, 101, 102, 103,
+    103, 102, 101, 78, 54, 16, 16, 16, 16, 59, 28, 69, 43, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 38, 31, 65, 16, 16, 15, 8, 93, 110, 67, 22,
+    16, 16, 16, 28, 33, 40, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 51, 36, 69, 72, 65, 16, 16, 16, 16, 16, 98, 78, 129, 99, 97, 89, 89, 97,
+    99, 129, 78, 98, 16, 16, 16, 16, 16, 26, 72, 69, 36, 51, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 40, 33, 28, 16, 16, 16, 22, 67, 110, 0,
+    44, 8, 15, 16, 16, 75, 72, 61, 40, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 38, 33, 56, 46, 75, 16, 16, 16, 16, 16, 68, 76, 78,
+    95, 96, 83, 97, 88, 88, 97, 83, 96, 95, 78, 76, 68, 16, 16, 16, 16, 16, 75, 46,
+    56, 33, 38, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 40, 61, 72, 75, 16, 16, 15, 8, 44, 0, 63, 53, 21, 16, 16, 16, 59, 29, 62,
+    40, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    51, 43, 48, 60, 28, 65, 16, 16, 16, 16, 16, 16, 16, 16, 59, 76, 77, 78, 79, 80,
+    81, 82, 83, 84, 85, 86, 87, 88, 88, 89, 89, 88, 88, 87, 86, 85, 84, 83, 82, 81,
+    80, 79, 78, 77, 76, 59, 16, 16, 16, 16, 16, 16, 16, 16, 65, 28, 30, 48, 43, 51,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 40,
+    62, 29, 59, 16, 16, 16, 21, 53, 63, 1, 57, 10, 16, 16, 16, 54, 29, 61, 39, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 40, 36, 61, 31, 73, 55, 71, 68, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 68, 71, 55, 73, 31, 61, 36, 40, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 39, 61, 29, 54, 16,
+    16, 16, 10, 57, 1, 66, 5, 11, 16, 16, 16, 68, 55, 69, 43, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 42, 36, 49, 61, 32, 47, 56, 29, 28, 27, 70, 65, 45, 54, 54, 68, 16, 16,
+    16, 16, 68, 54, 54, 45, 65, 70, 27, 55, 72, 73, 60, 69, 48, 34, 36, 42, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 43, 69, 55, 68, 16, 16, 16, 11, 5, 66, 66, 57, 9, 23, 16,
+    16, 16, 26, 29, 48, 38, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 38, 48, 29, 26, 16, 16, 16, 23, 9, 5, 66, 63,
+    120, 24, 13, 16, 16, 16, 16, 65, 29, 107, 43, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 43, 107, 29, 65, 16, 16, 16, 16, 13, 24, 120, 63, 52, 57, 58,
+    14, 16, 16, 16, 16, 54, 28, 60, 62, 50, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 50, 62, 60, 28, 54, 16,
+    16, 16, 16, 14, 58, 57, 52, 0, 52, 53, 8, 22, 16, 16, 16, 16, 16, 106, 55, 30,
+    32, 49, 39, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 39, 49, 32, 30, 55,
+    106, 16, 16, 16, 16, 16, 22, 8, 53, 52, 0, 1, 3, 6, 9, 17, 16, 16, 16, 16,
+    16, 16, 45, 46, 29, 47, 48, 49, 38, 51, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 51, 38, 49, 48, 47, 29, 46, 45, 16, 16, 16, 16, 16, 16,
+    17, 9, 6, 3, 1, 1, 3, 5, 24, 10, 25, 16, 16, 16, 16, 16, 16, 16, 16, 26,
+    27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 42, 39, 39, 40, 41, 41, 41, 41, 40,
+    39, 39, 42, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 16, 16, 16, 16, 16,
+    16, 16, 16, 25, 10, 24, 5, 3, 1, 0, 1, 19, 4, 6, 20, 21, 13, 23, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 23, 13, 21, 20, 6, 4,
+    19, 1, 0, 0, 1, 2, 3, 4, 5, 119, 7, 8, 9, 10, 18, 12, 13, 14, 14, 15,
+    16, 16, 16, 16, 15, 14, 14, 13, 12, 18, 10, 9, 8, 7, 119, 5, 4, 3, 2, 1,
+    0,
+};
+
+
+//! Mask@2+s.png, 374x374, 25982 non transparent pixels
+static const uint32_t MASK_2_SHADOW_PALETTE[] =
+{
+    0x03010101, 0x07030303, 0x0C060606, 0x0E070707, 0x11080808, 0x140A0A0A,
+    0x190C0C0C, 0x1D0E0E0E, 0x21101010, 0x25121212, 0x29141414, 0x2D161616,
+    0x31181818, 0x351A1A1A, 0x381C1C1C, 0x3C1E1E1E, 0x40202020, 0x44222222,
+    0x48242424, 0x4C262626, 0x4F272727, 0x52292929, 0x562A2B2A, 0x5A2C2D2C,
+    0x62303130, 0x803F403F, 0x9B4D4D4D, 0xAD555555, 0xC2606060, 0xD2686868,
+    0xDE6E6E6E, 0xE5717171, 0xEE767676, 0xF5797979, 0xFB7C7C7C, 0xFF7E7E7E,
+    0xA6525252, 0x7A3C3D3C, 0xEA747474, 0xFF818181, 0xFF8B8B8B, 0xFF989898,
+    0xFFA4A4A4, 0xFFAFAFAF, 0xFFB8B8B8, 0xFFC4C4C4, 0xFFCDCDCD, 0xFFD5D5D5,
+    0xFFDDDDDD, 0xFFE4E4E4, 0xFFE8E8E8, 0xFFEEEEEE, 0xFFF1F1F1, 0xFFF7F7F7,
+    0xFFFBFBFB, 0xFFFFFFFF, 0xFFF3F3F3, 0xFFEAEAEA, 0xB3585858, 0xF1777777,
+    0xFF9C9C9C, 0xFFC1C1C1, 0xFFD1D1D1, 0xFFE1E1E1, 0x92484948, 0xCB646464,
+    0xFF888888, 0xFFA0A0A0, 0xFF858585, 0xFFBDBDBD, 0xFFD8D8D8, 0x71383838,
+    0xBA5C5C5C, 0xFF909090, 0xFFCFCFCF, 0xFFC7C7C7, 0xFFB3B3B3, 0xFFABABAB,
+    0xFF959595, 0x89444444, 0xFFA7A7A7, 0xD76A6A6A, 0x69343434, 0xFF8D8D8D,
+};
+
+static const uint16_t MASK_2_SHADOW_RUNS[] =
+{
+    1, 171, 32, 2, 161, 52, 3, 154, 66, 4, 149, 76,
+    5, 144, 86, 6, 140, 94, 7, 136, 102, 8, 132, 110,
+    9, 129, 116, 10, 126, 122, 11, 123, 128, 12, 120, 134,
+    13, 117, 140, 14, 115, 144, 15, 112, 150, 16, 110, 154,
+    17, 108, 158, 18, 106, 162, 19, 103, 168, 20, 101, 172,
+    21, 99, 176, 22, 97, 180, 23, 96, 89, 23, 188, 90,
+    24, 94, 75, 24, 205, 75, 25, 92, 70, 25, 212, 70,
+    26, 90, 66, 26, 218, 66, 27, 89, 62, 27, 223, 62,
+    28, 87, 60, 28, 227, 60, 29, 85, 58, 29, 231, 58,
+    30, 84, 56, 30, 234, 56, 31, 82, 55, 31, 237, 55,
+    32, 81, 53, 32, 240, 53, 33, 79, 52, 33, 243, 52,
+    34, 78, 50, 34, 246, 50, 35, 76, 50, 35, 248, 50,
+    36, 75, 48, 36, 251, 48, 37, 74, 47, 37, 253, 47,
+    38, 72, 47, 38, 255, 47, 39, 71, 46, 39, 257, 46,
+    40, 70, 45, 40, 259, 45, 41, 69, 44, 41, 261, 44,
+    42, 67, 44, 42, 263, 44, 43, 66, 43, 43, 265, 43,
+    44, 65, 42, 44, 267, 42, 45, 64, 41, 45, 269, 41,
+    46, 63, 41, 46, 270, 41, 47, 62, 40, 47, 272, 40,
+    48, 60, 40, 48, 274, 40, 49, 59, 40, 49, 275, 40,
+    50, 58, 39, 50, 277, 39, 51, 57, 39, 51, 278, 39,
+    52, 56, 38, 52, 280, 38, 53, 55, 38, 53, 281, 38,
+    54, 54, 38, 54, 282, 38, 55, 53, 37, 55, 284, 37,
+    56, 52, 37, 56, 285, 37, 57, 51, 37, 57, 286, 37,
+    58, 50, 36, 58, 288, 36, 59, 49, 36, 59, 289, 36,
+    60, 48, 36, 60, 290, 36, 61, 48, 35, 61, 291, 35,
+    62, 47, 34, 62, 293, 34, 63, 46, 34, 63, 294, 34,
+    64, 45, 34, 64, 295, 34, 65, 44, 34, 65, 296, 34,
+    66, 43, 34, 66, 297, 34, 67, 42, 34, 67, 298, 34,
+    68, 42, 33, 68, 299, 33, 69, 41, 33, 69, 300, 33,
+    70, 40, 33, 70, 301, 33, 71, 39, 33, 71, 302, 33,
+    72, 38, 33, 72, 303, 33, 73, 38, 32, 73, 304, 32,
+    74, 37, 32, 74, 305, 32, 75, 36, 32, 75, 306, 32,
+    76, 35, 32, 76, 307, 32, 77, 35, 31, 77, 308, 31,
+    78, 34, 31, 78, 309, 31, 79, 33, 31, 79, 310, 31,
+    80, 33, 30, 80, 311, 30, 81, 32, 30, 81, 312, 30,
+    82, 31, 31, 82, 312, 31, 83, 31, 30, 83, 313, 30,
+    84, 30, 30, 84, 314, 30, 85, 29, 30, 85, 315, 30,
+    86, 29, 29, 86, 316, 29, 87, 28, 30, 87, 316, 30,
+    88, 28, 29, 88, 317, 29, 89, 27, 29, 89, 318, 29,
+    90, 26, 29, 90, 319, 29, 91, 26, 29, 91, 319, 29,
+    92, 25, 29, 92, 320, 29, 93, 25, 28, 93, 321, 28,
+    94, 24, 28, 94, 322, 28, 95, 24, 28, 95, 322, 28,
+    96, 23, 28, 96, 323, 28, 97, 22, 28, 97, 324, 28,
+    98, 22, 28, 98, 324, 28, 99, 21, 28, 99, 325, 28,
+    100, 21, 27, 100, 326, 27, 101, 20, 28, 101, 326, 28,
+    102, 20, 27, 102, 327, 27, 103, 19, 28, 103, 327, 28,
+    104, 19, 27, 104, 328, 27, 105, 18, 27, 105, 329, 27,
+    106, 18, 27, 106, 329, 27, 107, 18, 26, 107, 330, 26,
+    108, 17, 27, 108, 330, 27, 109, 17, 26, 109, 331, 26,
+    110, 16, 27, 110, 331, 27, 111, 16, 26, 111, 332, 26,
+    112, 15, 27, 112, 332, 27, 113, 15, 26, 113, 333, 26,
+    114, 15, 26, 114, 333, 26, 115, 14, 26, 115, 334, 26,
+    116, 14, 26, 116, 334, 26, 117, 13, 26, 117, 335, 26,
+    118, 13, 26, 118, 335, 26, 119, 13, 25, 119, 336, 25,
+    120, 12, 26, 120, 336, 26, 121, 12, 25, 121, 337, 25,
+    122, 12, 25, 122, 337, 25, 123, 11, 25, 123, 338, 25,
+    124, 11, 25, 124, 338, 25, 125, 11, 25, 125, 338, 25,
+    126, 10, 25, 126, 339, 25, 127, 10, 25, 127, 339, 25,
+    128, 10, 24, 128, 340, 24, 129, 9, 25, 129, 340, 25,
+    130, 9, 25, 130, 340, 25, 131, 9, 24, 131, 341, 24,
+    132, 8, 25, 132, 341, 25, 133, 8, 25, 133, 341, 25,
+    134, 8, 24, 134, 342, 24, 135, 8, 24, 135, 342, 24,
+    136, 7, 25, 136, 342, 25, 137, 7, 24, 137, 343, 24,
+    138, 7, 24, 138, 343, 24, 139, 7, 24, 139, 343, 24,
+    140, 6, 24, 140, 344, 24, 141, 6, 24, 141, 344, 24,
+    142, 6, 24, 142, 344, 24, 143, 6, 23, 143, 345, 23,
+    144, 5, 24, 144, 345, 24, 145, 5, 24, 145, 345, 24,
+    146, 5, 24, 146, 345, 24, 147, 5, 23, 147, 346, 23,
+    148, 5, 23, 148, 346, 23, 149, 4, 24, 149, 346, 24,
+    150, 4, 24, 150, 346, 24, 151, 4, 23, 151, 347, 23,
+    152, 4, 23, 152, 347, 23, 153, 4, 23, 153, 347, 23,
+    154, 3, 24, 154, 347, 24, 155, 3, 24, 155, 347, 24,
+    156, 3, 23, 156, 348, 23, 157, 3, 23, 157, 348, 23,
+    158, 3, 23, 158, 348, 23, 159, 3, 23, 159, 348, 23,
+    160, 3, 23, 160, 348, 23, 161, 2, 24, 161, 348, 24,
+    162, 2, 23, 162, 349, 23, 163, 2, 23, 163, 349, 23,
+    164, 2, 23, 164, 349, 23, 165, 2, 23, 165, 349, 23,
+    166, 2, 23, 166, 349, 23, 167, 2, 23, 167, 349, 23,
+    168, 2, 23, 168, 349, 23, 169, 2, 22, 169, 350, 22,
+    170, 2, 22, 170, 350, 22, 171, 1, 23, 171, 350, 23,
+    172, 1, 23, 172, 350, 23, 173, 1, 23, 173, 350, 23,
+    174, 1, 23, 174, 350, 23, 175, 1, 23, 175, 350, 23,
+    176, 1, 23, 176, 350, 23, 177, 1, 23, 177, 350, 23,
+    178, 1, 23, 178, 350, 23, 179, 1, 23, 179, 350, 23,
+    180, 1, 23, 180, 350, 23, 181, 1, 23, 181, 350, 23,
+    182, 1, 23, 182, 350, 23, 183, 1, 23, 183, 350, 23,
+    184, 1, 23, 184, 350, 23, 185, 1, 22, 185, 351, 22,
+    186, 1, 22, 186, 351, 22, 187, 1, 22, 187, 351, 22,
+    188, 1, 23, 188, 351, 22, 189, 1, 23, 189, 350, 23,
+    190, 1, 23, 190, 350, 23, 191, 1, 23, 191, 350, 23,
+    192, 1, 23, 192, 350, 23, 193, 1, 23, 193, 350, 23,
+    194, 1, 23, 194, 350, 23, 195, 1, 23, 195, 350, 23,
+    196, 1, 23, 196, 350, 23, 197, 1, 23, 197, 350, 23,
+    198, 1, 23, 198, 350, 23, 199, 1, 23, 199, 350, 23,
+    200, 1, 23, 200, 350, 23, 201, 1, 23, 201, 350, 23,
+    202, 1, 23, 202, 350, 23, 203, 2, 22, 203, 350, 22,
+    204, 2, 22, 204, 350, 22, 205, 2, 23, 205, 349, 23,
+    206, 2, 23, 206, 349, 23, 207, 2, 23, 207, 349, 23,
+    208, 2, 23, 208, 349, 23, 209, 2, 23, 209, 349, 23,
+    210, 2, 23, 210, 349, 23, 211, 2, 23, 211, 349, 23,
+    212, 2, 24, 212, 348, 24, 213, 3, 23, 213, 348, 23,
+    214, 3, 23, 214, 348, 23, 215, 3, 23, 215, 348, 23,
+    216, 3, 23, 216, 348, 23, 217, 3, 23, 217, 348, 23,
+    218, 3, 24, 218, 347, 24, 219, 3, 24, 219, 347, 24,
+    220, 4, 23, 220, 347, 23, 221, 4, 23, 221, 347, 23,
+    222, 4, 23, 222, 347, 23, 223, 4, 24, 223, 346, 24,
+    224, 4, 24, 224, 346, 24, 225, 5, 23, 225, 346, 23,
+    226, 5, 23, 226, 346, 23, 227, 5, 24, 227, 345, 24,
+    228, 5, 24, 228, 345, 24, 229, 5, 24, 229, 345, 24,
+    230, 6, 23, 230, 345, 23, 231, 6, 24, 231, 344, 24,
+    232, 6, 24, 232, 344, 24, 233, 6, 24, 233, 344, 24,
+    234, 7, 24, 234, 343, 24, 235, 7, 24, 235, 343, 24,
+    236, 7, 24, 236, 343, 24, 237, 7, 25, 237, 342, 25,
+    238, 8, 24, 238, 342, 24, 239, 8, 24, 239, 342, 24,
+    240, 8, 25, 240, 341, 25, 241, 8, 25, 241, 341, 25,
+    242, 9, 24, 242, 341, 24, 243, 9, 25, 243, 340, 25,
+    244, 9, 25, 244, 340, 25, 245, 10, 24, 245, 340, 24,
+    246, 10, 25, 246, 339, 25, 247, 10, 25, 247, 339, 25,
+    248, 11, 25, 248, 338, 25, 249, 11, 25, 249, 338, 25,
+    250, 11, 25, 250, 338, 25, 251, 12, 25, 251, 337, 25,
+    252, 12, 25, 252, 337, 25, 253, 12, 26, 253, 336, 26,
+    254, 13, 25, 254, 336, 25, 255, 13, 26, 255, 335, 26,
+    256, 13, 26, 256, 335, 26, 257, 14, 26, 257, 334, 26,
+    258, 14, 26, 258, 334, 26, 259, 15, 26, 259, 333, 26,
+    260, 15, 26, 260, 333, 26, 261, 15, 27, 261, 332, 27,
+    262, 16, 26, 262, 332, 26, 263, 16, 27, 263, 331, 27,
+    264, 17, 26, 264, 331, 26, 265, 17, 27, 265, 330, 27,
+    266, 18, 26, 266, 330, 26, 267, 18, 27, 267, 329, 27,
+    268, 18, 27, 268, 329, 27, 269, 19, 27, 269, 328, 27,
+    270, 19, 28, 270, 327, 28, 271, 20, 27, 271, 327, 27,
+    272, 20, 28, 272, 326, 28, 273, 21, 27, 273, 326, 27,
+    274, 21, 28, 274, 325, 28, 275, 22, 28, 275, 324, 28,
+    276, 22, 28, 276, 324, 28, 277, 23, 28, 277, 323, 28,
+    278, 24, 28, 278, 322, 28, 279, 24, 28, 279, 322, 28,
+    280, 25, 28, 280, 321, 28, 281, 25, 29, 281, 320, 29,
+    282, 26, 29, 282, 319, 29, 283, 26, 29, 283, 319, 29,
+    284, 27, 29, 284, 318, 29, 285, 28, 29, 285, 317, 29,
+    286, 28, 30, 286, 316, 30, 287, 29, 29, 287, 316, 29,
+    288, 29, 30, 288, 315, 30, 289, 30, 30, 289, 314, 30,
+    290, 31, 30, 290, 313, 30, 291, 31, 31, 291, 312, 31,
+    292, 32, 30, 292, 312, 30, 293, 33, 30, 293, 311, 30,
+    294, 33, 31, 294, 310, 31, 295, 34, 31, 295, 309, 31,
+    296, 35, 31, 296, 308, 31, 297, 35, 32, 297, 307, 32,
+    298, 36, 32, 298, 306, 32, 299, 37, 32, 299, 305, 32,
+    300, 38, 32, 300, 304, 32, 301, 38, 33, 301, 303, 33,
+    302, 39, 33, 302, 302, 33, 303, 40, 33, 303, 301, 33,
+    304, 41, 33, 304, 300, 33, 305, 42, 33, 305, 299, 33,
+    306, 42, 34, 306, 298, 34, 307, 43, 34, 307, 297, 34,
+    308, 44, 34, 308, 296, 34, 309, 45, 34, 309, 295, 34,
+    310, 46, 34, 310, 294, 34, 311, 47, 34, 311, 293, 34,
+    312, 48, 35, 312, 291, 35, 313, 48, 36, 313, 290, 36,
+    314, 49, 36, 314, 289, 36, 315, 50, 36, 315, 288, 36,
+    316, 51, 37, 316, 286, 37, 317, 52, 37, 317, 285, 37,
+    318, 53, 37, 318, 284, 37, 319, 54, 38, 319, 282, 38,
+    320, 55, 38, 320, 281, 38, 321, 56, 38, 321, 280, 38,
+    322, 57, 39, 322, 278, 39, 323, 58, 39, 323, 277, 39,
+    324, 59, 40, 324, 275, 40, 325, 60, 40, 325, 274, 40,
+    326, 62, 40, 326, 272, 40, 327, 63, 41, 327, 270, 41,
+    328, 64, 41, 328, 269, 41, 329, 65, 42, 329, 267, 42,
+    330, 66, 43, 330, 265, 43, 331, 67, 44, 331, 263, 44,
+    332, 69, 44, 332, 261, 44, 333, 70, 45, 333, 259, 45,
+    334, 71, 46, 334, 257, 46, 335, 72, 47, 335, 255, 47,
+    336, 74, 47, 336, 253, 47, 337, 75, 48, 337, 251, 48,
+    338, 76, 50, 338, 248, 50, 339, 78, 50, 339, 246, 50,
+    340, 79, 52, 340, 243, 52, 341, 81, 53, 341, 240, 53,
+    342, 82, 55, 342, 237, 55, 343, 84, 56, 343, 234, 56,
+    344, 85, 58, 344, 231, 58, 345, 87, 60, 345, 227, 60,
+    346, 89, 62, 346, 223, 62, 347, 90, 66, 347, 218, 66,
+    348, 92, 70, 348, 212, 70, 349, 94, 75, 349, 205, 75,
+    350, 96, 89, 350, 189, 89, 351, 97, 180, 352, 99, 176,
+    353, 101, 172, 354, 103, 168, 355, 106, 162, 356, 108, 158,
+    357, 110, 154, 358, 112, 150, 359, 115, 144, 360, 117, 140,
+    361, 120, 134, 362, 123, 128, 363, 126, 122, 364, 129, 116,
+    365, 132, 110, 366, 136, 102, 367, 140, 94, 368, 144, 86,
+    369, 149, 76, 370, 154, 66, 371, 161, 52, 372, 171, 32,
+};
+
+static const uint8_t MASK_2_SHADOW_INDICES[] =
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 4,
+    4, 4, 4, 4, 4, 4, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 3, 3, 4, 4, 4, 4, 5, 5,
+    5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 5, 5, 5, 5, 5, 5,
+    4, 4, 4, 4, 3, 3, 3, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 2,
+    2, 2, 2, 3, 3, 4, 4, 4, 5, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7,
+    7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 7, 7, 7, 7, 7, 7, 7, 7, 6, 6, 6,
+    6, 5, 5, 5, 5, 5, 4, 4, 4, 3, 3, 2, 2, 2, 2, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 3, 3, 4, 4, 4, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7,
+    7, 8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    11, 11, 11, 11, 11, 11, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 9, 9, 9,
+    9, 8, 8, 8, 8, 7, 7, 7, 7, 7, 6, 6, 6, 6, 5, 5, 5, 4, 4, 4,
+    3, 3, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 4, 4, 5, 5, 5,
+    6, 6, 6, 7, 7, 7, 7, 8, 8, 8, 9, 9, 9, 10, 10, 10, 10, 11, 11, 11,
+    11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 11, 11, 11, 11, 11, 10, 10, 10, 10, 9,
+    9, 9, 8, 8, 8, 7, 7, 7, 7, 6, 6, 6, 5, 5, 5, 4, 4, 3, 3, 2,
+    2, 2, 2, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 1, 1, 1, 2, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 6, 7, 7, 7,
+    8, 8, 8, 9, 9, 10, 10, 10, 11, 11, 11, 11, 12, 12, 12, 12, 12, 13, 13, 13,
+    13, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 13, 13, 13, 13, 12, 12, 12, 12, 12, 11, 11,
+    11, 11, 10, 10, 10, 9, 9, 8, 8, 8, 7, 7, 7, 6, 6, 6, 5, 5, 4, 4,
+    3, 3, 2, 2, 2, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 2, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 6, 7, 7,
+    7, 8, 8, 9, 9, 10, 10, 10, 11, 11, 12, 12, 12, 12, 13, 13, 13, 14, 14, 14,
+    14, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17,
+    17, 17, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 15, 15, 15, 15, 15, 14,
+    14, 14, 14, 13, 13, 13, 12, 12, 12, 12, 11, 11, 10, 10, 10, 9, 9, 8, 8, 7,
+    7, 7, 6, 6, 6, 5, 5, 4, 4, 3, 3, 2, 2, 2, 1, 1, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 2, 2, 3, 4, 4,
+    5, 5, 5, 6, 6, 7, 7, 7, 8, 8, 9, 10, 10, 10, 11, 11, 12, 12, 12, 13,
+    13, 14, 14, 14, 15, 15, 15, 15, 16, 16, 16, 16, 17, 17, 17, 17, 17, 18, 18, 18,
+    18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 18, 18,
+    18, 18, 18, 18, 18, 17, 17, 17, 17, 17, 16, 16, 16, 16, 15, 15, 15, 15, 14, 14,
+    14, 13, 13, 12, 12, 12, 11, 11, 10, 10, 10, 9, 8, 8, 7, 7, 7, 6, 6, 5,
+    5, 5, 4, 4, 3, 2, 2, 2, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 1, 1, 2, 2, 2, 3, 4, 4, 5, 5, 6, 6, 7, 7,
+    7, 8, 8, 9, 10, 10, 11, 11, 12, 12, 12, 13, 13, 14, 14, 15, 15, 15, 16, 16,
+    16, 17, 17, 17, 17, 18, 18, 18, 19, 19, 19, 19, 19, 20, 20, 20, 20, 20, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 20, 20,
+    20, 20, 20, 19, 19, 19, 19, 19, 18, 18, 18, 17, 17, 17, 17, 16, 16, 16, 15, 15,
+    15, 14, 14, 13, 13, 12, 12, 12, 11, 11, 10, 10, 9, 8, 8, 7, 7, 7, 6, 6,
+    5, 5, 4, 4, 3, 2, 2, 2, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8,
+    8, 9, 9, 10, 11, 11, 12, 12, 12, 13, 14, 14, 14, 15, 15, 16, 16, 17, 17, 17,
+    18, 18, 19, 19, 19, 19, 20, 20, 20, 21, 21, 21, 21, 22, 22, 22, 22, 22, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 22, 22, 22, 22, 22, 21, 21, 21, 21, 20, 20, 20, 19, 19, 19, 19, 18, 18,
+    17, 17, 17, 16, 16, 15, 15, 14, 14, 14, 13, 12, 12, 12, 11, 11, 10, 9, 9, 8,
+    8, 7, 7, 6, 6, 5, 5, 4, 4, 3, 2, 2, 2, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 2, 3, 4, 4, 5, 5, 6,
+    6, 7, 7, 8, 8, 9, 10, 10, 11, 11, 12, 12, 13, 14, 14, 15, 15, 16, 16, 17,
+    17, 17, 18, 18, 19, 19, 20, 20, 21, 21, 21, 21, 22, 22, 22, 23, 23, 23, 24, 25,
+    26, 27, 28, 29, 30, 31, 32, 33, 33, 34, 34, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 34, 34, 34, 34, 33, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 23, 23, 22,
+    22, 22, 21, 21, 21, 21, 20, 20, 19, 19, 18, 18, 17, 17, 17, 16, 16, 15, 15, 14,
+    14, 13, 12, 12, 11, 11, 10, 10, 9, 8, 8, 7, 7, 6, 6, 5, 5, 4, 4, 3,
+    2, 2, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 2, 2, 2, 3, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 10, 10, 11, 12, 12,
+    13, 13, 14, 15, 15, 16, 16, 17, 17, 18, 18, 19, 19, 20, 20, 21, 21, 21, 22, 22,
+    23, 23, 23, 25, 36, 28, 30, 32, 33, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 33, 32, 30, 28, 36, 25, 23, 23, 23, 22, 22,
+    21, 21, 21, 20, 20, 19, 19, 18, 18, 17, 17, 16, 16, 15, 15, 14, 13, 13, 12, 12,
+    11, 10, 10, 9, 8, 8, 7, 7, 6, 6, 5, 5, 4, 3, 2, 2, 2, 1, 1, 1,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 2, 3, 4, 4,
+    5, 5, 6, 7, 7, 8, 8, 9, 10, 10, 11, 12, 12, 13, 14, 14, 15, 16, 16, 17,
+    17, 18, 19, 19, 20, 20, 21, 21, 22, 22, 23, 23, 23, 37, 27, 29, 38, 34, 35, 35,
+    35, 35, 35, 35, 35, 35, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52,
+    53, 53, 54, 55, 55, 55, 53, 53, 56, 51, 51, 57, 49, 49, 48, 47, 46, 45, 44, 43,
+    42, 41, 40, 39, 35, 35, 35, 35, 35, 35, 35, 35, 34, 38, 29, 27, 37, 23, 23, 23,
+    22, 22, 21, 21, 20, 20, 19, 19, 18, 17, 17, 16, 16, 15, 14, 14, 13, 12, 12, 11,
+    10, 10, 9, 8, 8, 7, 7, 6, 5, 5, 4, 4, 3, 2, 2, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 3, 4, 5, 5, 6,
+    6, 7, 7, 8, 9, 10, 10, 11, 12, 12, 13, 14, 14, 15, 16, 16, 17, 18, 18, 19,
+    20, 20, 21, 21, 22, 22, 23, 23, 37, 58, 30, 59, 35, 35, 35, 35, 35, 35, 35, 40,
+    60, 43, 61, 62, 63, 51, 54, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 54, 51, 63, 62, 61, 43, 60, 40, 35, 35, 35, 35, 35, 35, 35, 59, 30,
+    58, 37, 23, 23, 22, 22, 21, 21, 20, 20, 19, 18, 18, 17, 16, 16, 15, 14, 14, 13,
+    12, 12, 11, 10, 10, 9, 8, 7, 7, 6, 6, 5, 5, 4, 3, 2, 2, 2, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 3, 4, 4,
+    5, 5, 6, 7, 7, 8, 9, 10, 10, 11, 12, 12, 13, 14, 15, 15, 16, 17, 17, 18,
+    19, 19, 20, 21, 21, 22, 23, 23, 24, 64, 65, 32, 35, 35, 35, 35, 35, 35, 66, 67,
+    44, 46, 63, 53, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 53, 63, 46, 44,
+    67, 66, 35, 35, 35, 35, 35, 35, 32, 65, 64, 24, 23, 23, 22, 21, 21, 20, 19, 19,
+    18, 17, 17, 16, 15, 15, 14, 13, 12, 12, 11, 10, 10, 9, 8, 7, 7, 6, 5, 5,
+    4, 4, 3, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 1, 2, 2, 3, 4, 4, 5, 6, 6, 7, 7, 8, 9, 10, 11, 11, 12, 13,
+    14, 14, 15, 16, 17, 17, 18, 19, 20, 20, 21, 22, 22, 23, 23, 64, 65, 59, 35, 35,
+    35, 35, 35, 68, 67, 69, 70, 52, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 52, 70, 69, 67, 68, 35, 35, 35,
+    35, 35, 59, 65, 64, 23, 23, 22, 22, 21, 20, 20, 19, 18, 17, 17, 16, 15, 14, 14,
+    13, 12, 11, 11, 10, 9, 8, 7, 7, 6, 6, 5, 4, 4, 3, 2, 2, 1, 1, 1,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 3, 4, 5,
+    5, 6, 7, 7, 8, 9, 10, 10, 11, 12, 12, 13, 14, 15, 16, 17, 17, 18, 19, 20,
+    21, 21, 22, 23, 23, 71, 72, 38, 35, 35, 35, 35, 35, 73, 43, 46, 57, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 53, 50, 48, 74,
+    75, 69, 76, 77, 67, 41, 78, 73, 40, 66, 66, 39, 35, 35, 35, 68, 66, 66, 73, 73,
+    78, 41, 41, 42, 43, 44, 61, 46, 47, 48, 50, 53, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 57, 46, 43, 73, 35, 35, 35, 35, 35,
+    38, 72, 71, 23, 23, 22, 21, 21, 20, 19, 18, 17, 17, 16, 15, 14, 13, 12, 12, 11,
+    10, 10, 9, 8, 7, 7, 6, 5, 5, 4, 3, 2, 2, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 3, 4, 5, 5, 6, 7, 7,
+    8, 9, 10, 11, 11, 12, 13, 14, 15, 16, 16, 17, 18, 19, 20, 21, 21, 22, 23, 23,
+    79, 29, 33, 35, 35, 35, 35, 40, 43, 74, 52, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 53, 50, 70, 75, 44, 80, 78, 68, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 68, 78, 80, 44, 75, 70, 50, 53, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 52, 74, 43, 40, 35, 35, 35,
+    35, 33, 29, 79, 23, 23, 22, 21, 21, 20, 19, 18, 17, 16, 16, 15, 14, 13, 12, 11,
+    11, 10, 9, 8, 7, 7, 6, 5, 5, 4, 3, 2, 2, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 3, 4, 5, 5, 6, 7, 7, 8,
+    9, 10, 11, 12, 12, 13, 14, 15, 16, 17, 18, 19, 19, 20, 21, 22, 23, 23, 64, 81,
+    34, 35, 35, 35, 39, 67, 75, 50, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 51, 47, 69, 80, 73, 35, 35, 35, 35, 35, 35, 35, 35, 32, 29, 28, 27, 26,
+    79, 71, 24, 19, 14, 12, 8, 7, 4, 4, 2, 3, 4, 5, 8, 8, 10, 13, 14, 19,
+    24, 71, 79, 26, 27, 28, 29, 32, 35, 35, 35, 35, 35, 35, 35, 35, 73, 80, 69, 47,
+    51, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 50, 75, 67, 39, 35,
+    35, 35, 34, 81, 64, 23, 23, 22, 21, 20, 19, 19, 18, 17, 16, 15, 14, 13, 12, 12,
+    11, 10, 9, 8, 7, 7, 6, 5, 5, 4, 3, 2, 2, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 3, 4, 5, 5, 6, 7, 7, 8, 9,
+    10, 11, 12, 13, 14, 15, 16, 16, 17, 18, 19, 20, 21, 22, 23, 23, 79, 81, 34, 35,
+    35, 35, 68, 43, 47, 53, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 51, 74,
+    76, 41, 68, 35, 35, 35, 35, 35, 34, 29, 58, 79, 82, 18, 10, 2, 2, 10, 18, 82,
+    79, 58, 29, 34, 35, 35, 35, 35, 35, 68, 41, 76, 74, 51, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 53, 47, 43, 68, 35, 35, 35, 34, 81, 79, 23, 23, 22, 21,
+    20, 19, 18, 17, 16, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 7, 6, 5, 5, 4,
+    3, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2,
+    2, 3, 4, 5, 5, 6, 7, 8, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+    20, 21, 21, 22, 23, 71, 65, 33, 35, 35, 35, 68, 77, 70, 54, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 54, 49, 75, 80, 40, 35, 35, 35, 35, 35, 30, 27, 37, 21, 9,
+    0, 0, 9, 21, 37, 36, 30, 35, 35, 35, 35, 35, 40, 80, 75, 49, 54, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 54, 70, 77, 68, 35, 35, 35, 33, 65, 71, 23, 22, 21,
+    21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 8, 7, 6, 5, 5, 4,
+    3, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2,
+    2, 3, 4, 5, 5, 6, 7, 8, 8, 10, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+    20, 21, 22, 23, 23, 36, 38, 35, 35, 35, 68, 77, 47, 54, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 49, 61, 67, 39, 35, 35, 35, 35, 30, 27, 71, 15, 3, 3, 15, 71,
+    27, 30, 35, 35, 35, 35, 39, 67, 61, 49, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    54, 47, 77, 68, 35, 35, 35, 38, 36, 23, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14,
+    13, 12, 11, 10, 10, 8, 8, 7, 6, 5, 5, 4, 3, 2, 2, 1, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 3, 4, 5, 5, 6, 7, 7, 8,
+    10, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 21, 21, 22, 23, 37, 65, 34, 35, 35,
+    35, 67, 62, 54, 55, 55, 55, 55, 55, 55, 55, 55, 55, 56, 62, 77, 66, 35, 35, 35,
+    35, 29, 64, 22, 7, 6, 22, 64, 29, 35, 35, 35, 35, 66, 77, 74, 56, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 54, 62, 67, 35, 35, 35, 34, 65, 37, 23, 22, 21, 21, 19,
+    18, 17, 16, 15, 14, 13, 12, 11, 10, 10, 8, 7, 7, 6, 5, 5, 4, 3, 2, 2,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 3, 4, 5, 5,
+    6, 7, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 19, 20, 21, 22, 23, 23, 26,
+    32, 35, 35, 35, 40, 69, 51, 55, 55, 55, 55, 55, 55, 55, 55, 55, 51, 45, 60, 39,
+    35, 35, 35, 30, 26, 21, 4, 4, 21, 26, 30, 35, 35, 35, 39, 60, 45, 51, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 51, 69, 40, 35, 35, 35, 32, 26, 23, 23, 22, 21, 20,
+    19, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 7, 6, 5, 5, 4, 3, 2, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 3, 4, 5,
+    6, 7, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 18, 19, 20, 21, 22, 23, 24, 72,
+    33, 35, 35, 39, 42, 70, 54, 55, 55, 55, 55, 55, 55, 55, 55, 57, 61, 41, 35, 35,
+    35, 34, 72, 71, 9, 9, 71, 72, 34, 35, 35, 35, 41, 61, 57, 55, 55, 55, 55, 55,
+    55, 55, 55, 54, 70, 42, 39, 35, 35, 33, 72, 24, 23, 22, 21, 20, 19, 18, 16, 15,
+    14, 13, 12, 11, 10, 9, 8, 7, 7, 6, 5, 4, 3, 2, 2, 1, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 3, 4, 5, 6, 6, 7, 8, 9,
+    10, 11, 12, 13, 14, 15, 16, 18, 19, 20, 21, 22, 23, 82, 65, 34, 35, 35, 66, 69,
+    52, 55, 55, 55, 55, 55, 55, 55, 55, 52, 75, 41, 35, 35, 35, 59, 36, 21, 2, 2,
+    21, 36, 59, 35, 35, 35, 41, 75, 52, 55, 55, 55, 55, 55, 55, 55, 55, 52, 69, 40,
+    35, 35, 34, 65, 82, 23, 22, 21, 20, 19, 18, 16, 15, 14, 13, 12, 11, 10, 9, 8,
+    7, 6, 6, 5, 4, 3, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 1, 2, 3, 4, 5, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+    19, 20, 21, 22, 23, 37, 30, 35, 35, 35, 78, 46, 54, 55, 55, 55, 55, 55, 55, 55,
+    54, 47, 67, 39, 35, 35, 33, 27, 22, 1, 1, 22, 27, 33, 35, 35, 39, 67, 47, 54,
+    55, 55, 55, 55, 55, 55, 55, 54, 46, 78, 35, 35, 35, 30, 37, 23, 22, 21, 20, 19,
+    17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 5, 4, 3, 2, 1, 1, 1,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 3, 4, 5, 6, 7, 7,
+    8, 10, 11, 12, 13, 14, 15, 16, 17, 19, 20, 21, 22, 23, 25, 31, 35, 35, 35, 67,
+    48, 55, 55, 55, 55, 55, 55, 55, 55, 50, 76, 66, 35, 35, 33, 27, 23, 2, 2, 23,
+    27, 33, 35, 35, 66, 76, 50, 55, 55, 55, 55, 55, 55, 55, 55, 48, 67, 35, 35, 35,
+    31, 25, 23, 22, 21, 20, 19, 17, 16, 15, 14, 13, 12, 11, 10, 8, 7, 7, 6, 5,
+    4, 3, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2,
+    3, 4, 5, 6, 6, 7, 8, 9, 10, 11, 12, 14, 15, 16, 17, 19, 20, 21, 22, 23,
+    25, 31, 35, 35, 35, 80, 49, 55, 55, 55, 55, 55, 55, 55, 54, 74, 60, 35, 35, 35,
+    29, 71, 4, 4, 71, 29, 35, 35, 35, 60, 74, 54, 55, 55, 55, 55, 55, 55, 55, 49,
+    80, 35, 35, 35, 31, 25, 23, 22, 21, 20, 19, 17, 16, 15, 14, 12, 11, 10, 9, 8,
+    7, 6, 6, 5, 4, 3, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 2, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 15, 16, 17, 18, 19,
+    21, 22, 23, 37, 30, 35, 35, 35, 77, 50, 55, 55, 55, 55, 55, 55, 55, 52, 69, 66,
+    35, 35, 59, 26, 14, 14, 26, 59, 35, 35, 66, 69, 52, 55, 55, 55, 55, 55, 55, 55,
+    50, 77, 35, 35, 35, 30, 37, 23, 22, 21, 19, 18, 17, 16, 15, 13, 12, 11, 10, 9,
+    8, 7, 6, 5, 4, 3, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 2, 2, 3, 4, 5, 6, 7, 7, 8, 10, 11, 12, 13, 14, 15, 17, 18, 19,
+    21, 22, 23, 82, 81, 35, 35, 35, 77, 57, 55, 55, 55, 55, 55, 55, 55, 49, 77, 39,
+    35, 35, 65, 82, 3, 3, 82, 65, 35, 35, 39, 77, 49, 55, 55, 55, 55, 55, 55, 55,
+    57, 77, 35, 35, 35, 81, 82, 23, 22, 21, 19, 18, 17, 15, 14, 13, 12, 11, 10, 8,
+    7, 7, 6, 5, 4, 3, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 2, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 14, 15, 16, 17, 19, 20,
+    21, 23, 24, 28, 35, 35, 35, 42, 50, 55, 55, 55, 55, 55, 55, 55, 48, 67, 35, 35,
+    35, 58, 15, 15, 58, 35, 35, 35, 67, 48, 55, 55, 55, 55, 55, 55, 55, 50, 42, 35,
+    35, 35, 28, 24, 23, 21, 20, 19, 17, 16, 15, 14, 12, 11, 10, 9, 8, 7, 6, 5,
+    4, 3, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 3,
+    4, 5, 6, 7, 7, 8, 10, 11, 12, 13, 14, 16, 17, 18, 20, 21, 22, 23, 26, 33,
+    35, 35, 41, 63, 55, 55, 55, 55, 55, 55, 55, 70, 41, 35, 35, 33, 26, 10, 10, 26,
+    33, 35, 35, 41, 70, 55, 55, 55, 55, 55, 55, 55, 63, 41, 35, 35, 33, 26, 23, 22,
+    21, 20, 18, 17, 16, 14, 13, 12, 11, 10, 8, 7, 7, 6, 5, 4, 3, 2, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 3, 4, 5, 6, 7, 8,
+    9, 10, 11, 12, 14, 15, 16, 18, 19, 21, 22, 23, 25, 38, 35, 35, 83, 62, 55, 55,
+    55, 55, 55, 55, 55, 70, 41, 35, 35, 38, 25, 5, 5, 25, 38, 35, 35, 41, 70, 55,
+    55, 55, 55, 55, 55, 55, 62, 73, 35, 35, 38, 25, 23, 22, 21, 19, 18, 16, 15, 14,
+    12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 2, 2, 4, 5, 6, 6, 7, 8, 10, 11, 12, 13, 15, 16,
+    17, 19, 20, 21, 23, 82, 81, 35, 35, 68, 45, 54, 55, 55, 55, 55, 55, 55, 70, 41,
+    35, 35, 38, 71, 1, 2, 71, 38, 35, 35, 41, 70, 55, 55, 55, 55, 55, 55, 54, 45,
+    68, 35, 35, 81, 82, 23, 21, 20, 19, 17, 16, 15, 13, 12, 11, 10, 8, 7, 6, 6,
+    5, 4, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 3,
+    4, 5, 6, 7, 8, 9, 10, 11, 12, 14, 15, 17, 18, 19, 21, 22, 23, 36, 34, 35,
+    35, 77, 52, 55, 55, 55, 55, 55, 55, 63, 60, 35, 35, 38, 37, 2, 2, 37, 38, 35,
+    35, 60, 63, 55, 55, 55, 55, 55, 55, 52, 77, 35, 35, 34, 36, 23, 22, 21, 19, 18,
+    17, 15, 14, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 2, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 2, 2, 3, 4, 5, 6, 7, 8, 9, 11, 12, 13, 15,
+    16, 17, 19, 20, 22, 23, 71, 38, 35, 35, 78, 63, 55, 55, 55, 55, 55, 55, 51, 80,
+    35, 35, 32, 25, 3, 3, 25, 32, 35, 35, 80, 51, 55, 55, 55, 55, 55, 55, 63, 78,
+    35, 35, 38, 71, 23, 22, 20, 19, 17, 16, 15, 13, 12, 11, 9, 8, 7, 6, 5, 4,
+    3, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 4, 5,
+    6, 7, 7, 9, 10, 11, 12, 14, 15, 17, 18, 19, 21, 22, 23, 72, 35, 35, 68, 45,
+    54, 55, 55, 55, 55, 55, 53, 69, 39, 35, 59, 25, 4, 4, 25, 59, 35, 39, 44, 56,
+    55, 55, 55, 55, 55, 54, 45, 68, 35, 35, 72, 23, 22, 21, 19, 18, 17, 15, 14, 12,
+    11, 10, 9, 7, 7, 6, 5, 4, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 12, 13, 14, 16, 17, 19, 20,
+    22, 23, 25, 59, 35, 35, 42, 51, 55, 55, 55, 55, 55, 55, 46, 40, 35, 35, 26, 6,
+    6, 26, 35, 35, 66, 75, 54, 55, 55, 55, 55, 55, 51, 42, 35, 35, 59, 25, 23, 22,
+    20, 19, 17, 16, 14, 13, 12, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 3, 4, 5, 6, 7, 8, 10, 11, 12,
+    14, 15, 16, 18, 19, 21, 22, 23, 28, 35, 35, 66, 62, 55, 55, 55, 55, 55, 55, 49,
+    41, 35, 35, 65, 14, 14, 65, 35, 35, 41, 63, 55, 55, 55, 55, 55, 55, 62, 66, 35,
+    35, 28, 23, 22, 21, 19, 18, 16, 15, 14, 12, 11, 10, 8, 7, 6, 5, 4, 3, 2,
+    2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 4, 5, 5, 6, 7,
+    8, 10, 11, 12, 14, 15, 17, 19, 20, 21, 23, 37, 59, 35, 35, 80, 56, 55, 55, 55,
+    55, 55, 56, 43, 35, 35, 30, 23, 23, 30, 35, 35, 43, 56, 55, 55, 55, 55, 55, 56,
+    80, 35, 35, 59, 37, 23, 21, 20, 19, 17, 15, 14, 12, 11, 10, 8, 7, 6, 5, 5,
+    4, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 4, 5, 6,
+    7, 8, 9, 10, 12, 13, 14, 16, 17, 19, 21, 22, 23, 58, 35, 35, 68, 62, 55, 55,
+    55, 55, 55, 55, 46, 66, 35, 33, 25, 1, 1, 25, 33, 35, 66, 46, 55, 55, 55, 55,
+    55, 55, 62, 68, 35, 35, 58, 23, 22, 21, 19, 17, 16, 14, 13, 12, 10, 9, 8, 7,
+    6, 5, 4, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 3, 4,
+    5, 6, 7, 8, 9, 11, 12, 13, 15, 16, 18, 20, 21, 23, 82, 31, 35, 35, 60, 51,
+    55, 55, 55, 55, 55, 51, 67, 35, 35, 28, 9, 9, 28, 35, 35, 60, 51, 55, 55, 55,
+    55, 55, 51, 60, 35, 35, 31, 82, 23, 21, 20, 18, 16, 15, 13, 12, 11, 9, 8, 7,
+    6, 5, 4, 3, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 3,
+    4, 5, 6, 7, 8, 10, 11, 12, 14, 15, 17, 19, 20, 22, 23, 64, 34, 35, 39, 61,
+    54, 55, 55, 55, 55, 55, 75, 68, 35, 32, 24, 24, 32, 35, 68, 75, 55, 55, 55, 55,
+    55, 54, 61, 39, 35, 34, 64, 23, 22, 20, 19, 17, 15, 14, 12, 11, 10, 8, 7, 6,
+    5, 4, 3, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 3,
+    4, 5, 6, 7, 8, 10, 11, 13, 14, 16, 17, 19, 21, 22, 23, 28, 35, 35, 73, 49,
+    55, 55, 55, 55, 55, 51, 60, 35, 35, 27, 6, 6, 27, 35, 35, 60, 51, 55, 55, 55,
+    55, 55, 49, 73, 35, 35, 28, 23, 22, 21, 19, 17, 16, 14, 13, 11, 10, 8, 7, 6,
+    5, 4, 3, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 3,
+    5, 5, 7, 7, 9, 10, 12, 13, 15, 16, 18, 19, 21, 23, 82, 31, 35, 35, 43, 53,
+    55, 55, 55, 55, 55, 74, 68, 35, 31, 21, 21, 31, 35, 68, 74, 55, 55, 55, 55, 55,
+    53, 43, 35, 35, 31, 82, 23, 21, 19, 18, 16, 15, 13, 12, 10, 9, 7, 7, 5, 5,
+    3, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 4, 5, 6,
+    7, 8, 9, 10, 12, 13, 15, 16, 18, 20, 21, 23, 79, 34, 35, 39, 46, 55, 55, 55,
+    55, 55, 53, 77, 35, 35, 36, 4, 4, 36, 35, 35, 77, 53, 55, 55, 55, 55, 55, 46,
+    39, 35, 34, 79, 23, 21, 20, 18, 16, 15, 13, 12, 10, 9, 8, 7, 6, 5, 4, 2,
+    2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 4, 5, 6, 7, 8,
+    9, 11, 12, 14, 15, 17, 19, 20, 22, 23, 27, 35, 35, 83, 49, 55, 55, 55, 55, 55,
+    63, 83, 35, 32, 23, 23, 32, 35, 83, 63, 55, 55, 55, 55, 55, 49, 83, 35, 35, 27,
+    23, 22, 20, 19, 17, 15, 14, 12, 11, 9, 8, 7, 6, 5, 4, 2, 2, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 4, 5, 6, 7, 8, 10, 11, 12, 14,
+    15, 17, 19, 21, 22, 23, 29, 35, 35, 67, 56, 55, 55, 55, 55, 54, 69, 39, 35, 28,
+    7, 7, 28, 35, 39, 69, 54, 55, 55, 55, 55, 56, 67, 35, 35, 29, 23, 22, 21, 19,
+    17, 15, 14, 12, 11, 10, 8, 7, 6, 5, 4, 2, 2, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 2, 2, 4, 5, 6, 7, 8, 10, 11, 12, 14, 16, 17, 19, 21,
+    23, 24, 38, 35, 35, 44, 54, 55, 55, 55, 55, 52, 60, 35, 34, 37, 0, 0, 37, 34,
+    35, 60, 52, 55, 55, 55, 55, 54, 44, 35, 35, 38, 24, 23, 21, 19, 17, 16, 14, 12,
+    11, 10, 8, 7, 6, 5, 4, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 2, 3, 4, 5, 6, 7, 8, 10, 11, 13, 14, 16, 18, 19, 21, 23, 37, 33, 35,
+    68, 47, 55, 55, 55, 55, 55, 48, 66, 35, 31, 15, 15, 30, 35, 66, 48, 55, 55, 55,
+    55, 55, 47, 68, 35, 33, 37, 23, 21, 19, 18, 16, 14, 12, 11, 10, 8, 7, 6, 5,
+    4, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 3, 4, 5, 6,
+    7, 8, 10, 11, 13, 15, 16, 18, 20, 21, 23, 64, 34, 35, 40, 50, 55, 55, 55, 55,
+    55, 61, 39, 35, 28, 5, 5, 72, 35, 39, 61, 55, 55, 55, 55, 55, 50, 83, 35, 34,
+    64, 23, 21, 20, 18, 16, 14, 13, 11, 10, 8, 7, 6, 5, 4, 3, 2, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 3, 4, 5, 6, 7, 8, 10, 11, 13, 15,
+    16, 18, 20, 22, 23, 36, 35, 35, 78, 52, 55, 55, 55, 55, 53, 80, 35, 35, 79, 0,
+    0, 25, 35, 35, 80, 53, 55, 55, 55, 55, 56, 41, 35, 35, 36, 23, 22, 20, 18, 16,
+    15, 13, 11, 10, 8, 7, 6, 5, 4, 3, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 2, 3, 4, 5, 6, 7, 8, 10, 12, 13, 15, 16, 18, 20, 22, 23, 72,
+    35, 35, 67, 53, 55, 55, 55, 55, 51, 78, 35, 59, 22, 18, 32, 35, 78, 51, 55, 55,
+    55, 55, 54, 80, 35, 35, 72, 23, 22, 20, 18, 16, 15, 13, 12, 10, 8, 7, 6, 5,
+    4, 3, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 3, 4, 5, 6,
+    7, 8, 10, 12, 13, 15, 17, 18, 20, 22, 23, 65, 35, 35, 43, 54, 55, 55, 55, 55,
+    48, 66, 35, 81, 10, 9, 81, 35, 66, 48, 55, 55, 55, 55, 55, 44, 35, 35, 29, 23,
+    22, 20, 18, 16, 15, 13, 12, 10, 8, 7, 6, 5, 4, 3, 2, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 2, 3, 4, 5, 6, 7, 8, 10, 12, 13, 15, 17, 19,
+    20, 22, 23, 30, 35, 35, 45, 55, 55, 55, 55, 55, 46, 39, 35, 58, 3, 3, 58, 35,
+    39, 46, 55, 55, 55, 55, 55, 45, 35, 35, 81, 23, 22, 20, 18, 17, 15, 13, 12, 10,
+    8, 7, 6, 5, 4, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2,
+    4, 5, 6, 7, 8, 10, 12, 13, 15, 17, 19, 20, 22, 24, 31, 35, 39, 62, 55, 55,
+    55, 55, 55, 69, 35, 35, 64, 0, 0, 64, 35, 35, 44, 55, 55, 55, 55, 55, 62, 39,
+    35, 30, 24, 22, 20, 19, 17, 15, 13, 12, 10, 8, 7, 6, 5, 4, 2, 2, 1, 1,
+    0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 4, 5, 6, 7, 8, 10, 12, 13, 15, 17,
+    19, 21, 22, 24, 38, 35, 39, 70, 55, 55, 55, 55, 54, 77, 35, 34, 71, 71, 34, 35,
+    77, 54, 55, 55, 55, 55, 70, 39, 35, 31, 24, 22, 20, 19, 17, 15, 13, 12, 10, 8,
+    7, 6, 5, 4, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 4, 5,
+    6, 7, 8, 10, 12, 13, 15, 17, 19, 21, 22, 24, 32, 35, 68, 63, 55, 55, 55, 55,
+    53, 67, 35, 33, 21, 21, 33, 35, 67, 53, 55, 55, 55, 55, 63, 68, 35, 38, 24, 22,
+    21, 19, 17, 15, 13, 12, 10, 8, 7, 6, 5, 4, 2, 2, 1, 1, 0, 0, 0, 0,
+    0, 0, 1, 1, 2, 2, 4, 5, 6, 7, 8, 10, 12, 13, 15, 17, 19, 21, 22, 24,
+    59, 35, 66, 49, 55, 55, 55, 55, 56, 78, 35, 38, 13, 13, 31, 35, 78, 56, 55, 55,
+    55, 55, 49, 66, 35, 32, 24, 22, 21, 19, 17, 15, 13, 12, 10, 8, 7, 6, 5, 4,
+    2, 2, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 4, 5, 6, 7, 8, 10,
+    11, 13, 15, 17, 19, 20, 22, 24, 59, 35, 66, 49, 55, 55, 55, 55, 51, 73, 35, 81,
+    8, 8, 81, 35, 73, 51, 55, 55, 55, 55, 49, 66, 35, 59, 24, 22, 20, 19, 17, 15,
+    13, 11, 10, 8, 7, 6, 5, 4, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 2, 3, 5, 6, 7, 8, 10, 11, 13, 15, 16, 18, 20, 22, 24, 59, 35, 66, 50,
+    55, 55, 55, 55, 57, 40, 35, 29, 5, 5, 29, 35, 40, 57, 55, 55, 55, 55, 50, 66,
+    35, 59, 24, 22, 20, 18, 16, 15, 13, 11, 10, 8, 7, 6, 5, 3, 2, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 3, 5, 6, 7, 8, 10, 11, 13, 15, 16,
+    18, 20, 22, 24, 32, 35, 66, 50, 55, 55, 55, 55, 50, 66, 35, 65, 4, 4, 65, 35,
+    66, 50, 55, 55, 55, 55, 50, 66, 35, 32, 24, 22, 20, 18, 16, 15, 13, 11, 10, 8,
+    7, 6, 5, 3, 2, 1, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 2, 3, 4, 5,
+    7, 8, 9, 11, 12, 14, 16, 18, 20, 22, 24, 38, 35, 66, 49, 55, 55, 55, 55, 49,
+    66, 35, 28, 3, 3, 28, 35, 66, 49, 55, 55, 55, 55, 49, 66, 35, 38, 24, 22, 20,
+    18, 16, 14, 12, 11, 9, 8, 7, 5, 4, 3, 2, 1, 1, 1, 0, 0, 0, 0, 0,
+    1, 1, 2, 3, 4, 5, 7, 8, 9, 11, 12, 14, 16, 18, 20, 22, 23, 31, 35, 68,
+    49, 55, 55, 55, 55, 49, 68, 35, 72, 2, 2, 58, 35, 66, 49, 55, 55, 55, 55, 49,
+    68, 35, 31, 23, 22, 20, 18, 16, 14, 12, 11, 9, 8, 7, 5, 4, 3, 2, 1, 1,
+    0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 4, 5, 6, 7, 9, 11, 12, 14, 16, 18,
+    20, 22, 23, 30, 35, 39, 48, 55, 55, 55, 55, 49, 68, 35, 27, 1, 1, 27, 35, 66,
+    50, 55, 55, 55, 55, 48, 39, 35, 30, 23, 22, 20, 18, 16, 14, 12, 11, 9, 7, 6,
+    5, 4, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 4, 5, 6, 7,
+    9, 10, 12, 14, 16, 17, 19, 21, 23, 65, 35, 39, 70, 55, 55, 55, 55, 50, 66, 35,
+    27, 0, 0, 27, 35, 66, 57, 55, 55, 55, 55, 70, 39, 35, 65, 23, 21, 19, 17, 16,
+    14, 12, 10, 9, 7, 6, 5, 4, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 2, 4, 5, 6, 7, 8, 10, 12, 14, 15, 17, 19, 21, 23, 58, 35, 35, 62, 55,
+    55, 55, 55, 57, 66, 35, 27, 1, 1, 27, 35, 40, 51, 55, 55, 55, 55, 62, 35, 35,
+    58, 23, 21, 19, 17, 15, 14, 12, 10, 8, 7, 6, 5, 4, 2, 1, 1, 1, 0, 0,
+    0, 0, 0, 1, 1, 1, 2, 3, 5, 6, 7, 8, 10, 12, 13, 15, 17, 19, 21, 23,
+    26, 35, 35, 61, 55, 55, 55, 55, 51, 40, 35, 58, 1, 1, 58, 35, 73, 52, 55, 55,
+    55, 55, 61, 35, 35, 26, 23, 21, 19, 17, 15, 13, 12, 10, 8, 7, 6, 5, 3, 2,
+    1, 1, 1, 0, 0, 0, 0, 0, 1, 1, 2, 3, 4, 5, 7, 8, 10, 11, 13, 15,
+    17, 19, 21, 23, 79, 35, 35, 76, 55, 55, 55, 55, 56, 73, 35, 28, 2, 2, 28, 35,
+    78, 56, 55, 55, 55, 55, 76, 35, 35, 79, 23, 21, 19, 17, 15, 13, 11, 10, 8, 7,
+    5, 4, 3, 2, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 4, 5, 6, 8,
+    9, 11, 12, 15, 16, 18, 21, 23, 71, 34, 35, 67, 54, 55, 55, 55, 53, 78, 35, 65,
+    3, 3, 65, 35, 78, 53, 55, 55, 55, 54, 67, 35, 34, 71, 23, 21, 18, 16, 15, 12,
+    11, 9, 8, 6, 5, 4, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2,
+    4, 5, 6, 7, 9, 11, 12, 14, 16, 18, 20, 22, 24, 33, 35, 78, 53, 55, 55, 55,
+    54, 67, 35, 81, 5, 5, 81, 35, 67, 54, 55, 55, 55, 53, 78, 35, 33, 24, 22, 20,
+    18, 16, 14, 12, 11, 9, 7, 6, 5, 4, 2, 2, 1, 1, 0, 0, 0, 0, 0, 1,
+    1, 1, 2, 3, 5, 6, 7, 8, 10, 12, 14, 16, 18, 20, 22, 23, 38, 35, 40, 52,
+    55, 55, 55, 55, 77, 35, 31, 7, 7, 31, 35, 77, 55, 55, 55, 55, 52, 40, 35, 38,
+    23, 22, 20, 18, 16, 14, 12, 10, 8, 7, 6, 5, 3, 2, 1, 1, 1, 0, 0, 0,
+    0, 0, 1, 1, 2, 3, 4, 6, 7, 8, 10, 12, 13, 15, 17, 19, 21, 23, 29, 35,
+    68, 50, 55, 55, 55, 55, 69, 35, 59, 11, 11, 59, 35, 69, 55, 55, 55, 55, 50, 68,
+    35, 29, 23, 21, 19, 17, 15, 13, 12, 10, 8, 7, 6, 4, 3, 2, 1, 1, 0, 0,
+    0, 0, 0, 0, 1, 1, 2, 2, 4, 5, 7, 8, 10, 11, 13, 15, 17, 19, 21, 23,
+    27, 35, 35, 47, 55, 55, 55, 55, 46, 35, 34, 17, 17, 34, 35, 46, 55, 55, 55, 55,
+    70, 35, 35, 27, 23, 21, 19, 17, 15, 13, 11, 10, 8, 7, 5, 4, 2, 2, 1, 1,
+    0, 0, 0, 0, 0, 1, 1, 1, 2, 4, 5, 6, 7, 9, 11, 12, 14, 16, 19, 21,
+    23, 79, 35, 35, 69, 55, 55, 55, 55, 48, 39, 35, 82, 82, 35, 39, 48, 55, 55, 55,
+    55, 69, 35, 35, 79, 23, 21, 19, 16, 14, 12, 11, 9, 7, 6, 5, 4, 2, 1, 1,
+    1, 0, 0, 0, 0, 0, 1, 1, 2, 3, 5, 6, 7, 9, 10, 12, 14, 16, 18, 20,
+    22, 82, 34, 35, 80, 55, 55, 55, 55, 51, 66, 35, 79, 79, 35, 66, 51, 55, 55, 55,
+    55, 80, 35, 34, 82, 22, 20, 18, 16, 14, 12, 10, 9, 7, 6, 5, 3, 2, 1, 1,
+    0, 0, 0, 0, 0, 0, 1, 1, 2, 3, 4, 6, 7, 8, 10, 12, 14, 15, 17, 20,
+    22, 23, 31, 35, 73, 53, 55, 55, 55, 53, 78, 35, 58, 0, 0, 58, 35, 78, 53, 55,
+    55, 55, 53, 73, 35, 38, 23, 22, 20, 17, 15, 14, 12, 10, 8, 7, 6, 4, 3, 2,
+    1, 1, 0, 0, 0, 0, 0, 1, 1, 2, 2, 4, 5, 6, 8, 9, 11, 13, 15, 17,
+    19, 21, 23, 28, 35, 39, 50, 55, 55, 55, 55, 80, 35, 81, 3, 3, 81, 35, 80, 55,
+    55, 55, 55, 50, 39, 35, 28, 23, 21, 19, 17, 15, 13, 11, 9, 8, 6, 5, 4, 2,
+    2, 1, 1, 0, 0, 0, 0, 0, 1, 1, 2, 3, 5, 6, 7, 9, 11, 12, 14, 16,
+    19, 21, 23, 64, 35, 35, 46, 55, 55, 55, 55, 61, 35, 59, 9, 9, 59, 35, 61, 55,
+    55, 55, 55, 74, 35, 35, 64, 23, 21, 19, 16, 14, 12, 11, 9, 7, 6, 5, 3, 2,
+    1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 2, 3, 4, 6, 7, 8, 10, 12, 14, 16,
+    18, 20, 22, 82, 34, 35, 43, 55, 55, 55, 55, 48, 39, 34, 18, 18, 34, 39, 48, 55,
+    55, 55, 55, 43, 35, 34, 82, 22, 20, 18, 16, 14, 12, 10, 8, 7, 6, 4, 3, 2,
+    1, 1, 0, 0, 0, 0, 0, 1, 1, 2, 2, 4, 5, 7, 8, 10, 11, 13, 15, 17,
+    19, 21, 23, 31, 35, 73, 53, 55, 55, 55, 52, 66, 35, 25, 25, 35, 66, 52, 55, 55,
+    55, 53, 73, 35, 31, 23, 21, 19, 17, 15, 13, 11, 10, 8, 7, 5, 4, 2, 2, 1,
+    1, 0, 0, 0, 0, 0, 1, 1, 2, 4, 5, 6, 7, 9, 11, 12, 15, 17, 19, 21,
+    23, 58, 35, 39, 49, 55, 55, 55, 54, 60, 35, 72, 0, 0, 72, 35, 60, 54, 55, 55,
+    55, 50, 39, 35, 58, 23, 21, 19, 17, 15, 12, 11, 9, 7, 6, 5, 4, 2, 1, 1,
+    0, 0, 0, 0, 0, 1, 1, 2, 3, 4, 6, 7, 8, 10, 12, 14, 16, 18, 20, 22,
+    37, 35, 35, 75, 55, 55, 55, 55, 69, 35, 30, 5, 5, 30, 35, 44, 55, 55, 55, 55,
+    75, 35, 35, 37, 22, 20, 18, 16, 14, 12, 10, 8, 7, 6, 4, 3, 2, 1, 1, 0,
+    0, 0, 0, 1, 1, 1, 2, 4, 5, 7, 8, 10, 11, 13, 15, 17, 20, 22, 23, 59,
+    35, 67, 55, 55, 55, 55, 63, 39, 34, 15, 15, 34, 35, 48, 55, 55, 55, 55, 67, 35,
+    59, 23, 22, 20, 17, 15, 13, 11, 10, 8, 7, 5, 4, 2, 1, 1, 1, 0, 0, 0,
+    0, 0, 1, 1, 2, 3, 5, 6, 7, 9, 11, 12, 15, 17, 19, 21, 23, 28, 35, 66,
+    52, 55, 55, 55, 53, 83, 35, 37, 37, 35, 40, 56, 55, 55, 55, 52, 66, 35, 28, 23,
+    21, 19, 17, 15, 12, 11, 9, 7, 6, 5, 3, 2, 1, 1, 0, 0, 0, 0, 0, 1,
+    1, 2, 3, 4, 6, 7, 8, 10, 12, 14, 16, 18, 20, 23, 25, 35, 35, 62, 55, 55,
+    55, 55, 77, 35, 28, 0, 0, 28, 35, 42, 55, 55, 55, 55, 62, 35, 35, 25, 23, 20,
+    18, 16, 14, 12, 10, 8, 7, 6, 4, 3, 2, 1, 1, 0, 0, 0, 0, 0, 1, 1,
+    2, 4, 5, 6, 8, 10, 11, 13, 15, 17, 19, 22, 23, 59, 35, 80, 55, 55, 55, 55,
+    74, 35, 32, 7, 7, 32, 35, 46, 55, 55, 55, 55, 80, 35, 59, 23, 22, 19, 17, 15,
+    13, 11, 10, 8, 6, 5, 4, 2, 1, 1, 0, 0, 0, 0, 0, 1, 1, 2, 3, 5,
+    6, 7, 9, 11, 12, 15, 17, 19, 21, 23, 28, 35, 66, 56, 55, 55, 55, 51, 68, 35,
+    23, 23, 35, 68, 51, 55, 55, 55, 56, 66, 35, 28, 23, 21, 19, 17, 15, 12, 11, 9,
+    7, 6, 5, 3, 2, 1, 1, 0, 0, 0, 0, 1, 1, 2, 2, 4, 5, 7, 8, 10,
+    12, 14, 16, 18, 20, 22, 37, 35, 35, 74, 55, 55, 55, 55, 60, 35, 36, 36, 35, 60,
+    55, 55, 55, 55, 74, 35, 35, 37, 22, 20, 18, 16, 14, 12, 10, 8, 7, 5, 4, 2,
+    2, 1, 1, 0, 0, 0, 0, 1, 1, 2, 3, 5, 6, 7, 9, 11, 13, 15, 17, 19,
+    21, 23, 38, 35, 42, 55, 55, 55, 55, 75, 35, 31, 4, 4, 31, 35, 75, 55, 55, 55,
+    55, 42, 35, 38, 23, 21, 19, 17, 15, 13, 11, 9, 7, 6, 5, 3, 2, 1, 1, 0,
+    0, 0, 0, 1, 1, 2, 3, 4, 6, 7, 8, 10, 12, 14, 16, 19, 21, 23, 27, 35,
+    68, 51, 55, 55, 55, 51, 68, 35, 19, 19, 35, 68, 51, 55, 55, 55, 51, 68, 35, 27,
+    23, 21, 19, 16, 14, 12, 10, 8, 7, 6, 4, 3, 2, 1, 1, 0, 0, 0, 0, 0,
+    1, 1, 2, 4, 5, 6, 8, 10, 11, 13, 15, 17, 20, 22, 82, 34, 35, 45, 55, 55,
+    55, 55, 60, 35, 36, 36, 35, 60, 55, 55, 55, 55, 45, 35, 34, 82, 22, 20, 17, 15,
+    13, 11, 10, 8, 6, 5, 4, 2, 1, 1, 0, 0, 0, 0, 0, 1, 1, 2, 3, 5,
+    6, 7, 9, 11, 12, 15, 17, 19, 21, 23, 81, 35, 78, 54, 55, 55, 55, 46, 35, 38,
+    5, 4, 38, 35, 46, 55, 55, 55, 54, 78, 35, 81, 23, 21, 19, 17, 15, 12, 11, 9,
+    7, 6, 5, 3, 2, 1, 1, 0, 0, 0, 0, 0, 1, 1, 2, 4, 5, 7, 8, 10,
+    12, 14, 16, 18, 20, 22, 79, 35, 35, 63, 55, 55, 55, 56, 66, 35, 23, 23, 35, 66,
+    56, 55, 55, 55, 63, 35, 35, 79, 22, 20, 18, 16, 14, 12, 10, 8, 7, 5, 4, 2,
+    1, 1, 0, 0, 0, 0, 0, 1, 1, 2, 3, 5, 6, 7, 9, 11, 13, 15, 17, 19,
+    21, 23, 59, 35, 80, 55, 55, 55, 55, 43, 35, 72, 72, 35, 43, 55, 55, 55, 55, 80,
+    35, 59, 23, 21, 19, 17, 15, 13, 11, 9, 7, 6, 5, 3, 2, 1, 1, 0, 0, 0,
+    0, 0, 1, 1, 2, 4, 5, 7, 8, 10, 12, 14, 16, 18, 21, 23, 27, 35, 39, 51,
+    55, 55, 55, 63, 35, 33, 9, 9, 33, 35, 63, 55, 55, 55, 52, 39, 35, 27, 23, 21,
+    18, 16, 14, 12, 10, 8, 7, 5, 4, 2, 1, 1, 0, 0, 0, 0, 0, 1, 1, 2,
+    3, 5, 6, 7, 9, 11, 13, 15, 17, 19, 22, 24, 34, 35, 69, 55, 55, 55, 54, 78,
+    35, 25, 25, 35, 78, 54, 55, 55, 55, 69, 35, 34, 24, 22, 19, 17, 15, 13, 11, 9,
+    7, 6, 5, 3, 2, 1, 1, 0, 0, 0, 0, 0, 1, 1, 2, 4, 5, 7, 8, 10,
+    12, 14, 16, 19, 21, 23, 28, 35, 40, 53, 55, 55, 55, 75, 35, 30, 1, 1, 30, 35,
+    75, 55, 55, 55, 53, 40, 35, 28, 23, 21, 19, 16, 14, 12, 10, 8, 7, 5, 4, 2,
+    1, 1, 0, 0, 0, 0, 0, 1, 1, 2, 3, 5, 6, 7, 9, 11, 13, 15, 17, 20,
+    22, 82, 35, 35, 74, 55, 55, 55, 56, 66, 35, 20, 20, 35, 68, 56, 55, 55, 55, 74,
+    35, 35, 82, 22, 20, 17, 15, 13, 11, 9, 7, 6, 5, 3, 2, 1, 1, 0, 0, 0,
+    0, 0, 1, 1, 2, 4, 6, 7, 8, 10, 12, 14, 16, 19, 21, 23, 81, 35, 41, 55,
+    55, 55, 55, 44, 35, 72, 72, 35, 76, 55, 55, 55, 55, 41, 35, 81, 23, 21, 19, 16,
+    14, 12, 10, 8, 7, 6, 4, 2, 1, 1, 0, 0, 0, 0, 0, 1, 1, 2, 3, 5,
+    6, 8, 10, 11, 13, 15, 18, 20, 22, 37, 35, 35, 63, 55, 55, 55, 57, 39, 34, 11,
+    11, 34, 39, 57, 55, 55, 55, 48, 35, 35, 37, 22, 20, 18, 15, 13, 11, 10, 8, 6,
+    5, 3, 2, 1, 1, 0, 0, 0, 0, 1, 1, 2, 4, 6, 7, 8, 10, 12, 14, 17,
+    19, 21, 23, 30, 35, 67, 55, 55, 55, 55, 80, 35, 26, 26, 35, 80, 55, 55, 55, 55,
+    67, 35, 30, 23, 21, 19, 17, 14, 12, 10, 8, 7, 6, 4, 2, 1, 1, 0, 0, 0,
+    0, 1, 1, 2, 3, 5, 6, 8, 10, 11, 13, 15, 18, 20, 22, 25, 35, 35, 49, 55,
+    55, 55, 63, 35, 59, 6, 6, 59, 35, 63, 55, 55, 55, 63, 35, 35, 25, 22, 20, 18,
+    15, 13, 11, 10, 8, 6, 5, 3, 2, 1, 1, 0, 0, 0, 0, 1, 1, 2, 4, 5,
+    7, 8, 10, 12, 14, 17, 19, 21, 23, 31, 35, 77, 55, 55, 55, 55, 60, 35, 25, 25,
+    35, 60, 55, 55, 55, 55, 42, 35, 31, 23, 21, 19, 17, 14, 12, 10, 8, 7, 5, 4,
+    2, 1, 1, 0, 0, 0, 0, 1, 1, 2, 3, 5, 6, 8, 10, 11, 13, 15, 18, 20,
+    22, 25, 35, 35, 50, 55, 55, 55, 48, 35, 38, 3, 3, 38, 35, 70, 55, 55, 55, 49,
+    35, 35, 25, 22, 20, 18, 15, 13, 11, 10, 8, 6, 5, 3, 2, 1, 1, 0, 0, 0,
+    0, 1, 1, 2, 4, 5, 7, 8, 10, 12, 14, 16, 19, 21, 23, 31, 35, 77, 55, 55,
+    55, 55, 41, 35, 71, 71, 35, 78, 55, 55, 55, 55, 80, 35, 31, 23, 21, 19, 16, 14,
+    12, 10, 8, 7, 5, 4, 2, 1, 1, 0, 0, 0, 0, 1, 1, 2, 3, 5, 6, 7,
+    9, 11, 13, 15, 17, 20, 22, 37, 35, 35, 50, 55, 55, 55, 70, 35, 31, 1, 1, 31,
+    35, 70, 55, 55, 55, 50, 35, 35, 37, 22, 20, 17, 15, 13, 11, 9, 7, 6, 5, 3,
+    2, 1, 1, 0, 0, 0, 0, 1, 1, 2, 4, 5, 7, 8, 10, 12, 14, 16, 19, 21,
+    23, 30, 35, 80, 55, 55, 55, 55, 41, 35, 71, 82, 35, 78, 55, 55, 55, 55, 80, 35,
+    30, 23, 21, 19, 16, 14, 12, 10, 8, 7, 5, 4, 2, 1, 1, 0, 0, 0, 0, 1,
+    2, 3, 5, 6, 7, 9, 11, 13, 15, 17, 20, 22, 71, 35, 35, 49, 55, 55, 55, 70,
+    35, 31, 1, 1, 31, 35, 70, 55, 55, 55, 49, 35, 35, 71, 22, 20, 17, 15, 13, 11,
+    9, 7, 6, 5, 3, 2, 1, 0, 0, 0, 0, 1, 1, 2, 4, 5, 7, 8, 10, 12,
+    14, 16, 18, 21, 23, 29, 35, 67, 55, 55, 55, 55, 41, 35, 71, 71, 35, 41, 55, 55,
+    55, 55, 67, 35, 29, 23, 21, 18, 16, 14, 12, 10, 8, 7, 5, 4, 2, 1, 1, 0,
+    0, 0, 0, 1, 1, 2, 4, 6, 7, 9, 11, 13, 15, 17, 19, 22, 24, 35, 35, 48,
+    55, 55, 55, 48, 35, 38, 1, 1, 38, 35, 48, 55, 55, 55, 48, 35, 35, 24, 22, 19,
+    17, 15, 13, 11, 9, 7, 6, 4, 2, 1, 1, 0, 0, 0, 0, 1, 1, 2, 3, 5,
+    6, 8, 10, 12, 14, 16, 18, 21, 23, 28, 35, 41, 55, 55, 55, 55, 67, 35, 37, 37,
+    35, 67, 55, 55, 55, 55, 41, 35, 28, 23, 21, 18, 16, 14, 12, 10, 8, 6, 5, 3,
+    2, 1, 1, 0, 0, 0, 0, 1, 1, 2, 4, 6, 7, 9, 11, 12, 15, 17, 19, 21,
+    23, 34, 35, 74, 55, 55, 55, 49, 35, 59, 4, 4, 59, 35, 49, 55, 55, 55, 74, 35,
+    34, 23, 21, 19, 17, 15, 12, 11, 9, 7, 6, 4, 2, 1, 1, 0, 0, 0, 0, 1,
+    2, 3, 5, 6, 8, 10, 11, 14, 16, 18, 20, 22, 36, 35, 66, 54, 55, 55, 55, 43,
+    35, 79, 79, 35, 43, 55, 55, 55, 54, 66, 35, 36, 23, 20, 18, 16, 14, 11, 10, 8,
+    6, 5, 3, 2, 1, 0, 0, 0, 0, 1, 1, 2, 4, 5, 7, 8, 10, 12, 14, 16,
+    19, 21, 23, 32, 35, 69, 55, 55, 55, 52, 39, 34, 7, 7, 34, 39, 52, 55, 55, 55,
+    69, 35, 32, 23, 21, 19, 16, 14, 12, 10, 8, 7, 5, 4, 2, 1, 1, 0, 0, 0,
+    0, 1, 1, 2, 4, 6, 7, 9, 11, 13, 15, 17, 20, 22, 37, 35, 39, 52, 55, 55,
+    55, 69, 35, 36, 36, 35, 69, 55, 55, 55, 52, 39, 35, 37, 22, 20, 17, 15, 13, 11,
+    9, 7, 6, 4, 2, 1, 1, 0, 0, 0, 1, 1, 2, 3, 5, 6, 8, 10, 12, 14,
+    16, 18, 21, 23, 81, 35, 80, 55, 55, 55, 54, 66, 35, 14, 14, 35, 66, 54, 55, 55,
+    55, 80, 35, 81, 23, 21, 18, 16, 14, 12, 10, 8, 6, 5, 3, 2, 1, 1, 0, 0,
+    0, 1, 1, 2, 4, 5, 7, 9, 11, 12, 15, 17, 19, 22, 24, 35, 35, 48, 55, 55,
+    55, 74, 35, 65, 65, 35, 74, 55, 55, 55, 48, 35, 35, 24, 22, 19, 17, 15, 12, 11,
+    9, 7, 5, 4, 2, 1, 1, 0, 0, 0, 0, 1, 2, 3, 5, 6, 7, 10, 11, 14,
+    16, 18, 20, 23, 27, 35, 73, 55, 55, 55, 55, 60, 35, 24, 24, 35, 60, 55, 55, 55,
+    55, 73, 35, 27, 23, 20, 18, 16, 14, 11, 10, 7, 6, 5, 3, 2, 1, 0, 0, 0,
+    1, 1, 2, 4, 5, 7, 8, 10, 12, 14, 16, 19, 21, 23, 32, 35, 61, 55, 55, 55,
+    50, 35, 32, 2, 2, 32, 35, 50, 55, 55, 55, 61, 35, 32, 23, 21, 19, 16, 14, 12,
+    10, 8, 7, 5, 4, 2, 1, 1, 0, 0, 0, 1, 1, 2, 4, 6, 7, 9, 11, 13,
+    15, 17, 19, 22, 71, 35, 39, 52, 55, 55, 55, 76, 35, 64, 64, 35, 76, 55, 55, 55,
+    52, 39, 35, 71, 22, 19, 17, 15, 13, 11, 9, 7, 6, 4, 2, 1, 1, 0, 0, 0,
+    0, 1, 2, 3, 5, 6, 8, 10, 12, 14, 16, 18, 20, 23, 65, 35, 42, 55, 55, 55,
+    54, 66, 35, 11, 11, 35, 66, 54, 55, 55, 55, 42, 35, 65, 23, 20, 18, 16, 14, 12,
+    10, 8, 6, 5, 3, 2, 1, 0, 0, 0, 1, 1, 2, 4, 5, 7, 8, 10, 12, 14,
+    17, 19, 21, 23, 33, 35, 62, 55, 55, 55, 62, 35, 65, 65, 35, 62, 55, 55, 55, 62,
+    35, 33, 23, 21, 19, 17, 14, 12, 10, 8, 7, 5, 4, 2, 1, 1, 0, 0, 0, 1,
+    1, 2, 4, 6, 7, 9, 11, 13, 15, 17, 20, 22, 79, 35, 68, 54, 55, 55, 55, 67,
+    35, 82, 82, 35, 67, 55, 55, 55, 54, 68, 35, 79, 22, 20, 17, 15, 13, 11, 9, 7,
+    6, 4, 2, 1, 1, 0, 0, 0, 0, 1, 2, 3, 5, 6, 8, 10, 12, 14, 16, 18,
+    21, 23, 81, 35, 77, 55, 55, 55, 52, 35, 33, 4, 4, 33, 35, 52, 55, 55, 55, 43,
+    35, 81, 23, 21, 18, 16, 14, 12, 10, 8, 6, 5, 3, 2, 1, 0, 0, 0, 1, 1,
+    2, 4, 5, 7, 8, 10, 12, 15, 17, 19, 21, 23, 34, 35, 47, 55, 55, 55, 45, 35,
+    27, 27, 35, 45, 55, 55, 55, 48, 35, 34, 23, 21, 19, 17, 15, 12, 10, 8, 7, 5,
+    4, 2, 1, 1, 0, 0, 0, 1, 1, 2, 4, 6, 7, 9, 11, 13, 15, 17, 20, 22,
+    64, 35, 68, 54, 55, 55, 55, 41, 35, 22, 21, 35, 41, 55, 55, 55, 54, 40, 35, 64,
+    22, 20, 17, 15, 13, 11, 9, 7, 6, 4, 2, 1, 1, 0, 0, 0, 0, 1, 2, 3,
+    5, 6, 8, 10, 12, 14, 16, 18, 21, 23, 81, 35, 77, 55, 55, 55, 57, 35, 59, 1,
+    1, 32, 35, 57, 55, 55, 55, 76, 35, 81, 23, 21, 18, 16, 14, 12, 10, 8, 6, 5,
+    3, 2, 1, 0, 0, 0, 0, 1, 2, 3, 5, 7, 8, 10, 12, 14, 17, 19, 21, 23,
+    34, 35, 70, 55, 55, 55, 61, 35, 26, 26, 35, 61, 55, 55, 55, 48, 35, 34, 23, 21,
+    19, 17, 14, 12, 10, 8, 7, 5, 3, 2, 1, 0, 0, 0, 1, 1, 2, 4, 6, 7,
+    9, 11, 13, 15, 17, 20, 22, 79, 35, 68, 54, 55, 55, 55, 78, 35, 19, 19, 35, 78,
+    55, 55, 55, 54, 66, 35, 79, 22, 20, 17, 15, 13, 11, 9, 7, 6, 4, 2, 1, 1,
+    0, 0, 0, 1, 1, 2, 5, 6, 8, 10, 12, 14, 16, 18, 20, 23, 29, 35, 43, 55,
+    55, 55, 51, 35, 59, 1, 1, 59, 35, 57, 55, 55, 55, 43, 35, 29, 23, 20, 18, 16,
+    14, 12, 10, 8, 6, 5, 2, 1, 1, 0, 0, 0, 0, 1, 2, 3, 5, 7, 8, 10,
+    12, 14, 16, 19, 21, 23, 33, 35, 47, 55, 55, 55, 45, 35, 36, 36, 35, 45, 55, 55,
+    55, 62, 35, 33, 23, 21, 19, 16, 14, 12, 10, 8, 7, 5, 3, 2, 1, 0, 0, 0,
+    1, 1, 2, 4, 5, 7, 9, 11, 13, 15, 17, 19, 22, 82, 35, 39, 53, 55, 55, 55,
+    60, 35, 22, 21, 35, 60, 55, 55, 55, 53, 39, 35, 82, 22, 19, 17, 15, 13, 11, 9,
+    7, 5, 4, 2, 1, 1, 0, 0, 1, 1, 2, 4, 6, 7, 9, 11, 13, 15, 18, 20,
+    22, 27, 35, 67, 55, 55, 55, 53, 39, 33, 2, 2, 33, 39, 53, 55, 55, 55, 60, 35,
+    58, 22, 20, 18, 15, 13, 11, 9, 7, 6, 4, 2, 1, 1, 0, 0, 0, 1, 2, 3,
+    5, 6, 8, 10, 12, 14, 16, 18, 21, 23, 31, 35, 75, 55, 55, 55, 62, 35, 72, 72,
+    35, 74, 55, 55, 55, 61, 35, 31, 23, 21, 18, 16, 14, 12, 10, 8, 6, 5, 3, 2,
+    1, 0, 0, 0, 0, 1, 2, 3, 5, 7, 8, 11, 12, 15, 17, 19, 21, 23, 34, 35,
+    50, 55, 55, 55, 77, 35, 71, 71, 35, 77, 55, 55, 55, 49, 35, 34, 23, 21, 19, 17,
+    15, 12, 11, 8, 7, 5, 3, 2, 1, 0, 0, 0, 1, 1, 2, 4, 6, 7, 9, 11,
+    13, 15, 17, 20, 22, 79, 35, 40, 55, 55, 55, 54, 66, 35, 9, 9, 35, 66, 55, 55,
+    55, 55, 66, 35, 79, 22, 20, 17, 15, 13, 11, 9, 7, 6, 4, 2, 1, 1, 0, 0,
+    1, 1, 2, 4, 6, 7, 10, 12, 14, 16, 18, 20, 23, 65, 35, 43, 55, 55, 55, 49,
+    35, 30, 30, 35, 49, 55, 55, 55, 77, 35, 65, 23, 20, 18, 16, 14, 12, 10, 7, 6,
+    4, 2, 1, 1, 0, 0, 0, 1, 2, 3, 5, 6, 8, 10, 12, 14, 16, 18, 21, 23,
+    59, 35, 74, 55, 55, 55, 61, 35, 26, 26, 35, 61, 55, 55, 55, 74, 35, 59, 23, 21,
+    18, 16, 14, 12, 10, 8, 6, 5, 3, 2, 1, 0, 0, 0, 0, 1, 2, 3, 5, 7,
+    8, 11, 12, 15, 17, 19, 21, 24, 35, 35, 52, 55, 55, 55, 60, 35, 21, 21, 35, 67,
+    55, 55, 55, 51, 35, 35, 24, 21, 19, 17, 15, 12, 11, 8, 7, 5, 3, 2, 1, 0,
+    0, 0, 0, 1, 2, 4, 6, 7, 9, 11, 13, 15, 17, 19, 22, 64, 35, 73, 55, 55,
+    55, 54, 39, 35, 5, 5, 35, 39, 54, 55, 55, 55, 40, 35, 64, 22, 19, 17, 15, 13,
+    11, 9, 7, 6, 4, 2, 1, 0, 0, 0, 1, 1, 2, 4, 6, 7, 10, 12, 14, 16,
+    18, 20, 23, 65, 35, 43, 55, 55, 55, 63, 35, 81, 81, 35, 63, 55, 55, 55, 77, 35,
+    65, 23, 20, 18, 16, 14, 12, 10, 7, 6, 4, 2, 1, 1, 0, 0, 1, 1, 3, 5,
+    6, 8, 10, 12, 14, 16, 18, 21, 23, 32, 35, 46, 55, 55, 55, 61, 35, 26, 26, 35,
+    61, 55, 55, 55, 75, 35, 32, 23, 21, 18, 16, 14, 12, 10, 8, 6, 5, 3, 1, 1,
+    0, 0, 0, 1, 2, 3, 5, 7, 8, 10, 12, 14, 17, 19, 21, 23, 35, 35, 57, 55,
+    55, 55, 67, 35, 24, 24, 35, 67, 55, 55, 55, 49, 35, 35, 23, 21, 19, 17, 14, 12,
+    10, 8, 7, 5, 3, 2, 1, 0, 0, 0, 0, 1, 2, 4, 5, 7, 9, 11, 13, 15,
+    17, 19, 22, 25, 35, 68, 55, 55, 55, 55, 68, 35, 9, 9, 35, 68, 55, 55, 55, 54,
+    68, 35, 25, 22, 19, 17, 15, 13, 11, 9, 7, 5, 4, 2, 1, 0, 0, 0, 1, 1,
+    2, 4, 6, 7, 9, 11, 13, 15, 17, 20, 22, 58, 35, 67, 55, 55, 55, 50, 35, 38,
+    38, 35, 50, 55, 55, 55, 67, 35, 58, 22, 20, 17, 15, 13, 11, 9, 7, 6, 4, 2,
+    1, 1, 0, 0, 1, 1, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 23, 30, 35, 69,
+    55, 55, 55, 46, 35, 27, 27, 35, 46, 55, 55, 55, 69, 35, 30, 23, 20, 18, 16, 14,
+    12, 10, 8, 6, 4, 2, 1, 1, 0, 0, 1, 1, 3, 5, 6, 8, 10, 12, 14, 16,
+    18, 21, 23, 59, 35, 70, 55, 55, 55, 76, 35, 71, 71, 35, 43, 55, 55, 55, 70, 35,
+    59, 23, 21, 18, 16, 14, 12, 10, 8, 6, 5, 3, 1, 1, 0, 0, 0, 1, 2, 3,
+    5, 7, 8, 10, 12, 15, 17, 19, 21, 23, 35, 35, 52, 55, 55, 55, 41, 35, 16, 16,
+    35, 41, 55, 55, 55, 52, 35, 35, 23, 21, 19, 17, 15, 12, 10, 8, 7, 5, 3, 2,
+    1, 0, 0, 0, 0, 1, 2, 4, 5, 7, 9, 11, 13, 15, 17, 19, 22, 25, 35, 66,
+    55, 55, 55, 54, 39, 35, 4, 4, 35, 39, 54, 55, 55, 55, 66, 35, 25, 22, 19, 17,
+    15, 13, 11, 9, 7, 5, 4, 2, 1, 0, 0, 0, 0, 1, 2, 4, 6, 7, 9, 11,
+    13, 15, 17, 20, 22, 27, 35, 67, 55, 55, 55, 50, 35, 31, 31, 35, 50, 55, 55, 55,
+    67, 35, 58, 22, 20, 17, 15, 13, 11, 9, 7, 6, 4, 2, 1, 0, 0, 0, 1, 1,
+    2, 4, 6, 7, 10, 12, 14, 16, 18, 20, 22, 29, 35, 44, 55, 55, 55, 74, 35, 58,
+    58, 35, 74, 55, 55, 55, 44, 35, 29, 22, 20, 18, 16, 14, 12, 10, 7, 6, 4, 2,
+    1, 1, 0, 0, 1, 1, 2, 5, 6, 8, 10, 12, 14, 16, 18, 21, 23, 38, 35, 46,
+    55, 55, 55, 44, 35, 79, 79, 35, 44, 55, 55, 55, 46, 35, 38, 23, 21, 18, 16, 14,
+    12, 10, 8, 6, 5, 2, 1, 1, 0, 0, 1, 1, 3, 5, 6, 8, 10, 12, 14, 16,
+    19, 21, 23, 34, 35, 63, 55, 55, 55, 42, 35, 23, 23, 35, 42, 55, 55, 55, 63, 35,
+    34, 23, 21, 19, 16, 14, 12, 10, 8, 6, 5, 3, 1, 1, 0, 0, 1, 2, 3, 5,
+    7, 8, 11, 12, 15, 17, 19, 21, 23, 35, 35, 53, 55, 55, 55, 83, 35, 11, 11, 35,
+    83, 55, 55, 55, 53, 35, 35, 23, 21, 19, 17, 15, 12, 11, 8, 7, 5, 3, 2, 1,
+    0, 0, 0, 1, 2, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 25, 35, 40, 55, 55,
+    55, 53, 35, 33, 1, 0, 33, 35, 53, 55, 55, 55, 40, 35, 25, 21, 19, 17, 15, 13,
+    11, 9, 7, 5, 3, 2, 1, 0, 0, 0, 0, 1, 2, 4, 5, 7, 9, 11, 13, 15,
+    17, 19, 22, 36, 35, 60, 55, 55, 55, 50, 35, 81, 81, 35, 50, 55, 55, 55, 60, 35,
+    36, 22, 19, 17, 15, 13, 11, 9, 7, 5, 4, 2, 1, 0, 0, 0, 0, 1, 2, 4,
+    6, 7, 9, 11, 13, 15, 17, 20, 22, 28, 35, 43, 55, 55, 55, 70, 35, 58, 58, 35,
+    70, 55, 55, 55, 43, 35, 28, 22, 20, 17, 15, 13, 11, 9, 7, 6, 4, 2, 1, 0,
+    0, 0, 1, 1, 2, 4, 6, 7, 10, 12, 14, 16, 18, 20, 23, 30, 35, 61, 55, 55,
+    55, 75, 35, 64, 64, 35, 75, 55, 55, 55, 61, 35, 30, 23, 20, 18, 16, 14, 12, 10,
+    7, 6, 4, 2, 1, 1, 0, 0, 1, 1, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20,
+    23, 32, 35, 62, 55, 55, 55, 44, 35, 71, 71, 35, 44, 55, 55, 55, 62, 35, 32, 23,
+    21, 18, 16, 14, 12, 10, 8, 6, 4, 2, 1, 1, 0, 0, 1, 1, 3, 5, 6, 8,
+    10, 12, 14, 16, 18, 21, 23, 33, 35, 63, 55, 55, 55, 80, 35, 22, 22, 35, 80, 55,
+    55, 55, 63, 35, 33, 23, 21, 18, 16, 14, 12, 10, 8, 6, 5, 3, 1, 1, 0, 0,
+    1, 1, 3, 5, 7, 8, 10, 12, 14, 16, 19, 21, 23, 35, 35, 51, 55, 55, 55, 78,
+    35, 13, 13, 35, 78, 55, 55, 55, 51, 35, 35, 23, 21, 19, 16, 14, 12, 10, 8, 7,
+    5, 3, 1, 1, 0, 0, 1, 2, 3, 5, 7, 8, 11, 12, 15, 17, 19, 21, 24, 35,
+    39, 54, 55, 55, 55, 68, 35, 5, 4, 35, 68, 55, 55, 55, 54, 39, 35, 24, 21, 19,
+    17, 15, 12, 11, 8, 7, 5, 3, 2, 1, 0, 0, 1, 2, 3, 5, 7, 9, 11, 13,
+    15, 17, 19, 21, 25, 35, 40, 55, 55, 55, 56, 35, 59, 59, 35, 53, 55, 55, 55, 40,
+    35, 25, 21, 19, 17, 15, 13, 11, 9, 7, 5, 3, 2, 1, 0, 0, 1, 2, 4, 5,
+    7, 9, 11, 13, 15, 17, 19, 22, 26, 35, 41, 55, 55, 55, 50, 35, 29, 29, 35, 50,
+    55, 55, 55, 41, 35, 26, 22, 19, 17, 15, 13, 11, 9, 7, 5, 4, 2, 1, 0, 0,
+    0, 1, 2, 4, 5, 7, 9, 11, 13, 15, 17, 19, 22, 27, 35, 67, 55, 55, 55, 48,
+    35, 72, 72, 35, 48, 55, 55, 55, 42, 35, 27, 22, 19, 17, 15, 13, 11, 9, 7, 5,
+    4, 2, 1, 0, 0, 0, 0, 1, 2, 4, 6, 7, 9, 11, 13, 15, 17, 20, 22, 28,
+    35, 77, 55, 55, 55, 74, 35, 36, 36, 35, 74, 55, 55, 55, 43, 35, 28, 22, 20, 17,
+    15, 13, 11, 9, 7, 6, 4, 2, 1, 0, 0, 0, 0, 1, 2, 4, 6, 7, 10, 12,
+    14, 16, 18, 20, 22, 29, 35, 76, 55, 55, 55, 45, 35, 64, 64, 35, 45, 55, 55, 55,
+    44, 35, 29, 22, 20, 18, 16, 14, 12, 10, 7, 6, 4, 2, 1, 0, 0, 0, 0, 1,
+    2, 4, 6, 7, 10, 12, 14, 16, 18, 20, 22, 30, 35, 69, 55, 55, 55, 69, 35, 37,
+    37, 35, 69, 55, 55, 55, 45, 35, 30, 22, 20, 18, 16, 14, 12, 10, 7, 6, 4, 2,
+    1, 0, 0, 0, 0, 1, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 23, 31, 35, 75,
+    55, 55, 55, 76, 35, 82, 82, 35, 76, 55, 55, 55, 46, 35, 31, 23, 20, 18, 16, 14,
+    12, 10, 8, 6, 4, 2, 1, 1, 0, 0, 1, 1, 2, 4, 6, 8, 10, 12, 14, 16,
+    18, 20, 23, 32, 35, 62, 55, 55, 55, 77, 35, 23, 22, 35, 77, 55, 55, 55, 47, 35,
+    32, 23, 20, 18, 16, 14, 12, 10, 8, 6, 4, 2, 1, 1, 0, 0, 1, 1, 2, 5,
+    6, 8, 10, 12, 14, 16, 18, 21, 23, 33, 35, 48, 55, 55, 55, 67, 35, 18, 18, 35,
+    67, 55, 55, 55, 48, 35, 33, 23, 21, 18, 16, 14, 12, 10, 8, 6, 5, 2, 1, 1,
+    0, 0, 1, 1, 2, 5, 6, 8, 10, 12, 14, 16, 18, 21, 23, 33, 35, 63, 55, 55,
+    55, 60, 35, 14, 14, 35, 41, 55, 55, 55, 49, 35, 33, 23, 21, 18, 16, 14, 12, 10,
+    8, 6, 5, 2, 1, 1, 0, 0, 1, 1, 2, 5, 6, 8, 10, 12, 14, 16, 18, 21,
+    23, 34, 35, 50, 55, 55, 55, 78, 35, 11, 11, 35, 78, 55, 55, 55, 50, 35, 34, 23,
+    21, 18, 16, 14, 12, 10, 8, 6, 5, 3, 1, 1, 0, 0, 1, 1, 3, 5, 6, 8,
+    10, 12, 14, 16, 19, 21, 23, 34, 35, 50, 55, 55, 55, 73, 35, 9, 9, 35, 73, 55,
+    55, 55, 51, 35, 34, 23, 21, 19, 16, 14, 12, 10, 8, 6, 5, 3, 1, 1, 0, 0,
+    1, 1, 3, 5, 6, 8, 10, 12, 14, 16, 19, 21, 23, 35, 35, 51, 55, 55, 55, 40,
+    35, 7, 7, 35, 40, 55, 55, 55, 52, 35, 35, 23, 21, 19, 16, 14, 12, 10, 8, 6,
+    5, 3, 1, 1, 0, 0, 1, 1, 3, 5, 7, 8, 10, 12, 14, 16, 19, 21, 23, 35,
+    35, 52, 55, 55, 55, 68, 35, 3, 3, 35, 68, 55, 55, 55, 53, 35, 35, 23, 21, 19,
+    16, 14, 12, 10, 8, 7, 5, 3, 1, 1, 0, 0, 1, 1, 3, 5, 7, 8, 10, 12,
+    14, 16, 19, 21, 23, 35, 35, 56, 55, 55, 55, 68, 35, 3, 3, 35, 68, 55, 55, 55,
+    53, 35, 35, 23, 21, 19, 16, 14, 12, 11, 8, 7, 5, 3, 1, 1, 0, 0, 1, 1,
+    3, 5, 7, 8, 11, 12, 15, 16, 19, 21, 23, 35, 35, 53, 55, 55, 55, 68, 35, 2,
+    2, 35, 39, 55, 55, 55, 54, 35, 35, 23, 21, 19, 17, 15, 12, 11, 8, 7, 5, 3,
+    1, 1, 0, 0, 1, 1, 3, 5, 7, 8, 11, 12, 15, 17, 19, 21, 23, 35, 35, 53,
+    55, 55, 55, 35, 35, 35, 35, 55, 55, 55, 55, 35, 35, 23, 21, 19, 17, 15, 12, 11,
+    8, 7, 5, 3, 1, 1, 0, 0, 1, 1, 3, 5, 7, 8, 11, 12, 15, 17, 19, 21,
+    23, 35, 35, 55, 55, 55, 55, 35, 35, 35, 35, 55, 55, 55, 55, 35, 35, 23, 21, 19,
+    17, 15, 12, 11, 8, 7, 5, 3, 1, 1, 0, 0, 1, 1, 3, 5, 7, 8, 11, 12,
+    15, 17, 19, 21, 23, 35, 35, 55, 55, 55, 55, 35, 35, 35, 35, 55, 55, 55, 55, 35,
+    35, 23, 21, 19, 17, 15, 12, 11, 8, 7, 5, 3, 1, 1, 0, 0, 1, 1, 3, 5,
+    7, 8, 11, 12, 15, 17, 19, 21, 23, 35, 35, 53, 55, 55, 55, 68, 35, 3, 35, 35,
+    55, 55, 55, 55, 35, 35, 23, 21, 19, 17, 15, 12, 11, 8, 7, 5, 3, 1, 1, 0,
+    0, 1, 1, 3, 5, 7, 8, 11, 12, 14, 16, 19, 21, 23, 35, 35, 53, 55, 55, 55,
+    68, 35, 3, 2, 35, 39, 55, 55, 55, 54, 35, 35, 23, 21, 19, 17, 15, 12, 11, 8,
+    7, 5, 3, 1, 1, 0, 0, 1, 1, 3, 5, 7, 8, 10, 12, 14, 16, 19, 21, 23,
+    35, 35, 56, 55, 55, 55, 40, 35, 6, 3, 35, 68, 55, 55, 55, 53, 35, 35, 23, 21,
+    19, 16, 14, 12, 11, 8, 7, 5, 3, 1, 1, 0, 0, 1, 1, 3, 5, 6, 8, 10,
+    12, 14, 16, 19, 21, 23, 35, 35, 52, 55, 55, 55, 83, 35, 7, 3, 35, 68, 55, 55,
+    55, 53, 35, 35, 23, 21, 19, 16, 14, 12, 10, 8, 7, 5, 3, 1, 1, 0, 0, 1,
+    1, 3, 5, 6, 8, 10, 12, 14, 16, 19, 21, 23, 34, 35, 51, 55, 55, 55, 73, 35,
+    8, 7, 35, 40, 55, 55, 55, 52, 35, 35, 23, 21, 19, 16, 14, 12, 10, 8, 6, 5,
+    3, 1, 1, 0, 0, 1, 1, 3, 5, 6, 8, 10, 12, 14, 16, 19, 21, 23, 34, 35,
+    50, 55, 55, 55, 78, 35, 11, 9, 35, 73, 55, 55, 55, 51, 35, 34, 23, 21, 19, 16,
+    14, 12, 10, 8, 6, 5, 3, 1, 1, 0, 0, 1, 1, 2, 5, 6, 8, 10, 12, 14,
+    16, 18, 21, 23, 34, 35, 50, 55, 55, 55, 78, 35, 11, 11, 35, 78, 55, 55, 55, 50,
+    35, 34, 23, 21, 18, 16, 14, 12, 10, 8, 6, 5, 3, 1, 1, 0, 0, 1, 1, 2,
+    5, 6, 8, 10, 12, 14, 16, 18, 21, 23, 33, 35, 63, 55, 55, 55, 60, 35, 15, 14,
+    35, 41, 55, 55, 55, 49, 35, 33, 23, 21, 18, 16, 14, 12, 10, 8, 6, 5, 2, 1,
+    1, 0, 0, 1, 1, 2, 5, 6, 8, 10, 12, 14, 16, 18, 21, 23, 33, 35, 48, 55,
+    55, 55, 67, 35, 18, 18, 35, 67, 55, 55, 55, 48, 35, 33, 23, 21, 18, 16, 14, 12,
+    10, 8, 6, 5, 2, 1, 1, 0, 0, 1, 1, 2, 4, 6, 8, 10, 12, 14, 16, 18,
+    20, 23, 32, 35, 62, 55, 55, 55, 77, 35, 23, 22, 35, 77, 55, 55, 55, 47, 35, 32,
+    23, 20, 18, 16, 14, 12, 10, 8, 6, 4, 2, 1, 1, 0, 0, 0, 1, 2, 4, 6,
+    8, 10, 12, 14, 16, 18, 20, 23, 31, 35, 75, 55, 55, 55, 76, 35, 82, 82, 35, 76,
+    55, 55, 55, 46, 35, 31, 23, 20, 18, 16, 14, 12, 10, 8, 6, 4, 2, 1, 1, 0,
+    0, 0, 1, 2, 4, 6, 7, 10, 12, 14, 16, 18, 20, 22, 30, 35, 69, 55, 55, 55,
+    69, 35, 37, 37, 35, 69, 55, 55, 55, 45, 35, 30, 22, 20, 18, 16, 14, 12, 10, 7,
+    6, 4, 2, 1, 0, 0, 0, 0, 1, 2, 4, 6, 7, 10, 12, 14, 16, 18, 20, 22,
+    29, 35, 76, 55, 55, 55, 45, 35, 64, 64, 35, 45, 55, 55, 55, 44, 35, 29, 22, 20,
+    18, 16, 14, 12, 10, 7, 6, 4, 2, 1, 0, 0, 0, 0, 1, 2, 4, 6, 7, 9,
+    11, 13, 15, 17, 20, 22, 28, 35, 77, 55, 55, 55, 74, 35, 36, 36, 35, 74, 55, 55,
+    55, 43, 35, 28, 22, 20, 17, 15, 13, 11, 9, 7, 6, 4, 2, 1, 0, 0, 0, 0,
+    1, 2, 4, 5, 7, 9, 11, 13, 15, 17, 19, 22, 27, 35, 67, 55, 55, 55, 48, 35,
+    72, 72, 35, 48, 55, 55, 55, 42, 35, 27, 22, 19, 17, 15, 13, 11, 9, 7, 5, 4,
+    2, 1, 0, 0, 0, 1, 2, 4, 5, 7, 9, 11, 13, 15, 17, 19, 22, 26, 35, 41,
+    55, 55, 55, 50, 35, 29, 29, 35, 50, 55, 55, 55, 41, 35, 26, 22, 19, 17, 15, 13,
+    11, 9, 7, 5, 4, 2, 1, 0, 0, 1, 2, 3, 5, 7, 9, 11, 13, 15, 17, 19,
+    21, 25, 35, 40, 55, 55, 55, 56, 35, 59, 59, 35, 56, 55, 55, 55, 40, 35, 25, 21,
+    19, 17, 15, 13, 11, 9, 7, 5, 3, 2, 1, 0, 0, 1, 2, 3, 5, 7, 8, 11,
+    12, 15, 17, 19, 21, 24, 35, 39, 54, 55, 55, 55, 39, 35, 5, 4, 35, 39, 55, 55,
+    55, 54, 39, 35, 24, 21, 19, 17, 15, 12, 11, 8, 7, 5, 3, 2, 1, 0, 0, 1,
+    1, 3, 5, 7, 8, 10, 12, 14, 16, 19, 21, 23, 35, 35, 51, 55, 55, 55, 73, 35,
+    13, 13, 35, 73, 55, 55, 55, 52, 35, 35, 23, 21, 19, 16, 14, 12, 10, 8, 7, 5,
+    3, 1, 1, 0, 0, 1, 1, 3, 5, 6, 8, 10, 12, 14, 16, 18, 21, 23, 33, 35,
+    63, 55, 55, 55, 67, 35, 22, 22, 35, 67, 55, 55, 55, 63, 35, 33, 23, 21, 18, 16,
+    14, 12, 10, 8, 6, 5, 3, 1, 1, 0, 0, 1, 1, 2, 4, 6, 8, 10, 12, 14,
+    16, 18, 20, 23, 32, 35, 62, 55, 55, 55, 43, 35, 71, 71, 35, 43, 55, 55, 55, 62,
+    35, 32, 23, 21, 18, 16, 14, 12, 10, 8, 6, 4, 2, 1, 1, 0, 0, 1, 1, 2,
+    4, 6, 7, 10, 12, 14, 16, 18, 20, 23, 30, 35, 61, 55, 55, 55, 61, 35, 64, 64,
+    35, 61, 55, 55, 55, 61, 35, 30, 23, 20, 18, 16, 14, 12, 10, 7, 6, 4, 2, 1,
+    1, 0, 0, 0, 1, 2, 4, 6, 7, 9, 11, 13, 15, 17, 20, 22, 28, 35, 43, 55,
+    55, 55, 47, 35, 58, 58, 35, 47, 55, 55, 55, 43, 35, 28, 22, 20, 17, 15, 13, 11,
+    9, 7, 6, 4, 2, 1, 0, 0, 0, 0, 1, 2, 4, 5, 7, 9, 11, 13, 15, 17,
+    19, 22, 36, 35, 60, 55, 55, 55, 50, 35, 81, 81, 35, 50, 55, 55, 55, 60, 35, 36,
+    22, 19, 17, 15, 13, 11, 9, 7, 5, 4, 2, 1, 0, 0, 0, 0, 1, 2, 3, 5,
+    7, 9, 11, 13, 15, 17, 19, 21, 25, 35, 40, 55, 55, 55, 53, 35, 33, 0, 0, 33,
+    35, 53, 55, 55, 55, 40, 35, 25, 21, 19, 17, 15, 13, 11, 9, 7, 5, 3, 2, 1,
+    0, 0, 0, 1, 2, 3, 5, 7, 8, 11, 12, 15, 17, 19, 21, 23, 35, 35, 53, 55,
+    55, 55, 83, 35, 11, 11, 35, 83, 55, 55, 55, 53, 35, 35, 23, 21, 19, 17, 15, 12,
+    11, 8, 7, 5, 3, 2, 1, 0, 0, 1, 1, 3, 5, 6, 8, 10, 12, 14, 16, 19,
+    21, 23, 34, 35, 63, 55, 55, 55, 42, 35, 23, 23, 35, 42, 55, 55, 55, 63, 35, 34,
+    23, 21, 19, 16, 14, 12, 10, 8, 6, 5, 3, 1, 1, 0, 0, 1, 1, 2, 5, 6,
+    8, 10, 12, 14, 16, 18, 21, 23, 38, 35, 46, 55, 55, 55, 44, 35, 79, 79, 35, 44,
+    55, 55, 55, 46, 35, 38, 23, 21, 18, 16, 14, 12, 10, 8, 6, 5, 2, 1, 1, 0,
+    0, 1, 1, 2, 4, 6, 7, 10, 12, 14, 16, 18, 20, 22, 29, 35, 44, 55, 55, 55,
+    74, 35, 58, 58, 35, 74, 55, 55, 55, 44, 35, 29, 22, 20, 18, 16, 14, 12, 10, 7,
+    6, 4, 2, 1, 1, 0, 0, 0, 1, 2, 4, 6, 7, 9, 11, 13, 15, 17, 20, 22,
+    27, 35, 67, 55, 55, 55, 50, 35, 31, 31, 35, 50, 55, 55, 55, 67, 35, 58, 22, 20,
+    17, 15, 13, 11, 9, 7, 6, 4, 2, 1, 0, 0, 0, 0, 1, 2, 4, 5, 7, 9,
+    11, 13, 15, 17, 19, 22, 25, 35, 66, 55, 55, 55, 54, 39, 35, 4, 4, 35, 39, 54,
+    55, 55, 55, 66, 35, 25, 22, 19, 17, 15, 13, 11, 9, 7, 5, 4, 2, 1, 0, 0,
+    0, 0, 1, 2, 3, 5, 7, 8, 10, 12, 15, 17, 19, 21, 23, 35, 35, 52, 55, 55,
+    55, 41, 35, 16, 16, 35, 41, 55, 55, 55, 52, 35, 35, 23, 21, 19, 17, 15, 12, 10,
+    8, 7, 5, 3, 2, 1, 0, 0, 0, 1, 1, 3, 5, 6, 8, 10, 12, 14, 16, 18,
+    21, 23, 59, 35, 70, 55, 55, 55, 43, 35, 71, 71, 35, 43, 55, 55, 55, 70, 35, 59,
+    23, 21, 18, 16, 14, 12, 10, 8, 6, 5, 3, 1, 1, 0, 0, 1, 1, 2, 4, 6,
+    8, 10, 12, 14, 16, 18, 20, 23, 30, 35, 69, 55, 55, 55, 46, 35, 27, 27, 35, 46,
+    55, 55, 55, 69, 35, 30, 23, 20, 18, 16, 14, 12, 10, 8, 6, 4, 2, 1, 1, 0,
+    0, 1, 1, 2, 4, 6, 7, 9, 11, 13, 15, 17, 20, 22, 72, 35, 67, 55, 55, 55,
+    50, 35, 38, 38, 35, 50, 55, 55, 55, 67, 35, 58, 22, 20, 17, 15, 13, 11, 9, 7,
+    6, 4, 2, 1, 1, 0, 0, 0, 1, 2, 4, 5, 7, 9, 11, 13, 15, 17, 19, 22,
+    25, 35, 68, 55, 55, 55, 55, 68, 35, 9, 9, 35, 68, 55, 55, 55, 54, 68, 35, 25,
+    22, 19, 17, 15, 13, 11, 9, 7, 5, 4, 2, 1, 0, 0, 0, 0, 1, 2, 3, 5,
+    7, 8, 10, 12, 15, 17, 19, 21, 23, 35, 35, 57, 55, 55, 55, 67, 35, 24, 24, 35,
+    67, 55, 55, 55, 49, 35, 35, 23, 21, 19, 17, 15, 12, 10, 8, 7, 5, 3, 2, 1,
+    0, 0, 0, 1, 1, 3, 5, 6, 8, 10, 12, 14, 16, 18, 21, 23, 32, 35, 46, 55,
+    55, 55, 61, 35, 26, 26, 35, 61, 55, 55, 55, 75, 35, 32, 23, 21, 18, 16, 14, 12,
+    10, 8, 6, 5, 3, 1, 1, 0, 0, 1, 1, 2, 4, 6, 7, 10, 12, 14, 16, 18,
+    20, 23, 65, 35, 43, 55, 55, 55, 63, 35, 81, 81, 35, 63, 55, 55, 55, 77, 35, 65,
+    23, 20, 18, 16, 14, 12, 10, 7, 6, 4, 2, 1, 1, 0, 0, 0, 1, 2, 4, 6,
+    7, 9, 11, 13, 15, 17, 20, 22, 64, 35, 73, 55, 55, 55, 54, 39, 35, 5, 5, 35,
+    39, 54, 55, 55, 55, 40, 35, 64, 22, 20, 17, 15, 13, 11, 9, 7, 6, 4, 2, 1,
+    0, 0, 0, 0, 1, 2, 3, 5, 7, 8, 11, 12, 15, 17, 19, 21, 24, 35, 35, 52,
+    55, 55, 55, 60, 35, 21, 21, 35, 60, 55, 55, 55, 51, 35, 35, 24, 21, 19, 17, 15,
+    12, 11, 8, 7, 5, 3, 2, 1, 0, 0, 0, 0, 1, 2, 3, 5, 6, 8, 10, 12,
+    14, 16, 19, 21, 23, 59, 35, 74, 55, 55, 55, 61, 35, 26, 26, 35, 61, 55, 55, 55,
+    74, 35, 59, 23, 21, 19, 16, 14, 12, 10, 8, 6, 5, 3, 2, 1, 0, 0, 0, 1,
+    1, 2, 4, 6, 7, 10, 12, 14, 16, 18, 20, 23, 65, 35, 43, 55, 55, 55, 49, 35,
+    30, 30, 35, 49, 55, 55, 55, 43, 35, 65, 23, 20, 18, 16, 14, 12, 10, 7, 6, 4,
+    2, 1, 1, 0, 0, 1, 1, 2, 4, 6, 7, 9, 11, 13, 15, 17, 20, 22, 64, 35,
+    40, 55, 55, 55, 54, 66, 35, 9, 9, 35, 66, 55, 55, 55, 55, 40, 35, 64, 22, 20,
+    17, 15, 13, 11, 9, 7, 6, 4, 2, 1, 1, 0, 0, 0, 1, 2, 3, 5, 7, 8,
+    11, 12, 15, 17, 19, 21, 24, 35, 35, 50, 55, 55, 55, 77, 35, 71, 71, 35, 77, 55,
+    55, 55, 50, 35, 35, 24, 21, 19, 17, 15, 12, 11, 8, 7, 5, 3, 2, 1, 0, 0,
+    0, 0, 1, 2, 3, 5, 6, 8, 10, 12, 14, 16, 18, 21, 23, 38, 35, 75, 55, 55,
+    55, 62, 35, 72, 72, 35, 74, 55, 55, 55, 75, 35, 38, 23, 21, 18, 16, 14, 12, 10,
+    8, 6, 5, 3, 2, 1, 0, 0, 0, 1, 1, 2, 4, 6, 7, 9, 11, 13, 16, 18,
+    20, 22, 72, 35, 67, 55, 55, 55, 53, 39, 33, 2, 2, 33, 39, 53, 55, 55, 55, 67,
+    35, 72, 22, 20, 18, 16, 13, 11, 9, 7, 6, 4, 2, 1, 1, 0, 0, 1, 1, 2,
+    4, 5, 7, 9, 11, 13, 15, 17, 19, 22, 71, 35, 39, 53, 55, 55, 55, 60, 35, 21,
+    21, 35, 60, 55, 55, 55, 53, 39, 35, 71, 22, 19, 17, 15, 13, 11, 9, 7, 5, 4,
+    2, 1, 1, 0, 0, 0, 1, 2, 3, 5, 7, 8, 10, 12, 14, 16, 19, 21, 23, 33,
+    35, 47, 55, 55, 55, 45, 35, 36, 36, 35, 45, 55, 55, 55, 47, 35, 33, 23, 21, 19,
+    16, 14, 12, 10, 8, 7, 5, 3, 2, 1, 0, 0, 0, 0, 1, 1, 3, 5, 6, 8,
+    10, 12, 14, 16, 18, 20, 23, 29, 35, 43, 55, 55, 55, 51, 35, 59, 1, 1, 59, 35,
+    57, 55, 55, 55, 43, 35, 29, 23, 20, 18, 16, 14, 12, 10, 8, 6, 5, 3, 1, 1,
+    0, 0, 0, 1, 1, 2, 4, 6, 7, 9, 11, 13, 15, 17, 20, 22, 79, 35, 68, 54,
+    55, 55, 55, 78, 35, 19, 18, 35, 78, 55, 55, 55, 54, 66, 35, 79, 22, 20, 17, 15,
+    13, 11, 9, 7, 6, 4, 2, 1, 1, 0, 0, 0, 1, 2, 4, 5, 7, 8, 10, 12,
+    15, 17, 19, 21, 23, 34, 35, 70, 55, 55, 55, 61, 35, 26, 26, 35, 69, 55, 55, 55,
+    48, 35, 34, 23, 21, 19, 17, 15, 12, 10, 8, 7, 5, 4, 2, 1, 0, 0, 0, 0,
+    1, 2, 3, 5, 6, 8, 10, 12, 14, 16, 18, 21, 23, 81, 35, 77, 55, 55, 55, 57,
+    35, 32, 1, 1, 32, 35, 57, 55, 55, 55, 76, 35, 81, 23, 21, 18, 16, 14, 12, 10,
+    8, 6, 5, 3, 2, 1, 0, 0, 0, 0, 1, 1, 2, 4, 6, 7, 9, 11, 13, 15,
+    17, 20, 22, 64, 35, 68, 54, 55, 55, 55, 41, 35, 21, 21, 35, 41, 55, 55, 55, 54,
+    40, 35, 64, 22, 20, 17, 15, 13, 11, 9, 7, 6, 4, 2, 1, 1, 0, 0, 0, 1,
+    1, 2, 4, 5, 7, 8, 11, 12, 15, 17, 19, 21, 23, 34, 35, 47, 55, 55, 55, 45,
+    35, 27, 27, 35, 45, 55, 55, 55, 48, 35, 34, 23, 21, 19, 17, 15, 12, 11, 8, 7,
+    5, 4, 2, 1, 1, 0, 0, 0, 1, 2, 3, 5, 6, 8, 10, 12, 14, 16, 18, 21,
+    23, 81, 35, 77, 55, 55, 55, 52, 35, 33, 4, 4, 33, 35, 52, 55, 55, 55, 43, 35,
+    81, 23, 21, 18, 16, 14, 12, 10, 8, 6, 5, 3, 2, 1, 0, 0, 0, 0, 1, 1,
+    2, 4, 6, 7, 9, 11, 13, 15, 17, 20, 22, 79, 35, 68, 54, 55, 55, 55, 67, 35,
+    82, 82, 35, 67, 55, 55, 55, 54, 68, 35, 79, 22, 20, 17, 15, 13, 11, 9, 7, 6,
+    4, 2, 1, 1, 0, 0, 0, 1, 1, 2, 4, 5, 7, 8, 10, 12, 14, 17, 19, 21,
+    23, 33, 35, 62, 55, 55, 55, 62, 35, 65, 65, 35, 62, 55, 55, 55, 62, 35, 33, 23,
+    21, 19, 17, 14, 12, 10, 8, 7, 5, 4, 2, 1, 1, 0, 0, 0, 1, 2, 3, 5,
+    6, 8, 10, 12, 14, 16, 18, 21, 23, 65, 35, 42, 55, 55, 55, 54, 66, 35, 11, 11,
+    35, 66, 54, 55, 55, 55, 42, 35, 65, 23, 21, 18, 16, 14, 12, 10, 8, 6, 5, 3,
+    2, 1, 0, 0, 0, 0, 1, 1, 2, 4, 6, 7, 9, 11, 13, 15, 17, 20, 22, 71,
+    35, 39, 52, 55, 55, 55, 76, 35, 64, 64, 35, 76, 55, 55, 55, 52, 39, 35, 71, 22,
+    20, 17, 15, 13, 11, 9, 7, 6, 4, 2, 1, 1, 0, 0, 0, 1, 1, 2, 4, 5,
+    7, 8, 10, 12, 14, 16, 19, 21, 23, 32, 35, 61, 55, 55, 55, 50, 35, 32, 2, 2,
+    32, 35, 50, 55, 55, 55, 61, 35, 32, 23, 21, 19, 16, 14, 12, 10, 8, 7, 5, 4,
+    2, 1, 1, 0, 0, 0, 1, 2, 3, 5, 6, 7, 10, 11, 14, 16, 18, 20, 23, 27,
+    35, 73, 55, 55, 55, 55, 60, 35, 24, 24, 35, 60, 55, 55, 55, 55, 73, 35, 27, 23,
+    20, 18, 16, 14, 11, 10, 7, 6, 5, 3, 2, 1, 0, 0, 0, 0, 1, 1, 2, 4,
+    5, 7, 9, 11, 12, 15, 17, 19, 22, 24, 35, 35, 48, 55, 55, 55, 74, 35, 65, 65,
+    35, 74, 55, 55, 55, 48, 35, 35, 24, 22, 19, 17, 15, 12, 11, 9, 7, 5, 4, 2,
+    1, 1, 0, 0, 0, 1, 1, 2, 3, 5, 6, 8, 10, 12, 14, 16, 18, 21, 23, 81,
+    35, 80, 55, 55, 55, 54, 66, 35, 14, 14, 35, 66, 54, 55, 55, 55, 80, 35, 81, 23,
+    21, 18, 16, 14, 12, 10, 8, 6, 5, 3, 2, 1, 1, 0, 0, 0, 1, 1, 2, 4,
+    6, 7, 9, 11, 13, 15, 17, 20, 22, 37, 35, 39, 52, 55, 55, 55, 69, 35, 36, 36,
+    35, 69, 55, 55, 55, 52, 39, 35, 37, 22, 20, 17, 15, 13, 11, 9, 7, 6, 4, 2,
+    1, 1, 0, 0, 0, 0, 1, 1, 2, 4, 5, 7, 8, 10, 12, 14, 16, 19, 21, 23,
+    32, 35, 69, 55, 55, 55, 52, 39, 34, 7, 7, 34, 39, 52, 55, 55, 55, 69, 35, 32,
+    23, 21, 19, 16, 14, 12, 10, 8, 7, 5, 4, 2, 1, 1, 0, 0, 0, 0, 1, 2,
+    3, 5, 6, 8, 10, 11, 14, 16, 18, 20, 23, 36, 35, 66, 54, 55, 55, 55, 43, 35,
+    79, 79, 35, 43, 55, 55, 55, 54, 40, 35, 36, 23, 20, 18, 16, 14, 11, 10, 8, 6,
+    5, 3, 2, 1, 0, 0, 0, 0, 1, 1, 2, 4, 6, 7, 9, 11, 12, 15, 17, 19,
+    21, 23, 34, 35, 74, 55, 55, 55, 49, 35, 59, 4, 4, 59, 35, 49, 55, 55, 55, 74,
+    35, 34, 23, 21, 19, 17, 15, 12, 11, 9, 7, 6, 4, 2, 1, 1, 0, 0, 0, 0,
+    1, 1, 2, 3, 5, 6, 8, 10, 12, 14, 16, 18, 21, 23, 28, 35, 41, 55, 55, 55,
+    55, 67, 35, 37, 37, 35, 67, 55, 55, 55, 55, 41, 35, 28, 23, 21, 18, 16, 14, 12,
+    10, 8, 6, 5, 3, 2, 1, 1, 0, 0, 0, 0, 1, 1, 2, 4, 6, 7, 9, 11,
+    13, 15, 17, 19, 22, 24, 35, 35, 48, 55, 55, 55, 48, 35, 38, 1, 1, 38, 35, 48,
+    55, 55, 55, 48, 35, 35, 24, 22, 19, 17, 15, 13, 11, 9, 7, 6, 4, 2, 1, 1,
+    0, 0, 0, 0, 1, 1, 2, 4, 5, 7, 8, 10, 12, 14, 16, 19, 21, 23, 29, 35,
+    67, 55, 55, 55, 55, 41, 35, 71, 82, 35, 41, 55, 55, 55, 55, 67, 35, 29, 23, 21,
+    18, 16, 14, 12, 10, 8, 7, 5, 4, 2, 1, 1, 0, 0, 0, 0, 1, 2, 3, 5,
+    6, 7, 9, 11, 13, 15, 17, 20, 22, 71, 35, 35, 49, 55, 55, 55, 70, 35, 31, 1,
+    1, 31, 35, 70, 55, 55, 55, 49, 35, 35, 71, 22, 20, 17, 15, 13, 11, 9, 7, 6,
+    5, 3, 2, 1, 0, 0, 0, 0, 1, 1, 2, 4, 5, 7, 8, 10, 12, 14, 16, 19,
+    21, 23, 30, 35, 80, 55, 55, 55, 55, 78, 35, 82, 82, 35, 78, 55, 55, 55, 55, 80,
+    35, 30, 23, 21, 19, 16, 14, 12, 10, 8, 7, 5, 4, 2, 1, 1, 0, 0, 0, 0,
+    1, 1, 2, 3, 5, 6, 7, 9, 11, 13, 15, 17, 20, 22, 37, 35, 35, 50, 55, 55,
+    55, 70, 35, 31, 1, 1, 31, 35, 47, 55, 55, 55, 50, 35, 35, 37, 22, 20, 17, 15,
+    13, 11, 9, 7, 6, 5, 3, 2, 1, 1, 0, 0, 0, 0, 1, 1, 2, 4, 5, 7,
+    8, 10, 12, 14, 16, 19, 21, 23, 31, 35, 77, 55, 55, 55, 55, 78, 35, 71, 71, 35,
+    78, 55, 55, 55, 55, 80, 35, 31, 23, 21, 19, 16, 14, 12, 10, 8, 7, 5, 4, 2,
+    1, 1, 0, 0, 0, 0, 1, 1, 2, 3, 5, 6, 8, 10, 11, 13, 15, 18, 20, 22,
+    25, 35, 35, 57, 55, 55, 55, 70, 35, 38, 3, 3, 38, 35, 70, 55, 55, 55, 49, 35,
+    35, 25, 22, 20, 18, 15, 13, 11, 10, 8, 6, 5, 3, 2, 1, 1, 0, 0, 0, 0,
+    1, 1, 2, 4, 5, 7, 8, 10, 12, 14, 17, 19, 21, 23, 31, 35, 77, 55, 55, 55,
+    55, 60, 35, 25, 25, 35, 60, 55, 55, 55, 55, 42, 35, 31, 23, 21, 19, 17, 14, 12,
+    10, 8, 7, 5, 4, 2, 1, 1, 0, 0, 0, 0, 1, 1, 2, 3, 5, 6, 8, 10,
+    11, 13, 15, 18, 20, 22, 25, 35, 35, 50, 55, 55, 55, 63, 35, 59, 6, 6, 59, 35,
+    63, 55, 55, 55, 49, 35, 35, 25, 22, 20, 18, 15, 13, 11, 10, 8, 6, 5, 3, 2,
+    1, 1, 0, 0, 0, 0, 1, 1, 2, 4, 6, 7, 8, 10, 12, 14, 17, 19, 21, 23,
+    30, 35, 42, 55, 55, 55, 55, 80, 35, 26, 26, 35, 80, 55, 55, 55, 55, 67, 35, 30,
+    23, 21, 19, 17, 14, 12, 10, 8, 7, 6, 4, 2, 1, 1, 0, 0, 0, 0, 1, 1,
+    2, 3, 5, 6, 8, 10, 11, 13, 15, 18, 20, 22, 37, 35, 35, 63, 55, 55, 55, 57,
+    39, 34, 11, 11, 34, 39, 57, 55, 55, 55, 63, 35, 35, 37, 22, 20, 18, 15, 13, 11,
+    10, 8, 6, 5, 3, 2, 1, 1, 0, 0, 0, 0, 0, 1, 1, 2, 4, 6, 7, 8,
+    10, 12, 14, 16, 19, 21, 23, 81, 35, 41, 55, 55, 55, 55, 44, 35, 72, 72, 35, 76,
+    55, 55, 55, 55, 41, 35, 81, 23, 21, 19, 16, 14, 12, 10, 8, 7, 6, 4, 2, 1,
+    1, 0, 0, 0, 0, 0, 1, 1, 2, 3, 5, 6, 8, 9, 11, 13, 15, 17, 20, 22,
+    82, 35, 35, 74, 55, 55, 55, 56, 68, 35, 20, 20, 35, 68, 56, 55, 55, 55, 62, 35,
+    35, 82, 22, 20, 17, 15, 13, 11, 9, 8, 6, 5, 3, 2, 1, 1, 0, 0, 0, 0,
+    0, 1, 1, 2, 4, 5, 7, 8, 10, 12, 14, 16, 19, 21, 23, 28, 35, 40, 53, 55,
+    55, 55, 75, 35, 30, 1, 1, 30, 35, 75, 55, 55, 55, 54, 40, 35, 28, 23, 21, 19,
+    16, 14, 12, 10, 8, 7, 5, 4, 2, 1, 1, 0, 0, 0, 0, 0, 1, 1, 2, 3,
+    5, 6, 7, 9, 11, 13, 15, 17, 19, 22, 24, 34, 35, 69, 55, 55, 55, 54, 78, 35,
+    25, 25, 35, 78, 54, 55, 55, 55, 69, 35, 34, 24, 22, 19, 17, 15, 13, 11, 9, 7,
+    6, 5, 3, 2, 1, 1, 0, 0, 0, 0, 0, 1, 1, 2, 4, 5, 7, 8, 10, 12,
+    14, 16, 18, 21, 23, 27, 35, 39, 52, 55, 55, 55, 63, 35, 33, 9, 9, 33, 35, 63,
+    55, 55, 55, 52, 39, 35, 27, 23, 21, 18, 16, 14, 12, 10, 8, 7, 5, 4, 2, 1,
+    1, 0, 0, 0, 0, 0, 1, 1, 2, 3, 5, 6, 7, 9, 11, 13, 15, 17, 19, 21,
+    23, 59, 35, 80, 55, 55, 55, 55, 43, 35, 72, 72, 35, 43, 55, 55, 55, 55, 77, 35,
+    59, 23, 21, 19, 17, 15, 13, 11, 9, 7, 6, 5, 3, 2, 1, 1, 0, 0, 0, 0,
+    0, 1, 1, 2, 4, 5, 7, 8, 10, 12, 14, 16, 18, 20, 22, 79, 35, 35, 63, 55,
+    55, 55, 56, 66, 35, 23, 23, 35, 66, 56, 55, 55, 55, 63, 35, 35, 79, 22, 20, 18,
+    16, 14, 12, 10, 8, 7, 5, 4, 2, 1, 1, 0, 0, 0, 0, 0, 1, 1, 2, 3,
+    5, 6, 7, 9, 11, 12, 15, 17, 19, 21, 23, 81, 35, 78, 54, 55, 55, 55, 46, 35,
+    38, 5, 4, 38, 35, 46, 55, 55, 55, 54, 41, 35, 81, 23, 21, 19, 17, 15, 12, 11,
+    9, 7, 6, 5, 3, 2, 1, 1, 0, 0, 0, 0, 0, 1, 1, 2, 4, 5, 6, 8,
+    10, 11, 13, 15, 17, 20, 22, 82, 34, 35, 45, 55, 55, 55, 55, 60, 35, 36, 36, 35,
+    60, 55, 55, 55, 55, 45, 35, 34, 82, 22, 20, 17, 15, 13, 11, 10, 8, 6, 5, 4,
+    2, 1, 1, 0, 0, 0, 0, 0, 1, 1, 2, 3, 4, 6, 7, 8, 10, 12, 14, 16,
+    19, 21, 23, 27, 35, 68, 51, 55, 55, 55, 51, 68, 35, 19, 19, 35, 68, 51, 55, 55,
+    55, 51, 68, 35, 27, 23, 21, 19, 16, 14, 12, 10, 8, 7, 6, 4, 3, 2, 1, 1,
+    0, 0, 0, 0, 1, 1, 2, 3, 5, 6, 7, 9, 11, 13, 15, 17, 19, 21, 23, 38,
+    35, 42, 55, 55, 55, 55, 75, 35, 31, 4, 4, 31, 35, 75, 55, 55, 55, 55, 42, 35,
+    32, 23, 21, 19, 17, 15, 13, 11, 9, 7, 6, 5, 3, 2, 1, 1, 0, 0, 0, 0,
+    1, 1, 2, 2, 4, 5, 7, 8, 10, 12, 14, 16, 18, 20, 22, 37, 35, 35, 62, 55,
+    55, 55, 55, 60, 35, 36, 36, 35, 60, 55, 55, 55, 55, 62, 35, 35, 37, 22, 20, 18,
+    16, 14, 12, 10, 8, 7, 5, 4, 2, 2, 1, 1, 0, 0, 0, 0, 1, 1, 2, 3,
+    5, 6, 7, 9, 11, 12, 15, 17, 19, 21, 23, 28, 35, 66, 56, 55, 55, 55, 51, 68,
+    35, 22, 22, 35, 68, 51, 55, 55, 55, 56, 66, 35, 28, 23, 21, 19, 17, 15, 12, 11,
+    9, 7, 6, 5, 3, 2, 1, 1, 0, 0, 0, 0, 0, 1, 1, 2, 4, 5, 6, 8,
+    10, 11, 13, 15, 17, 19, 22, 24, 59, 35, 80, 55, 55, 55, 55, 74, 35, 32, 7, 7,
+    32, 35, 46, 55, 55, 55, 55, 80, 35, 59, 24, 22, 19, 17, 15, 13, 11, 10, 8, 6,
+    5, 4, 2, 1, 1, 0, 0, 0, 0, 0, 1, 1, 2, 3, 4, 6, 7, 8, 10, 12,
+    14, 16, 18, 20, 23, 25, 35, 35, 62, 55, 55, 55, 55, 77, 35, 72, 0, 0, 72, 35,
+    42, 55, 55, 55, 55, 62, 35, 35, 25, 23, 20, 18, 16, 14, 12, 10, 8, 7, 6, 4,
+    3, 2, 1, 1, 0, 0, 0, 0, 0, 1, 1, 2, 3, 5, 6, 7, 9, 11, 12, 15,
+    17, 19, 21, 23, 28, 35, 66, 52, 55, 55, 55, 53, 83, 35, 37, 37, 35, 40, 56, 55,
+    55, 55, 52, 66, 35, 28, 23, 21, 19, 17, 15, 12, 11, 9, 7, 6, 5, 3, 2, 1,
+    1, 0, 0, 0, 0, 0, 1, 1, 1, 2, 4, 5, 7, 8, 10, 11, 13, 15, 17, 20,
+    22, 23, 59, 35, 67, 55, 55, 55, 55, 63, 39, 34, 15, 15, 34, 35, 48, 55, 55, 55,
+    55, 67, 35, 59, 23, 22, 20, 17, 15, 13, 11, 10, 8, 7, 5, 4, 2, 1, 1, 1,
+    0, 0, 0, 0, 1, 1, 2, 3, 4, 6, 7, 8, 10, 12, 14, 16, 18, 20, 22, 37,
+    35, 35, 75, 55, 55, 55, 55, 69, 35, 30, 5, 5, 30, 35, 44, 55, 55, 55, 55, 75,
+    35, 35, 37, 22, 20, 18, 16, 14, 12, 10, 8, 7, 6, 4, 3, 2, 1, 1, 0, 0,
+    0, 0, 0, 1, 1, 2, 4, 5, 6, 7, 9, 11, 12, 15, 17, 19, 21, 23, 58, 35,
+    39, 50, 55, 55, 55, 54, 60, 35, 72, 0, 0, 72, 35, 60, 54, 55, 55, 55, 50, 39,
+    35, 58, 23, 21, 19, 17, 15, 12, 11, 9, 7, 6, 5, 4, 2, 1, 1, 0, 0, 0,
+    0, 0, 1, 1, 2, 2, 4, 5, 7, 8, 10, 11, 13, 15, 17, 19, 21, 23, 31, 35,
+    73, 53, 55, 55, 55, 52, 66, 35, 25, 25, 35, 66, 52, 55, 55, 55, 54, 73, 35, 31,
+    23, 21, 19, 17, 15, 13, 11, 10, 8, 7, 5, 4, 2, 2, 1, 1, 0, 0, 0, 0,
+    0, 1, 1, 2, 3, 4, 6, 7, 8, 10, 12, 14, 16, 18, 20, 22, 82, 34, 35, 43,
+    55, 55, 55, 55, 48, 39, 34, 18, 18, 34, 39, 48, 55, 55, 55, 55, 43, 35, 34, 82,
+    22, 20, 18, 16, 14, 12, 10, 8, 7, 6, 4, 3, 2, 1, 1, 0, 0, 0, 0, 0,
+    0, 1, 1, 2, 3, 5, 6, 7, 9, 11, 12, 14, 16, 19, 21, 23, 64, 35, 35, 74,
+    55, 55, 55, 55, 61, 35, 59, 9, 9, 32, 35, 69, 55, 55, 55, 55, 74, 35, 35, 64,
+    23, 21, 19, 16, 14, 12, 11, 9, 7, 6, 5, 3, 2, 1, 1, 0, 0, 0, 0, 0,
+    1, 1, 2, 2, 4, 5, 6, 8, 10, 11, 13, 15, 17, 19, 21, 23, 28, 35, 39, 50,
+    55, 55, 55, 55, 80, 35, 29, 3, 3, 29, 35, 80, 55, 55, 55, 55, 50, 39, 35, 28,
+    23, 21, 19, 17, 15, 13, 11, 10, 8, 6, 5, 4, 2, 2, 1, 1, 0, 0, 0, 0,
+    0, 1, 1, 2, 3, 4, 6, 7, 8, 10, 12, 14, 15, 17, 20, 22, 23, 38, 35, 73,
+    53, 55, 55, 55, 53, 78, 35, 58, 0, 0, 58, 35, 78, 53, 55, 55, 55, 53, 73, 35,
+    38, 23, 22, 20, 17, 15, 14, 12, 10, 8, 7, 6, 4, 3, 2, 1, 1, 0, 0, 0,
+    0, 0, 0, 1, 1, 2, 3, 5, 6, 7, 9, 10, 12, 14, 16, 18, 20, 22, 82, 34,
+    35, 80, 55, 55, 55, 55, 51, 66, 35, 79, 79, 35, 66, 51, 55, 55, 55, 55, 80, 35,
+    34, 82, 22, 20, 18, 16, 14, 12, 10, 9, 7, 6, 5, 3, 2, 1, 1, 0, 0, 0,
+    0, 0, 1, 1, 1, 2, 4, 5, 6, 7, 9, 11, 12, 14, 16, 19, 21, 23, 79, 35,
+    35, 69, 55, 55, 55, 55, 48, 39, 35, 24, 24, 35, 39, 48, 55, 55, 55, 55, 69, 35,
+    35, 79, 23, 21, 19, 16, 14, 12, 11, 9, 7, 6, 5, 4, 2, 1, 1, 1, 0, 0,
+    0, 0, 0, 1, 1, 2, 2, 4, 5, 7, 8, 10, 11, 13, 15, 17, 19, 21, 23, 27,
+    35, 35, 70, 55, 55, 55, 55, 46, 35, 34, 17, 17, 34, 35, 46, 55, 55, 55, 55, 70,
+    35, 35, 27, 23, 21, 19, 17, 15, 13, 11, 10, 8, 7, 5, 4, 2, 2, 1, 1, 0,
+    0, 0, 0, 0, 0, 1, 1, 2, 3, 4, 6, 7, 8, 10, 12, 13, 15, 17, 19, 21,
+    23, 29, 35, 68, 50, 55, 55, 55, 55, 69, 35, 59, 11, 11, 59, 35, 69, 55, 55, 55,
+    55, 50, 68, 35, 29, 23, 21, 19, 17, 15, 13, 12, 10, 8, 7, 6, 4, 3, 2, 1,
+    1, 0, 0, 0, 0, 0, 1, 1, 1, 2, 3, 5, 6, 7, 8, 10, 12, 14, 16, 18,
+    20, 22, 23, 38, 35, 40, 52, 55, 55, 55, 55, 77, 35, 31, 7, 7, 31, 35, 77, 55,
+    55, 55, 55, 52, 40, 35, 38, 23, 22, 20, 18, 16, 14, 12, 10, 8, 7, 6, 5, 3,
+    2, 1, 1, 1, 0, 0, 0, 0, 0, 1, 1, 2, 2, 4, 5, 6, 7, 9, 11, 12,
+    14, 16, 18, 20, 22, 24, 33, 35, 78, 53, 55, 55, 55, 54, 67, 35, 81, 5, 5, 81,
+    35, 67, 54, 55, 55, 55, 53, 78, 35, 33, 24, 22, 20, 18, 16, 14, 12, 11, 9, 7,
+    6, 5, 4, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 4, 5, 6,
+    8, 9, 11, 13, 15, 16, 19, 21, 23, 37, 34, 35, 42, 54, 55, 55, 55, 53, 78, 35,
+    65, 3, 3, 65, 35, 78, 53, 55, 55, 55, 54, 42, 35, 34, 37, 23, 21, 19, 16, 15,
+    13, 11, 9, 8, 6, 5, 4, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 2,
+    3, 4, 5, 7, 8, 10, 11, 13, 15, 17, 19, 21, 23, 64, 35, 35, 76, 55, 55, 55,
+    55, 56, 73, 35, 72, 2, 2, 72, 35, 78, 56, 55, 55, 55, 55, 76, 35, 35, 64, 23,
+    21, 19, 17, 15, 13, 11, 10, 8, 7, 5, 4, 3, 2, 1, 1, 0, 0, 0, 0, 0,
+    1, 1, 1, 2, 3, 5, 6, 7, 8, 10, 12, 13, 15, 17, 19, 21, 23, 36, 35, 35,
+    61, 55, 55, 55, 55, 51, 40, 35, 58, 1, 1, 58, 35, 73, 52, 55, 55, 55, 55, 61,
+    35, 35, 36, 23, 21, 19, 17, 15, 13, 12, 10, 8, 7, 6, 5, 3, 2, 1, 1, 1,
+    0, 0, 0, 0, 0, 1, 1, 1, 2, 4, 5, 6, 7, 8, 10, 12, 14, 15, 17, 19,
+    21, 23, 72, 35, 35, 62, 55, 55, 55, 55, 50, 66, 35, 27, 1, 1, 27, 35, 40, 51,
+    55, 55, 55, 55, 62, 35, 35, 72, 23, 21, 19, 17, 15, 14, 12, 10, 8, 7, 6, 5,
+    4, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 4, 5, 6, 7, 9,
+    10, 12, 14, 16, 18, 20, 22, 23, 29, 35, 39, 70, 55, 55, 55, 55, 50, 66, 35, 27,
+    0, 0, 27, 35, 66, 57, 55, 55, 55, 55, 70, 39, 35, 29, 23, 22, 20, 18, 16, 14,
+    12, 10, 9, 7, 6, 5, 4, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 2,
+    2, 4, 5, 6, 7, 9, 11, 12, 14, 16, 18, 20, 22, 23, 30, 35, 39, 63, 55, 55,
+    55, 55, 49, 68, 35, 27, 1, 1, 27, 35, 66, 50, 55, 55, 55, 55, 48, 39, 35, 30,
+    23, 22, 20, 18, 16, 14, 12, 11, 9, 7, 6, 5, 4, 2, 2, 1, 1, 0, 0, 0,
+    0, 0, 0, 1, 1, 2, 3, 4, 5, 7, 8, 9, 11, 12, 14, 16, 18, 20, 22, 23,
+    31, 35, 68, 49, 55, 55, 55, 55, 49, 68, 35, 72, 2, 2, 58, 35, 68, 49, 55, 55,
+    55, 55, 49, 68, 35, 31, 24, 22, 20, 18, 16, 14, 12, 11, 9, 8, 7, 5, 4, 3,
+    2, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 2, 3, 4, 5, 7, 8, 10, 11, 13,
+    14, 16, 18, 20, 22, 24, 38, 35, 66, 50, 55, 55, 55, 55, 49, 66, 35, 28, 3, 3,
+    28, 35, 66, 49, 55, 55, 55, 55, 49, 66, 35, 38, 24, 22, 20, 18, 16, 15, 13, 11,
+    10, 8, 7, 5, 4, 3, 2, 1, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 2, 3,
+    5, 6, 7, 8, 10, 11, 13, 15, 16, 18, 20, 22, 24, 32, 35, 66, 50, 55, 55, 55,
+    55, 50, 66, 35, 65, 4, 4, 65, 35, 66, 50, 55, 55, 55, 55, 50, 66, 35, 32, 24,
+    22, 20, 18, 16, 15, 13, 11, 10, 8, 7, 6, 5, 3, 2, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 2, 3, 5, 6, 7, 8, 10, 11, 13, 15, 17, 19, 20, 22,
+    24, 59, 35, 66, 50, 55, 55, 55, 55, 57, 40, 35, 29, 5, 5, 29, 35, 40, 57, 55,
+    55, 55, 55, 50, 66, 35, 59, 24, 22, 20, 19, 17, 15, 13, 11, 10, 8, 7, 6, 5,
+    3, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 4, 5, 6, 7, 8,
+    10, 11, 13, 15, 17, 19, 21, 22, 24, 59, 35, 66, 49, 55, 55, 55, 55, 51, 73, 35,
+    81, 8, 8, 81, 35, 73, 51, 55, 55, 55, 55, 49, 66, 35, 59, 24, 22, 21, 19, 17,
+    15, 13, 12, 10, 8, 7, 6, 5, 4, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0, 1,
+    1, 2, 2, 4, 5, 6, 7, 8, 10, 12, 13, 15, 17, 19, 21, 22, 24, 59, 35, 66,
+    49, 55, 55, 55, 55, 56, 78, 35, 31, 13, 13, 31, 35, 78, 56, 55, 55, 55, 55, 49,
+    66, 35, 59, 24, 22, 21, 19, 17, 15, 13, 12, 10, 8, 7, 6, 5, 4, 2, 2, 1,
+    1, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 4, 5, 6, 7, 8, 10, 12, 13, 15,
+    17, 19, 21, 22, 24, 32, 35, 68, 63, 55, 55, 55, 55, 53, 67, 35, 33, 20, 20, 33,
+    35, 67, 53, 55, 55, 55, 55, 63, 68, 35, 32, 24, 22, 21, 19, 17, 15, 13, 12, 10,
+    8, 7, 6, 5, 4, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 4,
+    5, 6, 7, 8, 10, 12, 13, 15, 17, 19, 21, 22, 24, 38, 35, 39, 70, 55, 55, 55,
+    55, 54, 77, 35, 34, 71, 71, 34, 35, 77, 54, 55, 55, 55, 55, 70, 39, 35, 38, 24,
+    22, 21, 19, 17, 15, 13, 12, 10, 8, 7, 6, 5, 4, 2, 2, 1, 1, 0, 0, 0,
+    0, 0, 1, 1, 1, 2, 2, 4, 5, 6, 7, 8, 10, 12, 13, 15, 17, 19, 20, 22,
+    24, 31, 35, 39, 62, 55, 55, 55, 55, 55, 44, 35, 35, 64, 0, 0, 64, 35, 35, 44,
+    55, 55, 55, 55, 55, 62, 39, 35, 31, 24, 22, 20, 19, 17, 15, 13, 12, 10, 8, 7,
+    6, 5, 4, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 2, 3, 4, 5,
+    6, 7, 8, 10, 12, 13, 15, 17, 19, 20, 22, 23, 30, 35, 35, 45, 55, 55, 55, 55,
+    55, 46, 39, 35, 58, 3, 2, 58, 35, 39, 46, 55, 55, 55, 55, 55, 75, 35, 35, 30,
+    24, 22, 20, 19, 17, 15, 13, 12, 10, 8, 7, 6, 5, 4, 3, 2, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 1, 1, 1, 2, 3, 4, 5, 6, 7, 8, 10, 12, 13, 15, 17,
+    18, 20, 22, 23, 29, 35, 35, 76, 54, 55, 55, 55, 55, 48, 66, 35, 81, 10, 9, 29,
+    35, 66, 48, 55, 55, 55, 55, 55, 44, 35, 35, 29, 23, 22, 20, 18, 17, 15, 13, 12,
+    10, 8, 7, 6, 5, 4, 3, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    2, 3, 4, 5, 6, 7, 8, 10, 12, 13, 15, 16, 18, 20, 22, 23, 72, 35, 35, 67,
+    53, 55, 55, 55, 55, 51, 78, 35, 59, 21, 18, 32, 35, 78, 51, 55, 55, 55, 55, 54,
+    77, 35, 35, 72, 23, 22, 20, 18, 16, 15, 13, 12, 10, 8, 7, 6, 5, 4, 3, 2,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 3, 4, 5, 6, 7, 8, 10,
+    12, 13, 15, 16, 18, 20, 22, 23, 36, 35, 35, 78, 52, 55, 55, 55, 55, 53, 80, 35,
+    35, 79, 0, 0, 25, 34, 35, 80, 53, 55, 55, 55, 55, 56, 60, 35, 35, 36, 23, 22,
+    20, 18, 16, 15, 13, 12, 10, 8, 7, 6, 5, 4, 3, 2, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 2, 3, 4, 5, 6, 7, 8, 10, 11, 13, 15, 16, 18, 20,
+    21, 23, 64, 34, 35, 40, 50, 55, 55, 55, 55, 55, 61, 35, 35, 72, 5, 5, 72, 35,
+    35, 61, 55, 55, 55, 55, 55, 50, 83, 35, 34, 64, 23, 21, 20, 18, 16, 15, 13, 11,
+    10, 8, 7, 6, 5, 4, 3, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    2, 3, 4, 5, 6, 7, 8, 10, 11, 13, 14, 16, 18, 19, 21, 23, 37, 33, 35, 68,
+    47, 55, 55, 55, 55, 55, 48, 66, 35, 31, 15, 15, 30, 35, 66, 48, 55, 55, 55, 55,
+    55, 47, 68, 35, 33, 37, 23, 21, 19, 18, 16, 14, 13, 11, 10, 8, 7, 6, 5, 4,
+    3, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 4, 5, 6, 7,
+    8, 10, 11, 12, 14, 16, 17, 19, 21, 23, 82, 38, 35, 35, 44, 54, 55, 55, 55, 55,
+    52, 41, 35, 34, 37, 0, 0, 37, 34, 35, 41, 52, 55, 55, 55, 55, 54, 44, 35, 35,
+    38, 82, 23, 21, 19, 17, 16, 14, 12, 11, 10, 8, 7, 6, 5, 4, 2, 2, 1, 1,
+    1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 4, 5, 6, 7, 8, 10, 11, 12,
+    14, 15, 17, 19, 21, 22, 23, 29, 35, 35, 67, 56, 55, 55, 55, 55, 54, 69, 39, 35,
+    72, 7, 6, 72, 35, 39, 69, 54, 55, 55, 55, 55, 56, 67, 35, 35, 29, 24, 22, 21,
+    19, 17, 15, 14, 12, 11, 10, 8, 7, 6, 5, 4, 2, 2, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 2, 2, 4, 5, 6, 7, 8, 9, 11, 12, 14, 15, 17, 19,
+    20, 22, 23, 27, 35, 35, 83, 49, 55, 55, 55, 55, 55, 63, 83, 35, 32, 22, 22, 32,
+    35, 83, 63, 55, 55, 55, 55, 55, 49, 83, 35, 35, 27, 23, 22, 20, 19, 17, 15, 14,
+    12, 11, 9, 8, 7, 6, 5, 4, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 2, 2, 4, 5, 6, 7, 8, 9, 10, 12, 13, 15, 16, 18, 20, 21, 23, 79,
+    34, 35, 39, 46, 55, 55, 55, 55, 55, 53, 77, 35, 35, 36, 4, 4, 36, 35, 35, 77,
+    53, 55, 55, 55, 55, 55, 46, 39, 35, 34, 79, 23, 21, 20, 18, 16, 15, 13, 12, 10,
+    9, 8, 7, 6, 5, 4, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    2, 2, 3, 5, 5, 7, 7, 9, 10, 12, 13, 15, 16, 18, 19, 21, 23, 82, 38, 35,
+    35, 43, 53, 55, 55, 55, 55, 55, 74, 68, 35, 31, 20, 21, 31, 35, 68, 74, 55, 55,
+    55, 55, 55, 53, 43, 35, 35, 38, 82, 23, 21, 19, 18, 16, 15, 13, 12, 10, 9, 7,
+    7, 5, 5, 3, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2,
+    3, 4, 5, 6, 7, 8, 10, 11, 13, 14, 16, 17, 19, 21, 22, 23, 28, 35, 35, 73,
+    49, 55, 55, 55, 55, 55, 51, 60, 35, 35, 27, 6, 6, 27, 35, 35, 60, 51, 55, 55,
+    55, 55, 55, 49, 73, 35, 35, 28, 23, 22, 21, 19, 17, 16, 14, 13, 11, 10, 8, 7,
+    6, 5, 4, 3, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2,
+    3, 4, 5, 6, 7, 8, 10, 11, 12, 14, 15, 17, 19, 20, 22, 23, 64, 34, 35, 39,
+    61, 54, 55, 55, 55, 55, 55, 75, 68, 35, 32, 24, 24, 32, 35, 68, 75, 55, 55, 55,
+    55, 55, 54, 61, 39, 35, 34, 64, 23, 22, 20, 19, 17, 15, 14, 12, 11, 10, 8, 7,
+    6, 5, 4, 3, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 3,
+    4, 5, 6, 7, 8, 9, 11, 12, 13, 15, 16, 18, 20, 21, 23, 82, 31, 35, 35, 60,
+    51, 55, 55, 55, 55, 55, 52, 42, 35, 35, 28, 9, 9, 28, 35, 35, 42, 52, 55, 55,
+    55, 55, 55, 51, 60, 35, 35, 31, 82, 23, 21, 20, 18, 16, 15, 13, 12, 11, 9, 8,
+    7, 6, 5, 4, 3, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2,
+    4, 5, 6, 7, 8, 9, 10, 12, 13, 14, 16, 17, 19, 21, 22, 23, 58, 35, 35, 68,
+    62, 55, 55, 55, 55, 55, 55, 62, 40, 35, 33, 25, 1, 1, 25, 33, 35, 40, 62, 55,
+    55, 55, 55, 55, 55, 62, 68, 35, 35, 58, 23, 22, 21, 19, 17, 16, 14, 13, 12, 10,
+    9, 8, 7, 6, 5, 4, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    2, 2, 4, 5, 5, 6, 7, 8, 10, 11, 12, 14, 15, 17, 19, 20, 21, 23, 37, 59,
+    35, 35, 80, 56, 55, 55, 55, 55, 55, 53, 43, 35, 35, 30, 23, 23, 30, 35, 35, 43,
+    53, 55, 55, 55, 55, 55, 56, 80, 35, 35, 59, 37, 23, 21, 20, 19, 17, 15, 14, 12,
+    11, 10, 8, 7, 6, 5, 5, 4, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 2, 2, 3, 4, 5, 6, 7, 8, 10, 11, 12, 14, 15, 16, 18, 19, 21, 22,
+    23, 28, 35, 35, 66, 62, 55, 55, 55, 55, 55, 55, 63, 41, 35, 35, 65, 13, 13, 65,
+    35, 35, 41, 63, 55, 55, 55, 55, 55, 55, 62, 66, 35, 35, 28, 23, 22, 21, 19, 18,
+    16, 15, 14, 12, 11, 10, 8, 7, 6, 5, 4, 3, 2, 2, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 12, 13, 14, 16,
+    17, 19, 20, 22, 23, 25, 59, 35, 35, 42, 52, 55, 55, 55, 55, 55, 55, 46, 40, 35,
+    35, 26, 6, 6, 26, 35, 35, 40, 46, 55, 55, 55, 55, 55, 55, 52, 42, 35, 35, 59,
+    25, 23, 22, 20, 19, 17, 16, 14, 13, 12, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 4, 5, 6, 7, 7,
+    9, 10, 11, 12, 14, 15, 17, 18, 19, 21, 22, 23, 72, 35, 35, 68, 45, 54, 55, 55,
+    55, 55, 55, 53, 69, 39, 35, 59, 25, 4, 4, 25, 59, 35, 39, 69, 53, 55, 55, 55,
+    55, 55, 54, 45, 68, 35, 35, 72, 23, 23, 21, 19, 18, 17, 15, 14, 12, 11, 10, 9,
+    7, 7, 6, 5, 4, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    2, 2, 3, 4, 5, 6, 7, 8, 9, 11, 12, 13, 15, 16, 17, 19, 20, 22, 23, 71,
+    38, 35, 35, 78, 49, 55, 55, 55, 55, 55, 55, 51, 80, 35, 35, 32, 37, 2, 2, 37,
+    32, 35, 35, 80, 51, 55, 55, 55, 55, 55, 55, 49, 78, 35, 35, 38, 71, 23, 22, 20,
+    19, 17, 16, 15, 13, 12, 11, 9, 8, 7, 6, 5, 4, 3, 2, 2, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+    14, 15, 17, 18, 19, 21, 22, 23, 36, 34, 35, 35, 43, 52, 55, 55, 55, 55, 55, 55,
+    63, 67, 35, 35, 38, 71, 2, 2, 71, 38, 35, 35, 67, 63, 55, 55, 55, 55, 55, 55,
+    52, 43, 35, 35, 34, 36, 23, 22, 21, 19, 18, 17, 15, 14, 12, 11, 10, 9, 8, 7,
+    6, 5, 4, 3, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2,
+    2, 4, 5, 6, 6, 7, 8, 10, 11, 12, 13, 15, 16, 17, 19, 20, 21, 23, 82, 81,
+    35, 35, 68, 45, 54, 55, 55, 55, 55, 55, 55, 48, 60, 35, 35, 31, 71, 1, 1, 71,
+    31, 35, 35, 60, 48, 55, 55, 55, 55, 55, 55, 54, 45, 68, 35, 35, 81, 82, 23, 21,
+    20, 19, 17, 16, 15, 13, 12, 11, 10, 8, 7, 6, 6, 5, 4, 2, 2, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 3, 4, 5, 6, 7, 8, 9,
+    10, 11, 12, 14, 15, 17, 18, 19, 21, 22, 23, 79, 59, 35, 35, 73, 62, 55, 55, 55,
+    55, 55, 55, 55, 48, 41, 35, 35, 38, 25, 5, 5, 25, 38, 35, 35, 41, 48, 55, 55,
+    55, 55, 55, 55, 55, 47, 73, 35, 35, 59, 79, 23, 22, 21, 19, 18, 17, 15, 14, 12,
+    11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 2, 3, 4, 5, 6, 7, 7, 8, 10, 11, 12, 13, 15, 16, 17,
+    18, 20, 21, 22, 23, 27, 34, 35, 35, 41, 63, 55, 55, 55, 55, 55, 55, 55, 70, 41,
+    35, 35, 33, 64, 9, 9, 64, 33, 35, 35, 41, 70, 55, 55, 55, 55, 55, 55, 55, 63,
+    41, 35, 35, 34, 27, 23, 23, 21, 20, 19, 17, 16, 15, 13, 12, 11, 10, 8, 7, 7,
+    6, 5, 4, 3, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2,
+    2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 14, 15, 16, 17, 19, 20, 21, 23, 24,
+    28, 35, 35, 35, 42, 50, 55, 55, 55, 55, 55, 55, 55, 63, 42, 35, 35, 35, 58, 15,
+    15, 27, 35, 35, 35, 42, 63, 55, 55, 55, 55, 55, 55, 55, 50, 42, 35, 35, 35, 28,
+    24, 23, 21, 20, 19, 17, 16, 15, 14, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2,
+    2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 3, 4, 5,
+    6, 7, 7, 8, 10, 11, 12, 13, 14, 15, 17, 18, 19, 21, 22, 23, 82, 81, 35, 35,
+    35, 77, 57, 55, 55, 55, 55, 55, 55, 55, 57, 76, 39, 35, 35, 65, 82, 3, 3, 82,
+    65, 35, 35, 39, 76, 57, 55, 55, 55, 55, 55, 55, 55, 57, 77, 35, 35, 35, 81, 82,
+    23, 22, 21, 19, 18, 17, 15, 14, 13, 12, 11, 10, 8, 7, 7, 6, 5, 4, 3, 2,
+    2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 3, 4, 5,
+    6, 7, 8, 9, 10, 11, 12, 13, 15, 16, 17, 18, 19, 21, 22, 23, 37, 30, 35, 35,
+    35, 77, 57, 55, 55, 55, 55, 55, 55, 55, 56, 69, 66, 35, 35, 59, 26, 14, 14, 26,
+    59, 35, 35, 66, 69, 56, 55, 55, 55, 55, 55, 55, 55, 57, 77, 35, 35, 35, 30, 37,
+    23, 22, 21, 20, 18, 17, 16, 15, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2,
+    2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 3, 4, 5,
+    6, 6, 7, 8, 9, 10, 11, 12, 14, 15, 16, 17, 19, 20, 21, 22, 23, 25, 31, 35,
+    35, 35, 80, 49, 55, 55, 55, 55, 55, 55, 55, 54, 62, 60, 35, 35, 35, 29, 82, 4,
+    4, 82, 29, 35, 35, 35, 60, 62, 54, 55, 55, 55, 55, 55, 55, 55, 49, 80, 35, 35,
+    35, 31, 25, 23, 22, 21, 20, 19, 17, 16, 15, 14, 12, 11, 10, 9, 8, 7, 6, 6,
+    5, 4, 3, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2,
+    2, 3, 4, 5, 6, 7, 7, 8, 10, 11, 12, 13, 14, 15, 16, 17, 19, 20, 21, 22,
+    23, 25, 31, 35, 35, 35, 67, 48, 55, 55, 55, 55, 55, 55, 55, 55, 57, 44, 66, 35,
+    35, 33, 27, 23, 2, 2, 23, 27, 33, 35, 35, 66, 44, 57, 55, 55, 55, 55, 55, 55,
+    55, 55, 48, 67, 35, 35, 35, 31, 25, 23, 22, 21, 20, 19, 17, 16, 15, 14, 13, 12,
+    11, 10, 8, 7, 7, 6, 5, 4, 3, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 2, 3, 4, 5, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 18, 19, 20, 21, 22, 23, 37, 30, 35, 35, 35, 78, 46, 54, 55, 55, 55, 55,
+    55, 55, 55, 54, 47, 67, 35, 35, 35, 33, 27, 22, 1, 1, 22, 27, 33, 35, 35, 35,
+    67, 47, 54, 55, 55, 55, 55, 55, 55, 55, 54, 46, 41, 35, 35, 35, 30, 37, 23, 22,
+    21, 20, 19, 18, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 5, 4, 3, 2,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 3, 4, 5,
+    6, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 18, 19, 20, 21, 22, 23, 82, 65,
+    34, 35, 35, 40, 69, 52, 55, 55, 55, 55, 55, 55, 55, 55, 52, 45, 41, 35, 35, 35,
+    59, 36, 21, 2, 2, 21, 36, 59, 35, 35, 35, 41, 45, 52, 55, 55, 55, 55, 55, 55,
+    55, 55, 52, 69, 40, 35, 35, 34, 65, 82, 23, 22, 21, 20, 19, 18, 16, 15, 14, 13,
+    12, 11, 10, 9, 8, 7, 6, 6, 5, 4, 3, 2, 2, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 3, 4, 5, 6, 7, 7, 8, 9, 10, 11,
+    12, 13, 14, 15, 17, 18, 19, 20, 21, 22, 23, 24, 72, 33, 35, 35, 39, 80, 48, 55,
+    55, 55, 55, 55, 55, 55, 55, 55, 57, 61, 41, 35, 35, 35, 34, 72, 71, 9, 9, 71,
+    72, 34, 35, 35, 35, 78, 61, 57, 55, 55, 55, 55, 55, 55, 55, 55, 55, 48, 80, 39,
+    35, 35, 33, 72, 24, 23, 22, 21, 20, 19, 18, 17, 15, 14, 13, 12, 11, 10, 9, 8,
+    7, 7, 6, 5, 4, 3, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 2, 2, 3, 4, 5, 5, 6, 7, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 19, 20, 21, 22, 23, 23, 36, 32, 35, 35, 35, 73, 45, 52, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 51, 45, 60, 39, 35, 35, 35, 30, 26, 21, 4, 4, 21, 26, 30,
+    35, 35, 35, 39, 60, 45, 51, 55, 55, 55, 55, 55, 55, 55, 55, 55, 52, 45, 73, 35,
+    35, 35, 32, 36, 23, 23, 22, 21, 20, 19, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8,
+    7, 7, 6, 5, 5, 4, 3, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 2, 2, 3, 4, 5, 5, 6, 7, 7, 8, 10, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 21, 21, 22, 23, 37, 81, 35, 35, 35, 39, 42, 62, 54, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 56, 74, 77, 66, 35, 35, 35, 35, 29, 64, 22, 6, 6, 22,
+    64, 29, 35, 35, 35, 35, 66, 77, 74, 56, 55, 55, 55, 55, 55, 55, 55, 55, 55, 54,
+    62, 42, 39, 35, 35, 35, 81, 37, 23, 22, 21, 21, 19, 18, 17, 16, 15, 14, 13, 12,
+    11, 10, 10, 8, 7, 7, 6, 5, 5, 4, 3, 2, 2, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 3, 4, 5, 5, 6, 7, 8, 8, 10, 10,
+    11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 27, 32, 35, 35, 35, 68,
+    77, 70, 54, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 49, 61, 67, 39, 35, 35, 35,
+    35, 30, 36, 71, 15, 3, 3, 15, 71, 36, 30, 35, 35, 35, 35, 39, 67, 61, 49, 55,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 54, 70, 77, 68, 35, 35, 35, 32, 27, 24, 23,
+    22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 10, 8, 8, 7, 6, 5, 5,
+    4, 3, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    2, 2, 3, 4, 5, 5, 6, 7, 8, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+    19, 20, 21, 22, 23, 23, 71, 65, 33, 35, 35, 35, 68, 77, 70, 54, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 54, 63, 61, 67, 68, 35, 35, 35, 35, 35, 81, 36, 37, 21,
+    9, 0, 0, 9, 21, 37, 36, 81, 35, 35, 35, 35, 35, 68, 67, 61, 63, 54, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 55, 54, 70, 77, 68, 35, 35, 35, 33, 65, 71, 23, 23,
+    22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 8, 7, 6, 5, 5,
+    4, 3, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    2, 2, 3, 4, 5, 6, 6, 7, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 16, 17,
+    18, 19, 20, 21, 22, 23, 23, 25, 29, 33, 35, 35, 35, 68, 43, 47, 53, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 50, 46, 76, 41, 68, 35, 35, 35, 35, 35, 33,
+    29, 27, 79, 82, 18, 10, 2, 2, 10, 18, 82, 79, 27, 29, 33, 35, 35, 35, 35, 35,
+    68, 41, 76, 46, 50, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 53, 47, 43,
+    68, 35, 35, 35, 33, 29, 25, 23, 23, 22, 21, 20, 19, 18, 17, 16, 16, 15, 14, 13,
+    12, 11, 10, 9, 8, 7, 7, 6, 6, 5, 4, 3, 2, 2, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 3, 4, 5, 5, 6, 7, 7, 8,
+    9, 10, 11, 12, 12, 13, 14, 15, 16, 17, 18, 19, 19, 20, 21, 22, 23, 23, 79, 29,
+    34, 35, 35, 35, 39, 67, 75, 57, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 51, 47, 69, 80, 73, 35, 35, 35, 35, 35, 35, 35, 35, 32, 29, 28, 27, 26,
+    79, 71, 24, 19, 14, 12, 8, 6, 4, 4, 0, 0, 4, 4, 6, 8, 12, 14, 19, 24,
+    71, 79, 26, 27, 28, 29, 32, 35, 35, 35, 35, 35, 35, 35, 35, 73, 80, 69, 47, 51,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 57, 75, 67, 39, 35, 35,
+    35, 34, 29, 79, 23, 23, 22, 21, 20, 19, 19, 18, 17, 16, 15, 14, 13, 12, 12, 11,
+    10, 9, 8, 7, 7, 6, 5, 5, 4, 3, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 3, 4, 5, 5, 6, 7, 7, 8, 9,
+    10, 11, 11, 12, 13, 14, 15, 16, 16, 17, 18, 19, 20, 21, 21, 22, 23, 23, 79, 29,
+    33, 35, 35, 35, 35, 40, 43, 62, 52, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 53, 50, 70, 75, 44, 80, 78, 68, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 68, 78, 80, 44, 75, 70, 50, 53, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 52, 62, 43, 40, 35, 35, 35, 35, 33,
+    29, 79, 23, 23, 22, 21, 21, 20, 19, 18, 17, 16, 16, 15, 14, 13, 12, 11, 11, 10,
+    9, 8, 7, 7, 6, 5, 5, 4, 3, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 3, 4, 5, 5, 6, 7, 7, 8, 9,
+    10, 10, 11, 12, 12, 13, 14, 15, 16, 17, 17, 18, 19, 20, 21, 21, 22, 23, 23, 71,
+    72, 38, 35, 35, 35, 35, 35, 73, 43, 46, 57, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 56, 50, 48, 74, 45, 69, 76, 77, 67, 41,
+    78, 73, 40, 66, 66, 39, 35, 35, 35, 35, 39, 66, 66, 40, 73, 78, 41, 42, 77, 44,
+    61, 75, 47, 48, 50, 56, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 57, 46, 43, 73, 35, 35, 35, 35, 35, 38, 72, 71, 23, 23, 22,
+    21, 21, 20, 19, 18, 17, 17, 16, 15, 14, 13, 12, 12, 11, 10, 10, 9, 8, 7, 7,
+    6, 5, 5, 4, 3, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 2, 2, 3, 4, 5, 5, 6, 6, 7, 8, 8, 9, 10, 11, 11,
+    12, 13, 14, 14, 15, 16, 17, 17, 18, 19, 20, 20, 21, 22, 22, 23, 23, 64, 65, 59,
+    35, 35, 35, 35, 35, 68, 67, 69, 70, 52, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 52, 70, 69, 67, 68, 35,
+    35, 35, 35, 35, 59, 65, 64, 23, 23, 22, 22, 21, 20, 20, 19, 18, 17, 17, 16, 15,
+    14, 14, 13, 12, 11, 11, 10, 9, 8, 8, 7, 6, 6, 5, 5, 4, 3, 2, 2, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 3,
+    4, 4, 5, 5, 6, 7, 7, 8, 9, 10, 10, 11, 12, 12, 13, 14, 15, 15, 16, 17,
+    17, 18, 19, 19, 20, 21, 21, 22, 23, 23, 24, 64, 65, 32, 35, 35, 35, 35, 35, 35,
+    66, 67, 44, 46, 49, 53, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 53, 49,
+    46, 44, 67, 66, 35, 35, 35, 35, 35, 35, 32, 65, 64, 24, 23, 23, 22, 21, 21, 20,
+    19, 19, 18, 17, 17, 16, 15, 15, 14, 13, 12, 12, 11, 10, 10, 9, 8, 7, 7, 6,
+    5, 5, 4, 4, 3, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 2, 2, 2, 3, 4, 5, 5, 6, 6, 7, 7, 8, 9, 10, 10, 11,
+    12, 12, 13, 14, 14, 15, 16, 16, 17, 18, 18, 19, 20, 20, 21, 21, 22, 22, 23, 23,
+    37, 58, 30, 59, 35, 35, 35, 35, 35, 35, 35, 40, 60, 43, 61, 62, 63, 52, 54, 55,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 54, 52, 63, 62, 61,
+    43, 60, 40, 35, 35, 35, 35, 35, 35, 35, 59, 30, 58, 37, 23, 23, 22, 22, 21, 21,
+    20, 20, 19, 18, 18, 17, 16, 16, 15, 14, 14, 13, 12, 12, 11, 10, 10, 9, 8, 7,
+    7, 6, 6, 5, 5, 4, 3, 2, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 2, 2, 3, 4, 4, 5, 5, 6, 7, 7, 8, 8, 9,
+    10, 10, 11, 12, 12, 13, 14, 14, 15, 16, 16, 17, 17, 18, 19, 19, 20, 20, 21, 21,
+    22, 22, 23, 23, 23, 25, 58, 29, 38, 34, 35, 35, 35, 35, 35, 35, 35, 35, 39, 40,
+    41, 42, 43, 69, 45, 46, 47, 48, 49, 50, 51, 56, 53, 53, 54, 55, 55, 55, 55, 54,
+    53, 53, 56, 51, 50, 49, 48, 47, 46, 45, 69, 43, 42, 41, 40, 39, 35, 35, 35, 35,
+    35, 35, 35, 35, 34, 38, 29, 58, 25, 23, 23, 23, 22, 22, 21, 21, 20, 20, 19, 19,
+    18, 17, 17, 16, 16, 15, 14, 14, 13, 12, 12, 11, 10, 10, 9, 8, 8, 7, 7, 6,
+    5, 5, 4, 4, 3, 2, 2, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 2, 2, 2, 3, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 10,
+    10, 11, 12, 12, 13, 13, 14, 15, 15, 16, 16, 17, 17, 18, 18, 19, 19, 20, 20, 21,
+    21, 21, 22, 22, 23, 23, 23, 25, 36, 28, 30, 32, 33, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 33, 32, 30, 28, 36, 25, 23,
+    23, 23, 22, 22, 21, 21, 21, 20, 20, 19, 19, 18, 18, 17, 17, 16, 16, 15, 15, 14,
+    13, 13, 12, 12, 11, 10, 10, 9, 8, 8, 7, 7, 6, 6, 5, 5, 4, 3, 2, 2,
+    2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+    2, 2, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 10, 10, 11, 11, 12, 12,
+    13, 14, 14, 15, 15, 16, 16, 17, 17, 17, 18, 18, 19, 19, 20, 20, 21, 21, 21, 21,
+    22, 22, 22, 23, 23, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 34, 34, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 34, 34, 34, 33, 32, 31, 30, 29, 28,
+    27, 26, 25, 24, 23, 23, 23, 23, 22, 22, 21, 21, 21, 21, 20, 20, 19, 19, 18, 18,
+    17, 17, 17, 16, 16, 15, 15, 14, 14, 13, 12, 12, 11, 11, 10, 10, 9, 8, 8, 7,
+    7, 6, 6, 5, 5, 4, 4, 3, 2, 2, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 3, 4, 4, 5, 5, 6, 6, 7,
+    7, 8, 8, 9, 9, 10, 11, 11, 12, 12, 12, 13, 14, 14, 14, 15, 15, 16, 16, 17,
+    17, 17, 18, 18, 19, 19, 19, 19, 20, 20, 20, 21, 21, 21, 21, 22, 22, 22, 22, 22,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 22, 22, 22, 22, 22, 21, 21, 21, 21, 20, 20, 20, 19, 19, 19, 19,
+    18, 18, 17, 17, 17, 16, 16, 15, 15, 14, 14, 14, 13, 12, 12, 12, 11, 11, 10, 9,
+    9, 8, 8, 7, 7, 6, 6, 5, 5, 4, 4, 3, 2, 2, 2, 1, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 2, 2, 3, 4, 4,
+    5, 5, 6, 6, 7, 7, 7, 8, 8, 9, 10, 10, 11, 11, 12, 12, 12, 13, 13, 14,
+    14, 15, 15, 15, 16, 16, 16, 17, 17, 17, 17, 18, 18, 18, 19, 19, 19, 19, 19, 20,
+    20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 20, 20, 20, 20, 20, 19, 19, 19, 19, 19, 18, 18, 18, 17, 17, 17,
+    17, 16, 16, 16, 15, 15, 15, 14, 14, 13, 13, 12, 12, 12, 11, 11, 10, 10, 9, 8,
+    8, 7, 7, 7, 6, 6, 5, 5, 4, 4, 3, 2, 2, 2, 1, 1, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 2, 2, 3, 4, 4,
+    5, 5, 5, 6, 6, 7, 7, 7, 8, 8, 9, 10, 10, 10, 11, 11, 12, 12, 12, 13,
+    13, 14, 14, 14, 15, 15, 15, 15, 16, 16, 16, 16, 17, 17, 17, 17, 17, 18, 18, 18,
+    18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 18,
+    18, 18, 18, 18, 18, 17, 17, 17, 17, 17, 16, 16, 16, 16, 15, 15, 15, 15, 14, 14,
+    14, 13, 13, 12, 12, 12, 11, 11, 10, 10, 10, 9, 8, 8, 7, 7, 7, 6, 6, 5,
+    5, 5, 4, 4, 3, 2, 2, 2, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 1, 1, 2, 2, 2, 2, 3, 4, 4, 5, 5, 6, 6, 6,
+    7, 7, 7, 8, 8, 9, 9, 10, 10, 10, 11, 11, 12, 12, 12, 12, 13, 13, 13, 14,
+    14, 14, 14, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17,
+    17, 17, 17, 17, 17, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 15, 15, 15, 15,
+    15, 14, 14, 14, 14, 13, 13, 13, 12, 12, 12, 12, 11, 11, 10, 10, 10, 9, 9, 8,
+    8, 7, 7, 7, 6, 6, 6, 5, 5, 4, 4, 3, 2, 2, 2, 2, 1, 1, 1, 1,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 2, 2, 2,
+    3, 3, 4, 4, 5, 5, 6, 6, 6, 7, 7, 7, 8, 8, 8, 9, 9, 10, 10, 10,
+    11, 11, 11, 11, 12, 12, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 13, 13, 13, 13, 12, 12, 12, 12, 12, 11, 11, 11, 11, 10, 10, 10, 9, 9, 8,
+    8, 8, 7, 7, 7, 6, 6, 6, 5, 5, 4, 4, 3, 3, 2, 2, 2, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 2,
+    2, 2, 2, 3, 3, 4, 4, 5, 5, 5, 6, 6, 6, 7, 7, 7, 7, 8, 8, 8,
+    9, 9, 9, 10, 10, 10, 10, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    11, 11, 11, 11, 11, 10, 10, 10, 10, 9, 9, 9, 8, 8, 8, 7, 7, 7, 7, 6,
+    6, 6, 5, 5, 5, 4, 4, 3, 3, 2, 2, 2, 2, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 4, 4, 4, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7, 7, 8, 8, 8,
+    8, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11,
+    11, 11, 11, 10, 10, 10, 10, 10, 10, 10, 10, 9, 10, 9, 9, 9, 9, 8, 8, 8,
+    8, 7, 7, 7, 7, 7, 6, 6, 6, 6, 5, 5, 5, 4, 4, 4, 3, 3, 2, 2,
+    2, 2, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 4, 4, 4, 5, 5, 5, 5,
+    5, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 7, 7, 7,
+    7, 7, 7, 7, 7, 6, 6, 6, 6, 5, 5, 5, 5, 5, 4, 4, 4, 3, 3, 2,
+    2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 3, 3, 4, 4,
+    4, 4, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 5, 5,
+    5, 5, 5, 5, 4, 4, 4, 4, 3, 3, 3, 2, 2, 2, 2, 2, 1, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4,
+    4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0,
+};
+
+
+const struct EmbeddedMask EMBEDDED_MASKS[] =
+{
+    { "Mask@1.png", 171, 1, false, MASK_1_PALETTE, MASK_1_RUNS, 332, MASK_1_INDICES },
+    { "Mask@2.png", 344, 2, false, MASK_2_PALETTE, MASK_2_RUNS, 668, MASK_2_INDICES },
+    { "Mask@2+s.png", 374, 2, true, MASK_2_SHADOW_PALETTE, MASK_2_SHADOW_RUNS, 700, MASK_2_SHADOW_INDICES },
+};
+
+const int EMBEDDED_MASK_COUNT = sizeof(EMBEDDED_MASKS)/sizeof(EMBEDDED_MASKS[0]);
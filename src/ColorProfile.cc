@@ -0,0 +1,268 @@
+#include "ColorProfile.h"
+
+#include <cmath>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+#include "parameters.h"
+
+
+static uint32_t
+ReadU32(const uint8_t* const cursor)
+{
+    return (uint32_t(cursor[0]) << 24) | (uint32_t(cursor[1]) << 16) | \
+           (uint32_t(cursor[2]) << 8) | uint32_t(cursor[3]);
+}
+
+
+static uint16_t
+ReadU16(const uint8_t* const cursor)
+{
+    return uint16_t((cursor[0] << 8) | cursor[1]);
+}
+
+
+static float
+ReadS15Fixed16(const uint8_t* const cursor)
+{
+    return int32_t(ReadU32(cursor))/65536.0f;
+}
+
+
+static constexpr uint32_t
+Signature(const char (&name)[5])
+{
+    return (uint32_t(uint8_t(name[0])) << 24) | (uint32_t(uint8_t(name[1])) << 16) | \
+           (uint32_t(uint8_t(name[2])) << 8) | uint32_t(uint8_t(name[3]));
+}
+
+
+float
+ColorProfile::ToneCurve::Evaluate
+(
+    float x
+) const
+{
+    x = x < 0 ? 0 : x > 1 ? 1 : x;
+
+    if( function_type < 0 )
+    {
+        const float position = x*(samples.size() - 1);
+        const size_t idx = std::min(size_t(position), samples.size() - 2);
+        const float weight = position - idx;
+        return samples[idx]*(1 - weight) + samples[idx + 1]*weight;
+    }
+
+    const float g = parameters[0], a = parameters[1], b = parameters[2], \
+                c = parameters[3], d = parameters[4], e = parameters[5], \
+                f = parameters[6];
+
+    //! ICC.1:2010 table 65
+    switch(function_type)
+    {
+    case 0:
+        return std::pow(x, g);
+    case 1:
+        return x >= -b/a ? std::pow(a*x + b, g) : 0;
+    case 2:
+        return x >= -b/a ? std::pow(a*x + b, g) + c : c;
+    case 3:
+        return x >= d ? std::pow(a*x + b, g) : c*x;
+    default:
+        return x >= d ? std::pow(a*x + b, g) + e : c*x + f;
+    }
+}
+
+
+ColorProfile::ColorProfile
+(
+    const std::string& profile_path
+)
+{
+    fprintf(stderr, "%s\n", __PRETTY_FUNCTION__);
+
+    auto file = fopen(profile_path.c_str(), "rb");
+    if( file == nullptr )
+    {
+        fprintf(stderr, "ColorProfile Constructor Error 0 %s\n", \
+                                                        profile_path.c_str());
+        throw std::runtime_error("ColorProfile Constructor Error 0");
+    }
+
+    std::vector<uint8_t> content;
+    uint8_t chunk[4096];
+    size_t chunk_size = 0;
+    while( (chunk_size = fread(chunk, 1, sizeof(chunk), file)) > 0 )
+    {
+        content.insert(content.end(), chunk, chunk + chunk_size);
+    }
+    fclose(file);
+
+    parseProfile(content.data(), content.size());
+}
+
+
+ColorProfile::ColorProfile
+(
+    const uint8_t* const data, size_t size
+)
+{
+    fprintf(stderr, "%s\n", __PRETTY_FUNCTION__);
+    parseProfile(data, size);
+}
+
+
+ColorProfile::~ColorProfile()
+{
+    fprintf(stderr, "%s\n", __PRETTY_FUNCTION__);
+}
+
+
+void
+ColorProfile::parseProfile
+(
+    const uint8_t* const data, size_t size
+)
+{
+    //! 128 bytes header, then the tag count and 12 bytes per tag entry
+    if( size < 132 || ReadU32(data + 36) != Signature("acsp") || \
+        ReadU32(data) > size )
+    {
+        fprintf(stderr, "ColorProfile Constructor Error 1\n");
+        throw std::runtime_error("ColorProfile Constructor Error 1");
+    }
+    size = ReadU32(data);
+
+    if( ReadU32(data + 16) != Signature("RGB ") || \
+        ReadU32(data + 20) != Signature("XYZ ") )
+    {
+        fprintf(stderr, "ColorProfile Constructor Error 2\n");
+        throw std::runtime_error("ColorProfile Constructor Error 2");
+    }
+
+    //! the tag data as [begin, begin + length), nullptr when absent or
+    //! pointing outside of the profile
+    auto find_tag = [&](uint32_t signature, size_t* const length) \
+                                                    -> const uint8_t*
+    {
+        const uint32_t tag_count = ReadU32(data + 128);
+        for(uint32_t idx = 0; idx < tag_count; ++idx)
+        {
+            const size_t entry = 132 + size_t(idx)*12;
+            if( entry + 12 > size ) { break; }
+            if( ReadU32(data + entry) != signature ) { continue; }
+
+            const size_t offset = ReadU32(data + entry + 4);
+            *length = ReadU32(data + entry + 8);
+            if( offset + *length > size || *length < 8 ) { return nullptr; }
+            return data + offset;
+        }
+        return nullptr;
+    };
+
+    const uint32_t colorant_tags[3] = \
+                    { Signature("rXYZ"), Signature("gXYZ"), Signature("bXYZ") };
+    const uint32_t curve_tags[3] = \
+                    { Signature("rTRC"), Signature("gTRC"), Signature("bTRC") };
+
+    for(int channel = 0; channel < 3; ++channel)
+    {
+        size_t length = 0;
+        auto colorant = find_tag(colorant_tags[channel], &length);
+        if( colorant == nullptr || length < 20 || \
+            ReadU32(colorant) != Signature("XYZ ") )
+        {
+            fprintf(stderr, "ColorProfile Constructor Error 3\n");
+            throw std::runtime_error("ColorProfile Constructor Error 3");
+        }
+        for(int row = 0; row < 3; ++row)
+        {
+            to_xyz_[row*3 + channel] = ReadS15Fixed16(colorant + 8 + row*4);
+        }
+
+        auto curve = find_tag(curve_tags[channel], &length);
+        auto& tone_curve = tone_curve_[channel];
+        if( curve != nullptr && length >= 12 && \
+            ReadU32(curve) == Signature("curv") )
+        {
+            const uint32_t count = ReadU32(curve + 8);
+            if( length < 12 + size_t(count)*2 )
+            {
+                curve = nullptr;
+            }
+            else if( count == 0 )
+            {
+                tone_curve.parameters[0] = 1.0f;
+            }
+            else if( count == 1 )
+            {
+                tone_curve.parameters[0] = ReadU16(curve + 12)/256.0f;
+            }
+            else
+            {
+                tone_curve.function_type = -1;
+                for(uint32_t idx = 0; idx < count; ++idx)
+                {
+                    tone_curve.samples.push_back( \
+                                    ReadU16(curve + 12 + idx*2)/65535.0f);
+                }
+            }
+        }
+        else if( curve != nullptr && length >= 12 && \
+                 ReadU32(curve) == Signature("para") )
+        {
+            static const int PARAMETER_COUNT[5] = {1, 3, 4, 5, 7};
+            const int function_type = ReadU16(curve + 8);
+            if( function_type > 4 || \
+                length < 12 + size_t(PARAMETER_COUNT[function_type])*4 )
+            {
+                curve = nullptr;
+            }
+            else
+            {
+                tone_curve.function_type = function_type;
+                for(int idx = 0; idx < PARAMETER_COUNT[function_type]; ++idx)
+                {
+                    tone_curve.parameters[idx] = ReadS15Fixed16(curve + 12 + idx*4);
+                }
+            }
+        }
+        else
+        {
+            curve = nullptr;
+        }
+
+        if( curve == nullptr )
+        {
+            fprintf(stderr, "ColorProfile Constructor Error 4\n");
+            throw std::runtime_error("ColorProfile Constructor Error 4");
+        }
+    }
+
+    //! 'desc' (v2, ASCII) or 'mluc' (v4, UTF-16BE, first record), only
+    //! for the logs so anything unexpected just leaves it empty
+    size_t length = 0;
+    if( auto description = find_tag(Signature("desc"), &length) )
+    {
+        if( ReadU32(description) == Signature("desc") && length >= 12 )
+        {
+            const size_t count = std::min<size_t>(ReadU32(description + 8), \
+                                                                length - 12);
+            description_.assign((const char*)description + 12, \
+                                strnlen((const char*)description + 12, count));
+        }
+        else if( ReadU32(description) == Signature("mluc") && length >= 28 )
+        {
+            const size_t record_length = ReadU32(description + 20);
+            const size_t record_offset = ReadU32(description + 24);
+            for(size_t idx = 0; idx + 1 < record_length && \
+                            record_offset + idx + 1 < length; idx += 2)
+            {
+                const uint16_t code = ReadU16(description + record_offset + idx);
+                description_.push_back(code < 0x80 ? char(code) : '?');
+            }
+        }
+    }
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+
+//! The part of an ICC profile (v2 or v4) a matrix/TRC display profile is
+//! made of: the D50 adapted red, green and blue colorants and one tone
+//! curve per channel. Profiles describing the display through A2B LUTs
+//! only, or with a non RGB / non XYZ connection space, are refused.
+class ColorProfile
+{
+public:
+    //! one TRC tag, either 'curv' (gamma or sampled) or 'para'
+    struct ToneCurve
+    {
+        //! -1 for a sampled curve, else the ICC parametric function type
+        int function_type = 0;
+        float parameters[7] = {1, 1, 0, 0, 0, 0, 0}; // g a b c d e f
+        std::vector<float> samples;                  // [0, 1]
+
+        //! encoded [0, 1] -> linear
+        float Evaluate(float x) const;
+    };
+public:
+    ColorProfile(const std::string& profile_path);
+    ColorProfile(const uint8_t* const data, size_t size);
+    ~ColorProfile();
+private:
+    std::string description_;
+    //! linear rgb -> XYZ (D50), row major, the colorants are the columns
+    float to_xyz_[9] = {};
+    struct ToneCurve tone_curve_[3];
+private:
+    void parseProfile(const uint8_t* const data, size_t size);
+public:
+    const std::string& Description() const { return description_; }
+    const float* ToXYZ() const { return to_xyz_; }
+    const struct ToneCurve& Curve(int channel) const { return tone_curve_[channel]; }
+};
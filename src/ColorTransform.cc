@@ -0,0 +1,408 @@
+#include "ColorTransform.h"
+
+#include <cmath>
+#include <cstdio>
+#include <algorithm>
+
+#include "simd.h"
+#include "parameters.h"
+
+
+//! 3x3 row major helpers, in double since the tables are built only once
+static void
+Multiply3x3(const double* const a, const double* const b, double* const out)
+{
+    for(int row = 0; row < 3; ++row)
+    {
+        for(int column = 0; column < 3; ++column)
+        {
+            out[row*3 + column] = a[row*3 + 0]*b[0*3 + column] + \
+                                  a[row*3 + 1]*b[1*3 + column] + \
+                                  a[row*3 + 2]*b[2*3 + column];
+        }
+    }
+}
+
+
+static void
+Invert3x3(const double* const m, double* const out)
+{
+    const double c0 = m[4]*m[8] - m[5]*m[7];
+    const double c1 = m[5]*m[6] - m[3]*m[8];
+    const double c2 = m[3]*m[7] - m[4]*m[6];
+    const double determinant = m[0]*c0 + m[1]*c1 + m[2]*c2;
+
+    out[0] = c0/determinant;
+    out[1] = (m[2]*m[7] - m[1]*m[8])/determinant;
+    out[2] = (m[1]*m[5] - m[2]*m[4])/determinant;
+    out[3] = c1/determinant;
+    out[4] = (m[0]*m[8] - m[2]*m[6])/determinant;
+    out[5] = (m[2]*m[3] - m[0]*m[5])/determinant;
+    out[6] = c2/determinant;
+    out[7] = (m[1]*m[6] - m[0]*m[7])/determinant;
+    out[8] = (m[0]*m[4] - m[1]*m[3])/determinant;
+}
+
+
+//! linear rgb -> XYZ D50 of a D65 colour space given by the xy of its
+//! primaries, Bradford adapted the way ICC display profiles are
+static void
+PrimariesToXYZD50(const double (&xy)[3][2], double* const to_xyz)
+{
+    const double white_d65[3] = {0.3127/0.3290, 1.0, (1 - 0.3127 - 0.3290)/0.3290};
+    const double white_d50[3] = {0.9642, 1.0, 0.8249};
+
+    double primaries[9], inverse[9];
+    for(int channel = 0; channel < 3; ++channel)
+    {
+        const double x = xy[channel][0], y = xy[channel][1];
+        primaries[0*3 + channel] = x/y;
+        primaries[1*3 + channel] = 1.0;
+        primaries[2*3 + channel] = (1 - x - y)/y;
+    }
+    Invert3x3(primaries, inverse);
+
+    double to_xyz_d65[9];
+    for(int channel = 0; channel < 3; ++channel)
+    {
+        const double scale = inverse[channel*3 + 0]*white_d65[0] + \
+                             inverse[channel*3 + 1]*white_d65[1] + \
+                             inverse[channel*3 + 2]*white_d65[2];
+        for(int row = 0; row < 3; ++row)
+        {
+            to_xyz_d65[row*3 + channel] = primaries[row*3 + channel]*scale;
+        }
+    }
+
+    const double bradford[9] = { 0.8951,  0.2664, -0.1614,
+                                -0.7502,  1.7135,  0.0367,
+                                 0.0389, -0.0685,  1.0296};
+    double bradford_inverse[9];
+    Invert3x3(bradford, bradford_inverse);
+
+    double cone_scale[9] = {};
+    for(int row = 0; row < 3; ++row)
+    {
+        const double d65 = bradford[row*3 + 0]*white_d65[0] + \
+                           bradford[row*3 + 1]*white_d65[1] + \
+                           bradford[row*3 + 2]*white_d65[2];
+        const double d50 = bradford[row*3 + 0]*white_d50[0] + \
+                           bradford[row*3 + 1]*white_d50[1] + \
+                           bradford[row*3 + 2]*white_d50[2];
+        cone_scale[row*3 + row] = d50/d65;
+    }
+
+    double adaptation[9], temporary[9];
+    Multiply3x3(cone_scale, bradford, temporary);
+    Multiply3x3(bradford_inverse, temporary, adaptation);
+    Multiply3x3(adaptation, to_xyz_d65, to_xyz);
+}
+
+
+static double
+EncodeSRGB(double linear)
+{
+    return linear <= 0.0031308 ? linear*12.92 : \
+                                 1.055*std::pow(linear, 1/2.4) - 0.055;
+}
+
+
+ColorTransform::ColorTransform
+(
+    const class ColorProfile& display_profile,
+    TargetColorSpace target
+)
+:target_(target)
+{
+    fprintf(stderr, "%s\n", __PRETTY_FUNCTION__);
+
+    static const double SRGB_PRIMARIES[3][2] = \
+                            {{0.640, 0.330}, {0.300, 0.600}, {0.150, 0.060}};
+    static const double DISPLAY_P3_PRIMARIES[3][2] = \
+                            {{0.680, 0.320}, {0.265, 0.690}, {0.150, 0.060}};
+
+    double target_to_xyz[9], xyz_to_target[9], display_to_xyz[9], matrix[9];
+    PrimariesToXYZD50(target == TargetColorSpace::DISPLAY_P3 ? \
+                DISPLAY_P3_PRIMARIES : SRGB_PRIMARIES, target_to_xyz);
+    Invert3x3(target_to_xyz, xyz_to_target);
+    std::copy(display_profile.ToXYZ(), display_profile.ToXYZ() + 9, display_to_xyz);
+    Multiply3x3(xyz_to_target, display_to_xyz, matrix);
+    std::copy(matrix, matrix + 9, matrix_);
+
+    for(int channel = 0; channel < 3; ++channel)
+    {
+        const auto& curve = display_profile.Curve(channel);
+        for(int value = 0; value < 256; ++value)
+        {
+            to_linear_8_[channel][value] = curve.Evaluate(value/255.0f);
+        }
+        for(int idx = 0; idx <= ENCODING_TABLE_SIZE; ++idx)
+        {
+            to_linear_[channel][idx] = curve.Evaluate(float(idx)/ENCODING_TABLE_SIZE);
+        }
+    }
+
+    for(int idx = 0; idx <= ENCODING_TABLE_SIZE; ++idx)
+    {
+        const double encoded = EncodeSRGB(double(idx)/ENCODING_TABLE_SIZE);
+        from_linear_[idx] = float(encoded);
+        from_linear_8_[idx] = uint32_t(encoded*255 + 0.5);
+    }
+
+    //! ramps of every channel alone and of the greys, a display profile
+    //! matching the target gives them back untouched
+    is_identity_ = true;
+    for(int value = 0; value < 256 && is_identity_; ++value)
+    {
+        const uint8_t v = uint8_t(value);
+        PixelRGBA8 ramp[4] = {{v, 0, 0, 0xFF}, {0, v, 0, 0xFF}, \
+                              {0, 0, v, 0xFF}, {v, v, v, 0xFF}};
+        PixelRGBA8 expected[4];
+        std::copy(ramp, ramp + 4, expected);
+
+        transformRow_Scalar(ramp, 4);
+        for(int idx = 0; idx < 4; ++idx)
+        {
+            is_identity_ = is_identity_ && ramp[idx].r == expected[idx].r && \
+                                           ramp[idx].g == expected[idx].g && \
+                                           ramp[idx].b == expected[idx].b;
+        }
+    }
+
+    kernel_level_ = DetectConvertKernelLevel();
+
+    fprintf(stderr, "color transform \"%s\" -> %s%s, %s\n", \
+                display_profile.Description().c_str(), \
+                target == TargetColorSpace::DISPLAY_P3 ? "display-p3" : "srgb", \
+                is_identity_ ? " (identity)" : "", \
+                ConvertKernelLevelName(kernel_level_));
+}
+
+
+ColorTransform::~ColorTransform()
+{
+    fprintf(stderr, "%s\n", __PRETTY_FUNCTION__);
+}
+
+
+void
+ColorTransform::transformRow_Scalar
+(
+    PixelRGBA8* const row, int count
+) const
+{
+    for(int idx = 0; idx < count; ++idx)
+    {
+        auto& pixel = row[idx];
+        const float r = to_linear_8_[0][pixel.r];
+        const float g = to_linear_8_[1][pixel.g];
+        const float b = to_linear_8_[2][pixel.b];
+
+        auto encode = [this](float linear) -> uint8_t
+        {
+            linear = std::min(1.0f, std::max(0.0f, linear));
+            return uint8_t(from_linear_8_[int(linear*ENCODING_TABLE_SIZE + 0.5f)]);
+        };
+        pixel.r = encode(matrix_[0]*r + matrix_[1]*g + matrix_[2]*b);
+        pixel.g = encode(matrix_[3]*r + matrix_[4]*g + matrix_[5]*b);
+        pixel.b = encode(matrix_[6]*r + matrix_[7]*g + matrix_[8]*b);
+    }
+}
+
+
+#ifdef SIMD_X86
+
+//! the lookups stay scalar without a gather instruction, the matrix and
+//! the clipping run on four pixels at once
+KERNEL_TARGET("sse2") void
+ColorTransform::transformRow_SSE2
+(
+    PixelRGBA8* const row, int count
+) const
+{
+    const __m128 zero  = _mm_setzero_ps();
+    const __m128 one   = _mm_set1_ps(1.0f);
+    const __m128 steps = _mm_set1_ps(float(ENCODING_TABLE_SIZE));
+
+    int idx = 0;
+    for(; idx + 4 <= count; idx += 4)
+    {
+        auto pixel = row + idx;
+        const __m128 r = _mm_setr_ps(to_linear_8_[0][pixel[0].r], to_linear_8_[0][pixel[1].r], \
+                                     to_linear_8_[0][pixel[2].r], to_linear_8_[0][pixel[3].r]);
+        const __m128 g = _mm_setr_ps(to_linear_8_[1][pixel[0].g], to_linear_8_[1][pixel[1].g], \
+                                     to_linear_8_[1][pixel[2].g], to_linear_8_[1][pixel[3].g]);
+        const __m128 b = _mm_setr_ps(to_linear_8_[2][pixel[0].b], to_linear_8_[2][pixel[1].b], \
+                                     to_linear_8_[2][pixel[2].b], to_linear_8_[2][pixel[3].b]);
+
+        alignas(16) int32_t encoded[3][4];
+        for(int channel = 0; channel < 3; ++channel)
+        {
+            const float* const m = matrix_ + channel*3;
+            __m128 linear = _mm_add_ps(_mm_add_ps( \
+                                _mm_mul_ps(_mm_set1_ps(m[0]), r), \
+                                _mm_mul_ps(_mm_set1_ps(m[1]), g)), \
+                                _mm_mul_ps(_mm_set1_ps(m[2]), b));
+            linear = _mm_min_ps(one, _mm_max_ps(zero, linear));
+            _mm_store_si128((__m128i*)encoded[channel], \
+                            _mm_cvtps_epi32(_mm_mul_ps(linear, steps)));
+        }
+
+        for(int lane = 0; lane < 4; ++lane)
+        {
+            pixel[lane].r = uint8_t(from_linear_8_[encoded[0][lane]]);
+            pixel[lane].g = uint8_t(from_linear_8_[encoded[1][lane]]);
+            pixel[lane].b = uint8_t(from_linear_8_[encoded[2][lane]]);
+        }
+    }
+
+    transformRow_Scalar(row + idx, count - idx);
+}
+
+
+//! eight pixels per iteration, both lookups are gathers
+KERNEL_TARGET("avx2") void
+ColorTransform::transformRow_AVX2
+(
+    PixelRGBA8* const row, int count
+) const
+{
+    const __m256  zero  = _mm256_setzero_ps();
+    const __m256  one   = _mm256_set1_ps(1.0f);
+    const __m256  steps = _mm256_set1_ps(float(ENCODING_TABLE_SIZE));
+    const __m256i low_mask   = _mm256_set1_epi32(0xFF);
+    const __m256i alpha_mask = _mm256_set1_epi32(int(0xFF000000));
+    const int* const from_linear = (const int*)from_linear_8_;
+
+    __m256 m[9];
+    for(int idx = 0; idx < 9; ++idx)
+    {
+        m[idx] = _mm256_set1_ps(matrix_[idx]);
+    }
+
+    int idx = 0;
+    for(; idx + 8 <= count; idx += 8)
+    {
+        const __m256i pixels = _mm256_loadu_si256((const __m256i*)(row + idx));
+
+        const __m256 r = _mm256_i32gather_ps(to_linear_8_[0], \
+                            _mm256_and_si256(pixels, low_mask), 4);
+        const __m256 g = _mm256_i32gather_ps(to_linear_8_[1], \
+                            _mm256_and_si256(_mm256_srli_epi32(pixels, 8), low_mask), 4);
+        const __m256 b = _mm256_i32gather_ps(to_linear_8_[2], \
+                            _mm256_and_si256(_mm256_srli_epi32(pixels, 16), low_mask), 4);
+
+        __m256i result = _mm256_and_si256(pixels, alpha_mask);
+        for(int channel = 0; channel < 3; ++channel)
+        {
+            __m256 linear = _mm256_add_ps(_mm256_add_ps( \
+                                _mm256_mul_ps(m[channel*3 + 0], r), \
+                                _mm256_mul_ps(m[channel*3 + 1], g)), \
+                                _mm256_mul_ps(m[channel*3 + 2], b));
+            linear = _mm256_min_ps(one, _mm256_max_ps(zero, linear));
+
+            const __m256i encoded = _mm256_i32gather_epi32(from_linear, \
+                            _mm256_cvtps_epi32(_mm256_mul_ps(linear, steps)), 4);
+            result = _mm256_or_si256(result, \
+                            _mm256_slli_epi32(encoded, channel*8));
+        }
+
+        _mm256_storeu_si256((__m256i*)(row + idx), result);
+    }
+
+    transformRow_Scalar(row + idx, count - idx);
+}
+
+#else
+
+void
+ColorTransform::transformRow_SSE2
+(
+    PixelRGBA8* const row, int count
+) const
+{
+    transformRow_Scalar(row, count);
+}
+
+
+void
+ColorTransform::transformRow_AVX2
+(
+    PixelRGBA8* const row, int count
+) const
+{
+    transformRow_Scalar(row, count);
+}
+
+#endif // SIMD_X86
+
+
+void
+ColorTransform::TransformRow
+(
+    PixelRGBA8* const row, int count
+) const
+{
+    if( is_identity_ )
+    {
+        return;
+    }
+
+    switch(kernel_level_)
+    {
+    case ConvertKernelLevel::AVX512: // no wider gather worth it
+    case ConvertKernelLevel::AVX2:
+        transformRow_AVX2(row, count);
+    break;
+    case ConvertKernelLevel::SSE2:
+        transformRow_SSE2(row, count);
+    break;
+    default:
+        transformRow_Scalar(row, count);
+    break;
+    }
+}
+
+
+template <typename PixelT>
+void
+ColorTransform::TransformRow
+(
+    PixelT* const row, int count
+) const
+{
+    if( is_identity_ )
+    {
+        return;
+    }
+
+    //! [0, 1] -> table value, linearly interpolated
+    auto lookup = [](const float* const table, float value) -> float
+    {
+        value = std::min(1.0f, std::max(0.0f, value))*ENCODING_TABLE_SIZE;
+        const int idx = std::min(int(value), ENCODING_TABLE_SIZE - 1);
+        const float weight = value - idx;
+        return table[idx]*(1 - weight) + table[idx + 1]*weight;
+    };
+
+    for(int idx = 0; idx < count; ++idx)
+    {
+        float rgba[4];
+        row[idx].ToFloat(rgba);
+
+        const float r = lookup(to_linear_[0], rgba[0]);
+        const float g = lookup(to_linear_[1], rgba[1]);
+        const float b = lookup(to_linear_[2], rgba[2]);
+
+        rgba[0] = lookup(from_linear_, matrix_[0]*r + matrix_[1]*g + matrix_[2]*b);
+        rgba[1] = lookup(from_linear_, matrix_[3]*r + matrix_[4]*g + matrix_[5]*b);
+        rgba[2] = lookup(from_linear_, matrix_[6]*r + matrix_[7]*g + matrix_[8]*b);
+        row[idx] = PixelT::FromFloat(rgba);
+    }
+}
+
+
+template void ColorTransform::TransformRow<PixelRGB10A2>(
+    PixelRGB10A2* const, int) const;
+template void ColorTransform::TransformRow<PixelRGBA16F>(
+    PixelRGBA16F* const, int) const;
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+
+#include "pixel.h"
+#include "ColorProfile.h"
+#include "PixelConvert.h"
+
+
+//! what the picked colours are reported in, both with the sRGB tone curve
+enum class TargetColorSpace
+{
+    SRGB,
+    DISPLAY_P3,
+};
+
+
+/*
+ * Display colours -> TargetColorSpace, built once from the display profile:
+ *
+ *   8 bits (or float) --TRC table--> linear --3x3--> linear target
+ *                                          --encoding table--> 8 bits (or float)
+ *
+ * so a row costs two lookups per channel and one matrix, against an
+ * NSColor / CGColor round trip per pixel in the original macOS picker.
+ * Out of gamut colours are clipped.
+ */
+class ColorTransform
+{
+public:
+    ColorTransform(const class ColorProfile& display_profile, \
+                   TargetColorSpace target = TargetColorSpace::SRGB);
+    ~ColorTransform();
+public:
+    //! linear values are looked up in ENCODING_TABLE_SIZE + 1 steps
+    static const int ENCODING_TABLE_SIZE = 4096;
+private:
+    TargetColorSpace target_;
+    //! display linear rgb -> target linear rgb, row major
+    float matrix_[9] = {};
+    //! 8 bits display value -> linear, per channel
+    float to_linear_8_[3][256] = {};
+    //! the same for float input, interpolated
+    float to_linear_[3][ENCODING_TABLE_SIZE + 1] = {};
+    //! linear target -> encoded, 32 bits wide so AVX2 can gather them
+    uint32_t from_linear_8_[ENCODING_TABLE_SIZE + 1] = {};
+    float from_linear_[ENCODING_TABLE_SIZE + 1] = {};
+    //! the display already is the target within 8 bits, nothing to do
+    bool is_identity_ = false;
+    ConvertKernelLevel kernel_level_ = ConvertKernelLevel::SCALAR;
+private:
+    void transformRow_Scalar(PixelRGBA8* const row, int count) const;
+    void transformRow_SSE2(PixelRGBA8* const row, int count) const;
+    void transformRow_AVX2(PixelRGBA8* const row, int count) const;
+public:
+    bool IsIdentity() const { return is_identity_; }
+    TargetColorSpace Target() const { return target_; }
+    const float* Matrix() const { return matrix_; }
+public:
+    //! in place, alpha is kept
+    void TransformRow(PixelRGBA8* const row, int count) const;
+    //! the same through ToFloat / FromFloat, for the HDR formats
+    template <typename PixelT>
+    void TransformRow(PixelT* const row, int count) const;
+public:
+    //! forces a kernel level, for the benchmark, the CPU support is the
+    //! caller's business
+    void SetKernelLevel(ConvertKernelLevel level) { kernel_level_ = level; }
+};
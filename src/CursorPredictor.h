@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cmath>
+
+
+//! Alpha-beta filter over the cursor samples, one sample per tick. It
+//! smooths position and velocity and extrapolates where the cursor will
+//! be a few ticks later.
+class CursorPredictor
+{
+public:
+    //! 0 < ALPHA < 1, 0 < BETA < 2 and 4 - 2*ALPHA - BETA > 0 keep it stable,
+    //! the cursor is not noisy so both gains are on the responsive side
+    static constexpr float ALPHA = 0.8f;
+    static constexpr float BETA  = 0.4f;
+private:
+    bool has_sample_ = false;
+    float x_ = 0, y_ = 0;
+    float velocity_x_ = 0, velocity_y_ = 0;
+public:
+    void Reset() { has_sample_ = false; velocity_x_ = velocity_y_ = 0; }
+public:
+    void Update(int measured_x, int measured_y)
+    {
+        if( !has_sample_ )
+        {
+            x_ = measured_x;
+            y_ = measured_y;
+            has_sample_ = true;
+            return;
+        }
+
+        const float predicted_x = x_ + velocity_x_;
+        const float predicted_y = y_ + velocity_y_;
+        const float residual_x = measured_x - predicted_x;
+        const float residual_y = measured_y - predicted_y;
+
+        x_ = predicted_x + ALPHA*residual_x;
+        y_ = predicted_y + ALPHA*residual_y;
+        velocity_x_ += BETA*residual_x;
+        velocity_y_ += BETA*residual_y;
+    }
+public:
+    void Predict(int ticks_ahead, int* const x, int* const y) const
+    {
+        *x = int(std::lround(x_ + velocity_x_*ticks_ahead));
+        *y = int(std::lround(y_ + velocity_y_*ticks_ahead));
+    }
+public:
+    //! pixels per tick
+    float Speed() const { return std::hypot(velocity_x_, velocity_y_); }
+};
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "pixel.h"
+#include "PixelConvert.h"
+#include "ColorTransform.h"
+#include "PipelineStats.h"
+
+//! Where the picker gets its cursor and its pixels from. The platform
+//! capture backends implement it on top of the live desktop, the synthetic
+//! one replays an image file, so the pipeline runs the same in both cases.
+class FrameSource
+{
+public:
+    virtual ~FrameSource() = default;
+private:
+    const class ColorTransform* color_transform_ = nullptr;
+public:
+    //! display profile -> reported colour space, applied to every refresh
+    //! from now on, nullptr leaves the pixels as captured; the caller keeps
+    //! the transform alive
+    void SetColorTransform(const class ColorTransform* color_transform)
+    {
+        color_transform_ = color_transform;
+    }
+    const class ColorTransform* CurrentColorTransform() const
+    {
+        return color_transform_;
+    }
+public:
+    virtual int ScreenWidth() const = 0;
+    virtual int ScreenHeight() const = 0;
+public:
+    //! false when the source has no more cursor position to offer
+    virtual bool CurrentCursorPosition(int* const x, int* const y) = 0;
+public:
+    //! false when nothing inside the bound changed since the last capture
+    //! of that bound, sources which cannot tell (ReportsDamage() == false)
+    //! report every bound as dirty
+    virtual bool ReportsDamage() const { return false; }
+    virtual bool IsDirtyWithinBound(
+        int central_x, int central_y,
+        int bound_width, int bound_height
+    )
+    {
+        return true;
+    }
+public:
+    //! grabs at least the on-screen part of the bound_width*bound_height
+    //! bound around (central_x, central_y), as the source stores it; the
+    //! frame stays valid until the next capture
+    virtual bool CaptureWithinBound(
+        int central_x, int central_y,
+        int bound_width, int bound_height,
+        struct CapturedFrame* const frame
+    ) = 0;
+public:
+    //! capture then convert into the pipeline format and the reported
+    //! colour space, everything outside of the screen is left black
+    template <typename PixelT>
+    bool RefreshScreenPixelDataWithinBound(
+        int central_x, int central_y,
+        int bound_width, int bound_height,
+        PixelT* const off_screen_render_data
+    )
+    {
+        struct CapturedFrame frame;
+        {
+            class StageTimer timer(PipelineStage::CAPTURE);
+            if( false == CaptureWithinBound(central_x, central_y, \
+                                        bound_width, bound_height, &frame) )
+            {
+                return false;
+            }
+        }
+
+        {
+            class StageTimer timer(PipelineStage::CONVERT);
+            ConvertCapturedFrame(frame, \
+                    central_x - bound_width/2, central_y - bound_height/2, \
+                    bound_width, bound_height, off_screen_render_data, bound_width);
+        }
+
+        if( color_transform_ != nullptr )
+        {
+            class StageTimer timer(PipelineStage::COLOR);
+            color_transform_->TransformRow(off_screen_render_data, \
+                                                bound_width*bound_height);
+        }
+        return true;
+    }
+};
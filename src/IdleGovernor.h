@@ -0,0 +1,113 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <algorithm>
+
+#include "parameters.h"
+
+
+//! Paces the picker loop once it is driven by events instead of a timer.
+//! An event (motion, damage) may tick right away, but never sooner than
+//! the CPU budget allows: with a tick costing w, ticks are at least
+//! w/budget apart. Without any event the loop still ticks, to catch what
+//! no event reports, and every quiet tick doubles the wait up to the idle
+//! interval; a tick that changed something starts over from the fast one.
+class IdleGovernor
+{
+public:
+    typedef std::chrono::steady_clock clock;
+public:
+    //! cpu_budget: share of one core, 0 < cpu_budget <= 1; idle_frequency:
+    //! the slowest rate an idle loop backs off to, in Hz
+    IdleGovernor(double cpu_budget = CPU_BUDGET, \
+                 uint32_t idle_frequency = IDLE_REFRESH_FREQUENCY)
+    :cpu_budget_(std::min(1.0, std::max(0.001, cpu_budget))),
+     active_interval_(std::chrono::microseconds(1000000/CURSOR_REFRESH_FREQUENCY)),
+     idle_interval_(std::chrono::microseconds(1000000/std::max(1u, \
+                    std::min(idle_frequency, CURSOR_REFRESH_FREQUENCY))))
+    {
+        interval_ = active_interval_;
+        start_ = last_tick_ = clock::now();
+    }
+private:
+    const double cpu_budget_;
+    const clock::duration active_interval_;
+    const clock::duration idle_interval_;
+    //! the wait of the next quiet tick
+    clock::duration interval_;
+    //! smoothed cost of a tick
+    double work_us_ = 0;
+    clock::time_point start_;
+    clock::time_point last_tick_;
+private:
+    uint64_t tick_count_ = 0;
+    uint64_t idle_tick_count_ = 0;
+    uint64_t throttled_tick_count_ = 0;
+    clock::duration work_sum_{};
+public:
+    //! no tick before that, whatever woke the loop
+    clock::time_point EarliestTick() const
+    {
+        return last_tick_ + std::chrono::microseconds(int64_t(work_us_/cpu_budget_));
+    }
+    //! the quiet tick, when no event came before
+    clock::time_point NextIdleTick() const
+    {
+        return std::max(EarliestTick(), last_tick_ + interval_);
+    }
+public:
+    //! when a tick woken at now may start, counts the ones held back
+    clock::time_point Admit(clock::time_point now)
+    {
+        const auto earliest = EarliestTick();
+        if( now < earliest )
+        {
+            throttled_tick_count_ += 1;
+            return earliest;
+        }
+        return now;
+    }
+    //! the tick just done: started at start, took work, found anything
+    //! to change (or was woken by motion)
+    void TickDone(clock::time_point start, clock::duration work, bool active)
+    {
+        const double us = std::chrono::duration<double, std::micro>(work).count();
+        work_us_ = tick_count_ == 0 ? us : work_us_ + (us - work_us_)/8;
+        work_sum_ += work;
+        tick_count_ += 1;
+        last_tick_ = start;
+
+        if( active )
+        {
+            interval_ = active_interval_;
+        }
+        else
+        {
+            idle_tick_count_ += 1;
+            interval_ = std::min(idle_interval_, interval_*2);
+        }
+    }
+public:
+    uint64_t TickCount() const { return tick_count_; }
+    uint64_t IdleTickCount() const { return idle_tick_count_; }
+    //! ticks the budget delayed
+    uint64_t ThrottledTickCount() const { return throttled_tick_count_; }
+    //! time spent ticking over the time since construction, wall clock
+    //! time of the ticks so an upper bound of the CPU time
+    double CpuShare() const
+    {
+        const auto elapsed = clock::now() - start_;
+        return elapsed.count() <= 0 ? 0 : double(work_sum_.count())/elapsed.count();
+    }
+    void LogStatistics() const
+    {
+        fprintf(stderr, "ticks %llu, idle %llu, held back by the budget %llu, " \
+                        "cpu %.2f%% of %.0f%%, %.1f us per tick\n", \
+                        (unsigned long long)tick_count_, \
+                        (unsigned long long)idle_tick_count_, \
+                        (unsigned long long)throttled_tick_count_, \
+                        CpuShare()*100, cpu_budget_*100, work_us_);
+    }
+};
@@ -0,0 +1,613 @@
+#include "MagnifierRaster.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+
+#include "simd.h"
+#include "PipelineStats.h"
+
+
+//! SSE2 is the x86-64 baseline, no dispatch needed for these two
+#if defined(__SSE2__) || defined(_M_X64)
+  #define RASTER_SSE2 1
+#endif
+
+
+static inline void
+FillSpan(uint32_t* const dst, uint32_t value, int count)
+{
+    int idx = 0;
+#ifdef RASTER_SSE2
+    const __m128i values = _mm_set1_epi32(int(value));
+    for(; idx + 4 <= count; idx += 4)
+    {
+        _mm_storeu_si128((__m128i*)(dst + idx), values);
+    }
+#endif
+    for(; idx < count; ++idx)
+    {
+        dst[idx] = value;
+    }
+}
+
+
+//! count cells of one colour each, pitch apart; CELL_SIZE 0 is the
+//! generic one, the others let the compiler unroll FillSpan()
+template <int CELL_SIZE>
+static void
+FillCellRow
+(
+    uint32_t* const dst, const uint32_t* const colors,
+    int count, int cell_size, int pitch
+)
+{
+    const int size = CELL_SIZE > 0 ? CELL_SIZE : cell_size;
+    for(int idx = 0; idx < count; ++idx)
+    {
+        FillSpan(dst + idx*pitch, colors[idx], size);
+    }
+}
+
+
+//! the cell sizes of the usual zooms (7 to 13) at 1x and 2x
+static MagnifierRaster::FillCellRowKernel
+FillCellRowKernelOf(int cell_size, bool* const specialised)
+{
+    *specialised = true;
+    switch( cell_size )
+    {
+        case 7:  return FillCellRow<7>;
+        case 9:  return FillCellRow<9>;
+        case 11: return FillCellRow<11>;
+        case 13: return FillCellRow<13>;
+        case 14: return FillCellRow<14>;
+        case 18: return FillCellRow<18>;
+        case 22: return FillCellRow<22>;
+        case 26: return FillCellRow<26>;
+        default: break;
+    }
+    *specialised = false;
+    return FillCellRow<0>;
+}
+
+
+//! changed[idx] = a[idx] != b[idx], the number of changed ones
+static int
+DiffCells(const uint32_t* const a, const uint32_t* const b, uint8_t* const changed, int count)
+{
+    int idx = 0;
+    int changed_count = 0;
+#ifdef RASTER_SSE2
+    for(; idx + 4 <= count; idx += 4)
+    {
+        const __m128i equal = _mm_cmpeq_epi32( \
+                            _mm_loadu_si128((const __m128i*)(a + idx)), \
+                            _mm_loadu_si128((const __m128i*)(b + idx)));
+        const int bits = ~_mm_movemask_ps(_mm_castsi128_ps(equal)) & 0xF;
+        if( bits == 0 )
+        {
+            memset(changed + idx, 0, 4);
+            continue;
+        }
+        for(int lane = 0; lane < 4; ++lane)
+        {
+            changed[idx + lane] = uint8_t((bits >> lane) & 1);
+        }
+        changed_count += (bits & 1) + ((bits >> 1) & 1) + \
+                         ((bits >> 2) & 1) + ((bits >> 3) & 1);
+    }
+#endif
+    for(; idx < count; ++idx)
+    {
+        changed[idx] = a[idx] != b[idx] ? 1 : 0;
+        changed_count += changed[idx];
+    }
+    return changed_count;
+}
+
+
+static void
+CopySpan(uint32_t* const dst, const uint32_t* const src, int count)
+{
+    int idx = 0;
+#ifdef RASTER_SSE2
+    for(; idx + 8 <= count; idx += 8)
+    {
+        const __m128i low  = _mm_loadu_si128((const __m128i*)(src + idx));
+        const __m128i high = _mm_loadu_si128((const __m128i*)(src + idx + 4));
+        _mm_storeu_si128((__m128i*)(dst + idx), low);
+        _mm_storeu_si128((__m128i*)(dst + idx + 4), high);
+    }
+#endif
+    for(; idx < count; ++idx)
+    {
+        dst[idx] = src[idx];
+    }
+}
+
+
+uint32_t
+MagnifierRaster::PackPixel
+(
+    uint8_t r, uint8_t g, uint8_t b, uint8_t a
+)
+{
+    auto premultiply = [a](uint8_t v) -> uint32_t
+    {
+        return (uint32_t(v)*a + 127)/255;
+    };
+    return (uint32_t(a) << 24) | (premultiply(r) << 16) | \
+           (premultiply(g) << 8) | premultiply(b);
+}
+
+
+uint32_t
+MagnifierRaster::BackgroundPixel()
+{
+    //! 0.72 grey at 0.98 opacity, as the GDI+ and Quartz windows had it
+    return PackPixel(uint8_t(0.72f*0xFF), uint8_t(0.72f*0xFF), \
+                     uint8_t(0.72f*0xFF), uint8_t(0.98f*0xFF));
+}
+
+
+int
+MagnifierRaster::WindowSize(int grid_number, int grid_pixel)
+{
+    //! a 1 pixel grid line around every cell
+    return UI_WINDOW_MARGIN*2 + (grid_pixel + 1)*grid_number + 1;
+}
+
+
+int
+MagnifierRaster::ScaleForDPI(int dpi)
+{
+    return std::clamp((dpi + 48)/96, 1, UI_SCALE_MAX);
+}
+
+
+MagnifierRaster::MagnifierRaster(int scale, int grid_number, int grid_pixel) :
+    scale_(std::clamp(scale, 1, UI_SCALE_MAX)),
+    grid_number_(std::clamp(grid_number, GRID_NUMUBER_MIN, GRID_NUMUBER_MAX) | 1),
+    grid_pixel_(std::clamp(grid_pixel, GRID_PIXEL_MIN, GRID_PIXEL_MAX)),
+    size_(WindowSize(grid_number_, grid_pixel_)*scale_),
+    cell_count_(grid_number_*grid_number_),
+    circle_mask_(scale_, size_)
+{
+    fprintf(stderr, "%s\n", __PRETTY_FUNCTION__);
+
+    framebuffer_ = new uint32_t[size_*size_]();
+    clip_spans_ = new struct Span[size_];
+    cell_row_ = new uint32_t[size_];
+
+    fill_cell_row_ = FillCellRowKernelOf(grid_pixel_*scale_, &fast_path_);
+
+    cell_colors_ = new uint32_t[cell_count_]();
+    previous_cell_colors_ = new uint32_t[cell_count_]();
+    dirty_cells_ = new uint8_t[cell_count_]();
+    for(auto& cells : surface_cells_)
+    {
+        cells.colors = new uint32_t[cell_count_]();
+    }
+    //! at most one rect per changed cell, or the whole window
+    present_rects_ = new struct RenderRect[cell_count_];
+
+    framebuffer_surface_.pixels = framebuffer_;
+    framebuffer_surface_.width = size_;
+    framebuffer_surface_.height = size_;
+    framebuffer_surface_.stride = size_;
+
+    //! a pixel is in when its centre is
+    const double centre = size_/2.0;
+    const double radius = size_/2.0 - UI_CIRCLE_INSET*scale_;
+    for(int y = 0; y < size_; ++y)
+    {
+        const double dy = y + 0.5 - centre;
+        if( std::fabs(dy) >= radius )
+        {
+            continue;
+        }
+        const double half_width = std::sqrt(radius*radius - dy*dy);
+        clip_spans_[y].begin = std::max(0, \
+                            int(std::ceil(centre - half_width - 0.5)));
+        clip_spans_[y].end = std::min(size_, \
+                            int(std::floor(centre + half_width - 0.5)) + 1);
+    }
+
+    //! grid lines and margins of a row, the cells are overwritten by every
+    //! Render()
+    FillSpan(cell_row_, BackgroundPixel(), size_);
+
+    //! a frame copies whole clip spans of the cell rows, the mask over
+    //! them has to follow
+    auto is_cell_row = [this](int y)
+    {
+        for(int idx = 0; idx < grid_number_; ++idx)
+        {
+            if( y >= cellOrigin(idx) && y < cellOrigin(idx) + grid_pixel_*scale_ )
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+    frame_mask_runs_ = new struct CircleMask::Run[std::max(1, circle_mask_.RunCount())];
+    frame_mask_row_first_ = new int[size_ + 1]();
+    for(int idx = 0; idx < circle_mask_.RunCount(); ++idx)
+    {
+        const auto& run = circle_mask_.Runs()[idx];
+        const auto& span = clip_spans_[run.y];
+        const int begin = std::max(run.x, span.begin);
+        const int end = std::min(run.x + run.length, span.end);
+        if( begin >= end || false == is_cell_row(run.y) )
+        {
+            continue;
+        }
+        auto& frame_run = frame_mask_runs_[frame_mask_run_count_++];
+        frame_run.y = run.y;
+        frame_run.x = begin;
+        frame_run.length = end - begin;
+        frame_run.pixels = run.pixels + (begin - run.x);
+    }
+    for(int y = 0, idx = 0; y <= size_; ++y)
+    {
+        while( idx < frame_mask_run_count_ && frame_mask_runs_[idx].y < y )
+        {
+            ++idx;
+        }
+        frame_mask_row_first_[y] = idx;
+    }
+
+    drawStaticContent(&framebuffer_surface_);
+}
+
+
+MagnifierRaster::~MagnifierRaster()
+{
+    fprintf(stderr, "%s\n", __PRETTY_FUNCTION__);
+
+    delete[] present_rects_;
+    for(auto& cells : surface_cells_)
+    {
+        delete[] cells.colors;
+    }
+    delete[] dirty_cells_;
+    delete[] previous_cell_colors_;
+    delete[] cell_colors_;
+    delete[] frame_mask_row_first_;
+    delete[] frame_mask_runs_;
+    delete[] cell_row_;
+    delete[] clip_spans_;
+    delete[] framebuffer_;
+}
+
+
+//! top left corner of cell (idx_x, idx_y) in the window
+int
+MagnifierRaster::cellOrigin(int idx) const
+{
+    return (UI_WINDOW_MARGIN + 1 + (grid_pixel_ + 1)*idx)*scale_;
+}
+
+
+int
+MagnifierRaster::FrameMaskPixelCount() const
+{
+    int count = 0;
+    for(int idx = 0; idx < frame_mask_run_count_; ++idx)
+    {
+        count += frame_mask_runs_[idx].length;
+    }
+    return count;
+}
+
+
+void
+MagnifierRaster::drawStaticContent
+(
+    struct RenderSurface* const surface
+)
+{
+    const auto background = BackgroundPixel();
+
+    //! grid lines and margins keep the background forever, outside of the
+    //! circle stays transparent whatever a pooled buffer held before
+    for(int y = 0; y < size_; ++y)
+    {
+        const auto& span = clip_spans_[y];
+        auto row = surface->pixels + y*surface->stride;
+        FillSpan(row, 0, span.begin);
+        FillSpan(row + span.begin, background, span.end - span.begin);
+        FillSpan(row + span.end, 0, size_ - span.end);
+    }
+
+    circle_mask_.Composite(surface->pixels, surface->stride);
+
+    surface->has_static_content = true;
+}
+
+
+void
+MagnifierRaster::drawBox
+(
+    struct RenderSurface* const surface,
+    int left, int top, int size, uint32_t color
+)
+{
+    const int stride = surface->stride;
+    for(int inset = 0; inset < scale_; ++inset)
+    {
+        const int device_size = size*scale_ - inset*2;
+        auto top_row = surface->pixels + (top*scale_ + inset)*stride + \
+                                                        left*scale_ + inset;
+        auto bottom_row = top_row + (device_size - 1)*stride;
+        FillSpan(top_row, color, device_size);
+        FillSpan(bottom_row, color, device_size);
+        for(int idx = 1; idx < device_size - 1; ++idx)
+        {
+            top_row[idx*stride] = color;
+            top_row[idx*stride + device_size - 1] = color;
+        }
+    }
+}
+
+
+void
+MagnifierRaster::Invalidate()
+{
+    for(auto& cells : surface_cells_)
+    {
+        cells.valid = false;
+    }
+    has_previous_frame_ = false;
+}
+
+
+struct MagnifierRaster::SurfaceCells*
+MagnifierRaster::surfaceCellsOf
+(
+    const struct RenderSurface* const surface
+)
+{
+    struct SurfaceCells* least_recent = &surface_cells_[0];
+    for(auto& cells : surface_cells_)
+    {
+        if( cells.surface == surface )
+        {
+            return &cells;
+        }
+        if( cells.last_use < least_recent->last_use )
+        {
+            least_recent = &cells;
+        }
+    }
+    least_recent->surface = surface;
+    least_recent->valid = false;
+    return least_recent;
+}
+
+
+void
+MagnifierRaster::compositeFrameMask
+(
+    struct RenderSurface* const surface,
+    int left, int top, int right, int bottom
+)
+{
+    for(int idx = frame_mask_row_first_[top]; \
+                    idx < frame_mask_row_first_[bottom]; ++idx)
+    {
+        const auto& run = frame_mask_runs_[idx];
+        const int begin = std::max(run.x, left);
+        const int end = std::min(run.x + run.length, right);
+        if( begin < end )
+        {
+            CircleMask::CompositeSpan( \
+                    surface->pixels + run.y*surface->stride + begin, \
+                    run.pixels + (begin - run.x), end - begin);
+        }
+    }
+}
+
+
+void
+MagnifierRaster::drawFullFrame
+(
+    struct RenderSurface* const surface
+)
+{
+    const int cell_size = grid_pixel_*scale_;
+
+    for(int idx_y = 0; idx_y < grid_number_; ++idx_y)
+    {
+        fill_cell_row_(cell_row_ + cellOrigin(0), cell_colors_ + idx_y*grid_number_, \
+                        grid_number_, cell_size, cellOrigin(1) - cellOrigin(0));
+
+        const int row_origin = cellOrigin(idx_y);
+        for(int y = row_origin; y < row_origin + cell_size; ++y)
+        {
+            const auto& span = clip_spans_[y];
+            CopySpan(surface->pixels + y*surface->stride + span.begin, \
+                        cell_row_ + span.begin, span.end - span.begin);
+        }
+    }
+
+    compositeFrameMask(surface, 0, 0, size_, size_);
+}
+
+
+void
+MagnifierRaster::drawDirtyCells
+(
+    struct RenderSurface* const surface
+)
+{
+    const int cell_size = grid_pixel_*scale_;
+
+    for(int idx = 0; idx < cell_count_; ++idx)
+    {
+        if( dirty_cells_[idx] == 0 )
+        {
+            continue;
+        }
+
+        const int left = cellOrigin(idx%grid_number_);
+        const int top  = cellOrigin(idx/grid_number_);
+        const uint32_t color = cell_colors_[idx];
+        for(int y = top; y < top + cell_size; ++y)
+        {
+            const auto& span = clip_spans_[y];
+            const int begin = std::max(left, span.begin);
+            const int end = std::min(left + cell_size, span.end);
+            if( begin < end )
+            {
+                FillSpan(surface->pixels + y*surface->stride + begin, \
+                                                        color, end - begin);
+            }
+        }
+        compositeFrameMask(surface, left, top, left + cell_size, top + cell_size);
+    }
+}
+
+
+void
+MagnifierRaster::collectPresentRects(bool whole_window)
+{
+    present_rect_count_ = 0;
+    repaint_area_ = 0;
+
+    const int changed_count = whole_window ? cell_count_ : \
+            DiffCells(cell_colors_, previous_cell_colors_, dirty_cells_, cell_count_);
+    if( changed_count == 0 )
+    {
+        return;
+    }
+    if( changed_count > cell_count_/2 )
+    {
+        auto& rect = present_rects_[present_rect_count_++];
+        rect.x = 0;
+        rect.y = 0;
+        rect.width = size_;
+        rect.height = size_;
+        repaint_area_ = size_*size_;
+        return;
+    }
+
+    //! one rect per run of changed cells in a cell row
+    const int cell_size = grid_pixel_*scale_;
+    for(int idx_y = 0; idx_y < grid_number_; ++idx_y)
+    {
+        const auto changed = dirty_cells_ + idx_y*grid_number_;
+        for(int idx_x = 0; idx_x < grid_number_; )
+        {
+            if( changed[idx_x] == 0 )
+            {
+                ++idx_x;
+                continue;
+            }
+            int end_x = idx_x + 1;
+            while( end_x < grid_number_ && changed[end_x] != 0 )
+            {
+                ++end_x;
+            }
+
+            auto& rect = present_rects_[present_rect_count_++];
+            rect.x = cellOrigin(idx_x);
+            rect.y = cellOrigin(idx_y);
+            rect.width = cellOrigin(end_x - 1) + cell_size - rect.x;
+            rect.height = cell_size;
+            repaint_area_ += rect.width*rect.height;
+            idx_x = end_x;
+        }
+    }
+}
+
+
+template <typename PixelT>
+bool
+MagnifierRaster::Render
+(
+    const struct ScreenPixelView<PixelT>& view,
+    struct RenderSurface* const surface
+)
+{
+    if( surface->pixels == nullptr || \
+        surface->width < size_ || surface->height < size_ )
+    {
+        fprintf(stderr, "%s Error 1\n", __PRETTY_FUNCTION__);
+        return false;
+    }
+
+    class StageTimer timer(PipelineStage::RENDER);
+
+    const int view_left = view.width/2 - grid_number_/2;
+    const int view_top  = view.height/2 - grid_number_/2;
+    for(int idx_y = 0; idx_y < grid_number_; ++idx_y)
+    {
+        const auto colors = cell_colors_ + idx_y*grid_number_;
+        for(int idx_x = 0; idx_x < grid_number_; ++idx_x)
+        {
+            const auto& pixel = view.At(view_left + idx_x, view_top + idx_y);
+            colors[idx_x] = PackPixel(pixel.R8(), pixel.G8(), pixel.B8());
+        }
+    }
+
+    auto cells = surfaceCellsOf(surface);
+    cells->last_use = ++frame_count_;
+    if( surface->has_static_content == false )
+    {
+        drawStaticContent(surface);
+        cells->valid = false;
+    }
+
+    //! what this surface holds may be a frame or two behind the last one
+    //! presented, its own colours tell which cells to fill
+    const int cell_size = grid_pixel_*scale_;
+    const int dirty_count = cells->valid == false ? cell_count_ : \
+            DiffCells(cell_colors_, cells->colors, dirty_cells_, cell_count_);
+    const bool full_frame = dirty_count > cell_count_/2;
+    const bool centre_dirty = full_frame || \
+            dirty_cells_[(cell_count_ - 1)/2] != 0;
+    if( full_frame )
+    {
+        drawFullFrame(surface);
+        rasterized_area_ = size_*size_;
+        ++full_frame_count_;
+    }
+    else
+    {
+        drawDirtyCells(surface);
+        rasterized_area_ = dirty_count*cell_size*cell_size;
+    }
+
+    //! the black box sits on the grid lines around the centre cell, the
+    //! white one is the border of the cell itself
+    if( centre_dirty )
+    {
+        const int box_origin = UI_WINDOW_MARGIN + 1 + (grid_pixel_ + 1)*(grid_number_/2);
+        drawBox(surface, box_origin - 1, box_origin - 1, grid_pixel_ + 2, \
+                                                PackPixel(0x00, 0x00, 0x00));
+        drawBox(surface, box_origin, box_origin, grid_pixel_, \
+                                                PackPixel(0xFF, 0xFF, 0xFF));
+    }
+
+    memcpy(cells->colors, cell_colors_, sizeof(uint32_t)*cell_count_);
+    cells->valid = true;
+
+    collectPresentRects(has_previous_frame_ == false);
+    memcpy(previous_cell_colors_, cell_colors_, sizeof(uint32_t)*cell_count_);
+    has_previous_frame_ = true;
+
+    repaint_area_sum_ += uint64_t(repaint_area_);
+    rasterized_area_sum_ += uint64_t(rasterized_area_);
+    return true;
+}
+
+
+template bool MagnifierRaster::Render<PixelRGBA8>(
+    const struct ScreenPixelView<PixelRGBA8>&, struct RenderSurface* const);
+template bool MagnifierRaster::Render<PixelRGB10A2>(
+    const struct ScreenPixelView<PixelRGB10A2>&, struct RenderSurface* const);
+template bool MagnifierRaster::Render<PixelRGBA16F>(
+    const struct ScreenPixelView<PixelRGBA16F>&, struct RenderSurface* const);
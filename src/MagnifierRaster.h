@@ -0,0 +1,187 @@
+#pragma once
+
+#include <cstdint>
+
+#include "pixel.h"
+#include "parameters.h"
+#include "CircleMask.h"
+#include "SurfacePool.h"
+
+
+/*
+ * The magnifier window drawn on the CPU into one persistent framebuffer,
+ * premultiplied BGRA as UpdateLayeredWindow and CGBitmapContext take it:
+ *
+ *   - grid_number*grid_number cells of grid_pixel, 1 pixel grid lines
+ *   - a black and white box around the centre cell
+ *   - everything outside of the inscribed circle transparent
+ *   - the ring of res/Mask@*.png over it all
+ *
+ * Everything is drawn at an integer display scale, WindowSize()*scale
+ * device pixels a side, with the mask variant of that scale. The grid and
+ * the zoom are the session's (GRID_NUMUBER cells of GRID_PIXEL by
+ * default); the per cell fills are specialised for the usual cell sizes,
+ * any other one takes the generic loop.
+ *
+ * The parts which never change (grid lines, the outside of the circle, the
+ * mask over them) are drawn once per surface; a full frame only writes one
+ * row per cell row, replicates it grid_pixel*scale times and composites the
+ * bit of the mask lying on those rows again, so a platform just blits
+ * Framebuffer(), or renders straight into the back buffer of its
+ * SurfacePool.
+ *
+ * Most frames are not full ones: with a still cursor only a caret or a
+ * spinner changes. The packed colours of the cells are kept per surface
+ * and diffed row by row, only the cells which differ from what the surface
+ * holds are filled again, and PresentRects() lists the cells which differ
+ * from the previous frame. Invalidate() (the cursor moved) or more than
+ * half of the cells changing falls back to a full frame.
+ */
+class MagnifierRaster
+{
+public:
+    //! grid_number odd, both clamped to the GRID_*_MIN/MAX of parameters.h
+    MagnifierRaster(int scale = 1, int grid_number = GRID_NUMUBER, int grid_pixel = GRID_PIXEL);
+    ~MagnifierRaster();
+public:
+    //! dst[pitch*idx], cell_size pixels of colors[idx], idx < count
+    typedef void (*FillCellRowKernel)(
+        uint32_t* const dst, const uint32_t* const colors,
+        int count, int cell_size, int pitch
+    );
+private:
+    const int scale_;
+    const int grid_number_;
+    const int grid_pixel_;
+    //! WindowSize(grid_number_, grid_pixel_)*scale_
+    const int size_;
+    //! grid_number_*grid_number_
+    const int cell_count_;
+    FillCellRowKernel fill_cell_row_ = nullptr;
+    bool fast_path_ = false;
+    //! size_*size_
+    uint32_t* framebuffer_ = nullptr;
+    struct RenderSurface framebuffer_surface_;
+    //! pixels [begin, end) of each row are inside of the circle
+    struct Span
+    {
+        int begin = 0, end = 0;
+    };
+    struct Span* clip_spans_ = nullptr;
+    //! one row of cells, replicated into the framebuffer
+    uint32_t* cell_row_ = nullptr;
+private:
+    class CircleMask circle_mask_;
+    //! the parts of the mask runs every frame overwrites, row major, the
+    //! ones of row y are [frame_mask_row_first_[y], frame_mask_row_first_[y + 1])
+    struct CircleMask::Run* frame_mask_runs_ = nullptr;
+    int frame_mask_run_count_ = 0;
+    int* frame_mask_row_first_ = nullptr;
+private:
+    //! packed cell colours of the frame being rendered and of the last one
+    uint32_t* cell_colors_ = nullptr;
+    uint32_t* previous_cell_colors_ = nullptr;
+    bool has_previous_frame_ = false;
+    //! 1 for the cells to fill again
+    uint8_t* dirty_cells_ = nullptr;
+    //! what every surface rendered into holds, the own framebuffer and
+    //! those of a pool, least recently used one replaced
+    struct SurfaceCells
+    {
+        const struct RenderSurface* surface = nullptr;
+        uint32_t* colors = nullptr;
+        bool valid = false;
+        uint64_t last_use = 0;
+    };
+    struct SurfaceCells surface_cells_[SurfacePool::MAX_BUFFER_COUNT + 1];
+private:
+    struct RenderRect* present_rects_ = nullptr;
+    int present_rect_count_ = 0;
+    int repaint_area_ = 0;
+    int rasterized_area_ = 0;
+private:
+    uint64_t frame_count_ = 0;
+    uint64_t full_frame_count_ = 0;
+    uint64_t repaint_area_sum_ = 0;
+    uint64_t rasterized_area_sum_ = 0;
+private:
+    int cellOrigin(int idx) const;
+    struct SurfaceCells* surfaceCellsOf(const struct RenderSurface* const surface);
+    void drawStaticContent(struct RenderSurface* const surface);
+    void drawFullFrame(struct RenderSurface* const surface);
+    void drawDirtyCells(struct RenderSurface* const surface);
+    //! the frame mask runs over [left, right) x [top, bottom)
+    void compositeFrameMask(
+        struct RenderSurface* const surface,
+        int left, int top, int right, int bottom
+    );
+    //! one rect per horizontal run of cells differing from the last frame
+    void collectPresentRects(bool whole_window);
+    //! the 1 (logical) pixel outline of a size*size (logical) square
+    void drawBox(
+        struct RenderSurface* const surface,
+        int left, int top, int size, uint32_t color
+    );
+public:
+    static uint32_t BackgroundPixel();
+    //! 0xAARRGGBB, premultiplied, as the framebuffer stores it
+    static uint32_t PackPixel(uint8_t r, uint8_t g, uint8_t b, uint8_t a = 0xFF);
+    //! the integer scale a window on a dpi screen is drawn at, 1 to
+    //! UI_SCALE_MAX
+    static int ScaleForDPI(int dpi);
+    //! logical size of the window of a grid_number*grid_number grid of
+    //! grid_pixel cells, UI_WINDOW_SIZE for the default ones
+    static int WindowSize(int grid_number, int grid_pixel);
+public:
+    //! the GridNumber()*GridNumber() cells around the centre of view, the
+    //! view must be at least that large
+    template <typename PixelT>
+    void Render(const struct ScreenPixelView<PixelT>& view)
+    {
+        Render(view, &framebuffer_surface_);
+    }
+    //! into the top left Size()*Size() of surface, false when it is
+    //! smaller than that
+    template <typename PixelT>
+    bool Render(
+        const struct ScreenPixelView<PixelT>& view,
+        struct RenderSurface* const surface
+    );
+    //! the next frames are full ones, in every surface: the window moved
+    //! or the cursor did, so every cell shifted anyway
+    void Invalidate();
+public:
+    //! what the last Render() changed against the frame before it, for
+    //! SurfacePool::Present()
+    const struct RenderRect* PresentRects() const { return present_rects_; }
+    int PresentRectCount() const { return present_rect_count_; }
+    //! pixels of the last frame in PresentRects() / filled again
+    int RepaintArea() const { return repaint_area_; }
+    int RasterizedArea() const { return rasterized_area_; }
+public:
+    uint64_t FrameCount() const { return frame_count_; }
+    uint64_t FullFrameCount() const { return full_frame_count_; }
+    //! mean of RepaintArea() over the frames, as a part of the window
+    double MeanRepaintRatio() const
+    {
+        return frame_count_ == 0 ? 0 : \
+                double(repaint_area_sum_)/frame_count_/(double(size_)*size_);
+    }
+    double MeanRasterizedRatio() const
+    {
+        return frame_count_ == 0 ? 0 : \
+                double(rasterized_area_sum_)/frame_count_/(double(size_)*size_);
+    }
+public:
+    const uint32_t* Framebuffer() const { return framebuffer_; }
+    const class CircleMask& Mask() const { return circle_mask_; }
+    int Scale() const { return scale_; }
+    int GridNumber() const { return grid_number_; }
+    int GridPixel() const { return grid_pixel_; }
+    //! the cell size has a specialised fill
+    bool FastPath() const { return fast_path_; }
+    int Size() const { return size_; }
+    int Stride() const { return size_*4; }
+    //! mask pixels composited again by every frame
+    int FrameMaskPixelCount() const;
+};
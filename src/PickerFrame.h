@@ -0,0 +1,105 @@
+#pragma once
+
+#include <chrono>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <algorithm>
+
+#include "pixel.h"
+#include "BufferPool.h"
+
+
+//! The colour of one frame as the listeners and JS get it
+struct PickerColor
+{
+    uint64_t frame_id = 0;
+    int cursor_x = 0;
+    int cursor_y = 0;
+    //! 0xRRGGBBAA
+    uint32_t rgba = 0;
+    //! "#RRGGBB"
+    char color[8] = {};
+    //! the capture around the cursor, pixels_width*pixels_height pixels of
+    //! the pipeline format, shared with the frame it comes from
+    class SharedBuffer pixels;
+    int pixels_width = 0;
+    int pixels_height = 0;
+};
+
+
+//! What the capture thread hands to the render/emit stage for one
+//! captured frame (PickerPipeline::Snapshot()), through a TripleBuffer
+template <typename PixelT>
+struct PickerFrame
+{
+    //! 0 until the first snapshot, then counting up
+    uint64_t id = 0;
+    int cursor_x = 0;
+    int cursor_y = 0;
+    //! the capture around the cursor, width*height PixelT, the cursor at
+    //! the centre; from the pipeline's pool, a new one whenever the last
+    //! is still shared
+    class SharedBuffer pixels;
+    int width = 0;
+    int height = 0;
+    //! the pixel under the cursor, or the sample around it
+    PixelT central_pixel;
+    //! 0xRRGGBBAA and "#RRGGBB" of central_pixel
+    uint32_t rgba = 0;
+    char color[8] = {};
+    //! the tick which captured it started, it was published
+    std::chrono::steady_clock::time_point tick_start;
+    std::chrono::steady_clock::time_point published;
+public:
+    struct PickerColor Color() const
+    {
+        struct PickerColor picker_color;
+        picker_color.frame_id = id;
+        picker_color.cursor_x = cursor_x;
+        picker_color.cursor_y = cursor_y;
+        picker_color.rgba = rgba;
+        std::copy(color, color + sizeof(color), picker_color.color);
+        picker_color.pixels = pixels;
+        picker_color.pixels_width = width;
+        picker_color.pixels_height = height;
+        return picker_color;
+    }
+    struct ScreenPixelView<PixelT> View() const
+    {
+        struct ScreenPixelView<PixelT> view;
+        view.data = reinterpret_cast<const PixelT*>(pixels.Data());
+        view.width = width;
+        view.height = height;
+        view.stride = width;
+        return view;
+    }
+};
+
+
+//! Time from the start of the tick which captured a frame to the moment
+//! the consumer presented it, over the frames presented
+class FrameLatency
+{
+private:
+    uint64_t count_ = 0;
+    double sum_us_ = 0;
+    double max_us_ = 0;
+public:
+    void Add(std::chrono::steady_clock::duration latency)
+    {
+        const double us = std::chrono::duration<double, std::micro>(latency).count();
+        count_ += 1;
+        sum_us_ += us;
+        max_us_ = std::max(max_us_, us);
+    }
+public:
+    uint64_t Count() const { return count_; }
+    double MeanMicroseconds() const { return count_ == 0 ? 0 : sum_us_/count_; }
+    double MaxMicroseconds() const { return max_us_; }
+    void LogStatistics(const char* name) const
+    {
+        fprintf(stderr, "%s %.1f us mean, %.1f us max over %llu frames\n", \
+                name, MeanMicroseconds(), max_us_, (unsigned long long)count_);
+    }
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "PickerFrame.h"
+
+
+//! Where a pick reports its colours. The platform pickers and the synthetic
+//! pipeline call it from the thread presenting frames, never from the JS
+//! one; the addon forwards to JS from there.
+class PickerListener
+{
+public:
+    virtual ~PickerListener() = default;
+public:
+    //! the newest colour under the cursor; frame ids count the frames
+    //! captured, a gap is frames replaced before they were presented
+    virtual void Update(const struct PickerColor& color) = 0;
+    //! the pick is over on that colour, not called when it was cancelled
+    virtual void Pick(const char* color) = 0;
+};
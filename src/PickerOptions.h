@@ -0,0 +1,30 @@
+#pragma once
+
+#include "ColorTransform.h"
+#include "RegionSampler.h"
+#include "parameters.h"
+
+
+//! what the JS side can tune, shared by the platform pickers and the
+//! pipeline; the defaults pick one pixel in sRGB like the original picker
+struct PickerOptions
+{
+    //! nullptr: the display's own profile to color_space, when it has one
+    const class ColorTransform* color_transform = nullptr;
+    TargetColorSpace color_space = TargetColorSpace::SRGB;
+    //! odd, 1 up to SAMPLE_SIZE_MAX, the picked colour is reduced from the
+    //! sample_size*sample_size pixels around the cursor
+    int sample_size = 1;
+    SampleMode sample_mode = SampleMode::MEAN;
+    //! the magnifier: grid_number*grid_number cells of grid_pixel pixels,
+    //! grid_number odd, both within the GRID_*_MIN/MAX of parameters.h;
+    //! the capture is at least the grid, the `magnifier` update is drawn
+    //! with both
+    int grid_number = GRID_NUMUBER;
+    int grid_pixel = GRID_PIXEL;
+    //! share of one core the loop may spend, 0 < cpu_budget <= 1
+    double cpu_budget = CPU_BUDGET;
+    //! the capture, hand-off and cache statistics of the pick on stderr
+    //! once it ends, for profiling; getStats() has the latencies anyway
+    bool log_statistics = false;
+};
@@ -0,0 +1,274 @@
+#include "PickerPipeline.h"
+
+#include <cstdio>
+#include <cmath>
+#include <utility>
+#include <algorithm>
+
+#include "parameters.h"
+#include "PipelineStats.h"
+
+
+template <typename PixelT>
+PickerPipeline<PixelT>::PickerPipeline
+(
+    class FrameSource* frame_source,
+    const struct PickerOptions& options,
+    std::shared_ptr<class BufferPool> buffer_pool
+)
+:frame_source_(frame_source), buffer_pool_(std::move(buffer_pool))
+{
+    sample_size_ = std::min(SAMPLE_SIZE_MAX, std::max(1, options.sample_size)) | 1;
+    sample_mode_ = options.sample_mode;
+    grid_number_ = std::min(GRID_NUMUBER_MAX, std::max(GRID_NUMUBER_MIN, options.grid_number)) | 1;
+    capture_width_ = std::max(grid_number_, sample_size_);
+    capture_height_ = std::max(grid_number_, sample_size_);
+
+    if( buffer_pool_ == nullptr )
+    {
+        buffer_pool_ = BufferPool::Create();
+    }
+
+    const auto data_size = capture_width_*capture_height_;
+    recorded_screen_render_data_buffer_ = new PixelT[data_size];
+
+    render_view_.data = recorded_screen_render_data_buffer_;
+    render_view_.width = capture_width_;
+    render_view_.height = capture_height_;
+    render_view_.stride = capture_width_;
+
+    if( frame_source_->ReportsDamage() )
+    {
+        tile_cache_ = new class TileCache<PixelT>(frame_source_);
+    }
+}
+
+
+template <typename PixelT>
+PickerPipeline<PixelT>::~PickerPipeline()
+{
+    delete tile_cache_;
+    delete[] recorded_screen_render_data_buffer_;
+}
+
+
+template <typename PixelT>
+bool
+PickerPipeline<PixelT>::Tick()
+{
+    auto& stats = PipelineStats::Global();
+    {
+        class StageTimer timer(PipelineStage::CURSOR);
+        if( false == frame_source_->CurrentCursorPosition(&cursor_x_, &cursor_y_) )
+        {
+            return false;
+        }
+    }
+    stats.Count(PipelineCounter::TICKS);
+
+    const auto slot = tick_count_ % CURSOR_PREDICTION_TICKS;
+    if( tick_count_ >= CURSOR_PREDICTION_TICKS )
+    {
+        prediction_error_sum_ += std::hypot( \
+                                cursor_x_ - predicted_cursor_[slot].x, \
+                                cursor_y_ - predicted_cursor_[slot].y );
+        prediction_count_ += 1;
+    }
+    cursor_predictor_.Update(cursor_x_, cursor_y_);
+    cursor_predictor_.Predict(CURSOR_PREDICTION_TICKS, \
+                    &predicted_cursor_[slot].x, &predicted_cursor_[slot].y);
+    tick_count_ += 1;
+
+    frame_changed_ = false;
+
+    const bool cursor_moved = !has_captured_frame_ || \
+                              cursor_x_ != captured_cursor_x_ || \
+                              cursor_y_ != captured_cursor_y_;
+
+    if( cursor_moved || frame_source_->IsDirtyWithinBound( \
+                cursor_x_, cursor_y_, capture_width_, capture_height_) )
+    {
+        bool captured = false;
+        if( tile_cache_ != nullptr )
+        {
+            frame_changed_ = tile_cache_->ViewWithinBound( \
+                cursor_x_, cursor_y_, capture_width_, capture_height_, \
+                                            &render_view_, &captured );
+        }
+
+        if( frame_changed_ == false )
+        {
+            frame_changed_ = frame_source_->RefreshScreenPixelDataWithinBound( \
+                    cursor_x_, cursor_y_, capture_width_, capture_height_, \
+                                    recorded_screen_render_data_buffer_ );
+            render_view_.data = recorded_screen_render_data_buffer_;
+            render_view_.stride = capture_width_;
+            captured = true;
+        }
+
+        if( frame_changed_ && sample_size_ > 1 )
+        {
+            sampleAroundCursor();
+        }
+
+        has_captured_frame_ = frame_changed_;
+        captured_cursor_x_ = cursor_x_;
+        captured_cursor_y_ = cursor_y_;
+        if( captured )
+        {
+            performed_capture_count_ += 1;
+            stats.Count(PipelineCounter::CAPTURES);
+        }
+    }
+    else
+    {
+        skipped_capture_count_ += 1;
+    }
+
+    return true;
+}
+
+
+template <typename PixelT>
+void
+PickerPipeline<PixelT>::sampleAroundCursor()
+{
+    region_sampler_.Build(render_view_);
+
+    //! the black around the screen edges is no colour the user pointed at
+    const int view_left = cursor_x_ - capture_width_/2;
+    const int view_top  = cursor_y_ - capture_height_/2;
+    const int left   = std::max(cursor_x_ - sample_size_/2, 0);
+    const int top    = std::max(cursor_y_ - sample_size_/2, 0);
+    const int right  = std::min(cursor_x_ - sample_size_/2 + sample_size_, \
+                                            frame_source_->ScreenWidth());
+    const int bottom = std::min(cursor_y_ - sample_size_/2 + sample_size_, \
+                                            frame_source_->ScreenHeight());
+
+    sampled_pixel_ = region_sampler_.Sample(left - view_left, top - view_top, \
+                                    right - left, bottom - top, sample_mode_);
+}
+
+
+template <typename PixelT>
+bool
+PickerPipeline<PixelT>::Prefetch()
+{
+    if( tile_cache_ == nullptr || \
+        cursor_predictor_.Speed() < CURSOR_PREFETCH_MIN_SPEED )
+    {
+        return false;
+    }
+
+    int predicted_x = 0, predicted_y = 0;
+    cursor_predictor_.Predict(CURSOR_PREDICTION_TICKS, \
+                                            &predicted_x, &predicted_y);
+
+    return tile_cache_->Prefetch(predicted_x, predicted_y, \
+                                        capture_width_, capture_height_);
+}
+
+
+template <typename PixelT>
+void
+PickerPipeline<PixelT>::LogStatistics() const
+{
+    fprintf(stderr, "captures performed %llu, skipped %llu\n", \
+                (unsigned long long)performed_capture_count_, \
+                (unsigned long long)skipped_capture_count_);
+
+    if( tile_cache_ != nullptr )
+    {
+        fprintf(stderr, "tile cache hit rate %.1f%% (%llu hits, %llu misses)\n", \
+                        tile_cache_->HitRate()*100, \
+                        (unsigned long long)tile_cache_->HitCount(), \
+                        (unsigned long long)tile_cache_->MissCount());
+
+        const double saved_ms = std::chrono::duration<double, std::milli>( \
+                                    tile_cache_->PrefetchSavedTime()).count();
+        fprintf(stderr, "prefetched tiles %llu, reached %llu, "
+                        "capture time saved %.2f ms\n", \
+                        (unsigned long long)tile_cache_->PrefetchCount(), \
+                        (unsigned long long)tile_cache_->PrefetchHitCount(), \
+                        saved_ms);
+    }
+
+    fprintf(stderr, "cursor prediction %d ticks ahead, mean error %.1f px\n", \
+                        CURSOR_PREDICTION_TICKS, MeanPredictionError());
+
+    if( snapshot_count_ > 0 )
+    {
+        fprintf(stderr, "snapshots %llu, buffers allocated %llu, reused %llu\n", \
+                        (unsigned long long)snapshot_count_, \
+                        (unsigned long long)SnapshotAllocatedCount(), \
+                        (unsigned long long)SnapshotReusedCount());
+    }
+}
+
+
+template <typename PixelT>
+const PixelT&
+PickerPipeline<PixelT>::CentralPixel() const
+{
+    if( sample_size_ > 1 )
+    {
+        return sampled_pixel_;
+    }
+    return render_view_.At(capture_width_/2, capture_height_/2);
+}
+
+
+template <typename PixelT>
+std::string
+PickerPipeline<PixelT>::CentralPixelColor() const
+{
+    auto pixel = CentralPixel();
+
+    int r = pixel.R8();
+    int g = pixel.G8();
+    int b = pixel.B8();
+
+    char color[8] = {};
+    snprintf(color, sizeof(color), "#%02X%02X%02X", r, g, b);
+    return color;
+}
+
+
+template <typename PixelT>
+void
+PickerPipeline<PixelT>::Snapshot
+(
+    struct PickerFrame<PixelT>* const frame
+)
+{
+    frame->id = ++snapshot_count_;
+    frame->cursor_x = cursor_x_;
+    frame->cursor_y = cursor_y_;
+    frame->width = render_view_.width;
+    frame->height = render_view_.height;
+    //! whoever still holds the last one (JS) keeps it, unchanged
+    const auto size = sizeof(PixelT)*frame->width*frame->height;
+    if( frame->pixels.Empty() || frame->pixels.Shared() || frame->pixels.Size() != size )
+    {
+        frame->pixels = SharedBuffer(buffer_pool_->Acquire(size));
+    }
+    auto pixels = reinterpret_cast<PixelT*>(frame->pixels.Data());
+    for(int y = 0; y < frame->height; ++y)
+    {
+        const PixelT* row = &render_view_.At(0, y);
+        std::copy(row, row + frame->width, pixels + y*frame->width);
+    }
+
+    frame->central_pixel = CentralPixel();
+    frame->rgba = uint32_t(frame->central_pixel.R8()) << 24 | \
+                  uint32_t(frame->central_pixel.G8()) << 16 | \
+                  uint32_t(frame->central_pixel.B8()) << 8 | 0xFF;
+    snprintf(frame->color, sizeof(frame->color), "#%02X%02X%02X", \
+                        frame->central_pixel.R8(), frame->central_pixel.G8(), \
+                        frame->central_pixel.B8());
+}
+
+
+template class PickerPipeline<PixelRGBA8>;
+template class PickerPipeline<PixelRGB10A2>;
+template class PickerPipeline<PixelRGBA16F>;
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <string>
+#include <memory>
+#include <cstdint>
+
+#include "FrameSource.h"
+#include "TileCache.h"
+#include "CursorPredictor.h"
+#include "RegionSampler.h"
+#include "PickerOptions.h"
+#include "PickerFrame.h"
+#include "parameters.h"
+
+
+//! cursor read -> capture -> convert, shared by every platform and by the
+//! synthetic source, the caller renders and emits what Tick() produced.
+//! PixelT is the format of the render data, see pixel.h
+template <typename PixelT>
+class PickerPipeline
+{
+public:
+    //! buffer_pool: where the snapshots take their pixels from, a pool of
+    //! its own when nullptr; a warm session keeps one across picks
+    PickerPipeline(class FrameSource* frame_source, \
+                   const struct PickerOptions& options = {}, \
+                   std::shared_ptr<class BufferPool> buffer_pool = nullptr);
+    ~PickerPipeline();
+private:
+    class FrameSource* const frame_source_;
+private:
+    //! the magnifier grid of the session, cells a side
+    int grid_number_ = GRID_NUMUBER;
+    //! the grid, grown to the sample when it is bigger, odd both
+    int capture_width_ = CAPTURE_WIDTH;
+    int capture_height_ = CAPTURE_HEIGHT;
+    int sample_size_ = 1;
+    SampleMode sample_mode_ = SampleMode::MEAN;
+    class RegionSampler<PixelT> region_sampler_;
+    //! reduced from the sample once per captured frame
+    PixelT sampled_pixel_;
+private:
+    //! only for sources reporting damage, the others would have to capture
+    //! a whole tile on every refresh
+    class TileCache<PixelT>* tile_cache_ = nullptr;
+private:
+    PixelT* recorded_screen_render_data_buffer_ = nullptr;
+    struct ScreenPixelView<PixelT> render_view_;
+private:
+    int cursor_x_ = 0;
+    int cursor_y_ = 0;
+private:
+    //! where the buffer above was captured, a capture is only worth it
+    //! when the cursor left this point or the source reports damage
+    bool has_captured_frame_ = false;
+    int captured_cursor_x_ = 0;
+    int captured_cursor_y_ = 0;
+    bool frame_changed_ = false;
+private:
+    class CursorPredictor cursor_predictor_;
+    uint64_t tick_count_ = 0;
+    //! what was predicted CURSOR_PREDICTION_TICKS ago for this very tick
+    struct { int x = 0, y = 0; } predicted_cursor_[CURSOR_PREDICTION_TICKS];
+    double prediction_error_sum_ = 0;
+    uint64_t prediction_count_ = 0;
+private:
+    uint64_t snapshot_count_ = 0;
+    //! the pixels of the snapshots, shared with their consumers
+    std::shared_ptr<class BufferPool> buffer_pool_;
+private:
+    uint64_t performed_capture_count_ = 0;
+    uint64_t skipped_capture_count_ = 0;
+private:
+    //! sampled_pixel_ from the render view, once per captured frame
+    void sampleAroundCursor();
+public:
+    //! false once the frame source has no more cursor position
+    bool Tick();
+public:
+    //! for the slack between two ticks: captures the tile the cursor is
+    //! heading to, false when it is not moving or the tile is valid already
+    bool Prefetch();
+    //! mean distance between the predicted and the real cursor, in pixels
+    double MeanPredictionError() const
+    {
+        return prediction_count_ == 0 ? 0 : prediction_error_sum_/prediction_count_;
+    }
+public:
+    //! true when the last Tick() refreshed the render data
+    bool FrameChanged() const { return frame_changed_; }
+    uint64_t PerformedCaptureCount() const { return performed_capture_count_; }
+    uint64_t SkippedCaptureCount() const { return skipped_capture_count_; }
+    const class TileCache<PixelT>* Cache() const { return tile_cache_; }
+public:
+    int CursorX() const { return cursor_x_; }
+    int CursorY() const { return cursor_y_; }
+    //! CaptureWidth()*CaptureHeight(), either the own buffer or a cached
+    //! tile, the cursor is at the centre
+    const struct ScreenPixelView<PixelT>& RenderView() const { return render_view_; }
+    int GridNumber() const { return grid_number_; }
+    int CaptureWidth() const { return capture_width_; }
+    int CaptureHeight() const { return capture_height_; }
+public:
+    //! capture, tile cache and prediction counters, on stderr
+    void LogStatistics() const;
+public:
+    //! the pixel under the cursor, or the sample around it
+    const PixelT& CentralPixel() const;
+    //! "#RRGGBB" of CentralPixel()
+    std::string CentralPixelColor() const;
+public:
+    //! the render view and the central pixel into frame, for the thread
+    //! presenting it; frame keeps its buffer from one snapshot to the next
+    //! unless a consumer still holds it
+    void Snapshot(struct PickerFrame<PixelT>* const frame);
+    //! buffers the snapshots allocated / took back from the pool
+    uint64_t SnapshotAllocatedCount() const { return buffer_pool_->AllocatedCount(); }
+    uint64_t SnapshotReusedCount() const { return buffer_pool_->ReusedCount(); }
+};
@@ -0,0 +1,245 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <algorithm>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+
+//! the stages of a frame, in order
+enum class PipelineStage : int
+{
+    CURSOR = 0,     //! reading the cursor position
+    CAPTURE,        //! grabbing the pixels from the source
+    CONVERT,        //! into the pipeline format
+    COLOR,          //! through the colour transform
+    RENDER,         //! rasterizing the magnifier
+    PRESENT,        //! handing the magnifier to the window system
+    EMIT,           //! from the picker thread to the JS `update` returned
+    COUNT
+};
+
+
+inline const char*
+PipelineStageName(PipelineStage stage)
+{
+    static const char* const names[] = {
+        "cursor", "capture", "convert", "color", "render", "present", "emit"
+    };
+    return names[int(stage)];
+}
+
+
+//! frames counted along the way
+enum class PipelineCounter : int
+{
+    TICKS = 0,      //! pipeline ticks
+    CAPTURES,       //! ticks which captured
+    PUBLISHED,      //! frames handed over by the capture thread
+    PRESENTED,      //! frames taken by the presenting thread
+    EMITTED,        //! updates delivered to JS
+    COUNT
+};
+
+
+inline const char*
+PipelineCounterName(PipelineCounter counter)
+{
+    static const char* const names[] = {
+        "ticks", "captures", "published", "presented", "emitted"
+    };
+    return names[int(counter)];
+}
+
+
+//! Latencies in nanoseconds, HDR style: exact below SUB_BUCKET_COUNT, then
+//! SUB_BUCKET_COUNT/2 buckets per power of two, within 1/32 of the value,
+//! up to 2^MAX_BITS ns (18 minutes, longer ones are clamped). Add() is a
+//! few relaxed atomics from any thread, readers see a consistent enough
+//! picture without stopping the writers.
+class LatencyHistogram
+{
+public:
+    static constexpr int SUB_BUCKET_BITS = 6;
+    static constexpr int SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+    static constexpr int SUB_BUCKET_HALF = SUB_BUCKET_COUNT/2;
+    static constexpr int MAX_BITS = 40;
+    static constexpr uint64_t MAX_VALUE = (uint64_t(1) << MAX_BITS) - 1;
+    static constexpr int BUCKET_COUNT = \
+                    SUB_BUCKET_COUNT + (MAX_BITS - SUB_BUCKET_BITS)*SUB_BUCKET_HALF;
+public:
+    LatencyHistogram()
+    {
+        Reset();
+    }
+private:
+    std::atomic<uint64_t> buckets_[BUCKET_COUNT];
+    std::atomic<uint64_t> count_;
+    std::atomic<uint64_t> sum_ns_;
+    std::atomic<uint64_t> max_ns_;
+public:
+    static int BucketOf(uint64_t ns)
+    {
+        if( ns < uint64_t(SUB_BUCKET_COUNT) )
+        {
+            return int(ns);
+        }
+        ns = std::min(ns, MAX_VALUE);
+#if defined(_MSC_VER)
+        unsigned long msb = 0;
+        _BitScanReverse64(&msb, ns);
+#else
+        const int msb = 63 - __builtin_clzll(ns);
+#endif
+        const int shift = int(msb) - SUB_BUCKET_BITS + 1;
+        return SUB_BUCKET_COUNT + (shift - 1)*SUB_BUCKET_HALF + \
+               int(ns >> shift) - SUB_BUCKET_HALF;
+    }
+    //! the highest value counted in bucket
+    static uint64_t HighestOf(int bucket)
+    {
+        if( bucket < SUB_BUCKET_COUNT )
+        {
+            return uint64_t(bucket);
+        }
+        const int shift = (bucket - SUB_BUCKET_COUNT)/SUB_BUCKET_HALF + 1;
+        const uint64_t mantissa = (bucket - SUB_BUCKET_COUNT)%SUB_BUCKET_HALF + SUB_BUCKET_HALF;
+        return ((mantissa + 1) << shift) - 1;
+    }
+public:
+    void Add(std::chrono::steady_clock::duration latency)
+    {
+        const auto ns = uint64_t(std::max<int64_t>(0, \
+                std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count()));
+        buckets_[BucketOf(ns)].fetch_add(1, std::memory_order_relaxed);
+        count_.fetch_add(1, std::memory_order_relaxed);
+        sum_ns_.fetch_add(ns, std::memory_order_relaxed);
+
+        auto max_ns = max_ns_.load(std::memory_order_relaxed);
+        while( ns > max_ns && \
+               false == max_ns_.compare_exchange_weak(max_ns, ns, std::memory_order_relaxed) )
+        {
+        }
+    }
+    //! not atomic as a whole, what is added meanwhile may be half counted
+    void Reset()
+    {
+        for(auto& bucket : buckets_)
+        {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        count_.store(0, std::memory_order_relaxed);
+        sum_ns_.store(0, std::memory_order_relaxed);
+        max_ns_.store(0, std::memory_order_relaxed);
+    }
+public:
+    uint64_t Count() const { return count_.load(std::memory_order_relaxed); }
+    double MeanMicroseconds() const
+    {
+        const auto count = Count();
+        return count == 0 ? 0 : sum_ns_.load(std::memory_order_relaxed)/1000.0/count;
+    }
+    double MaxMicroseconds() const
+    {
+        return max_ns_.load(std::memory_order_relaxed)/1000.0;
+    }
+    //! the latency a ratio of the samples stay within, 0 < ratio <= 1, as
+    //! the highest value of its bucket but never above the max
+    double PercentileMicroseconds(double ratio) const
+    {
+        uint64_t total = 0;
+        for(const auto& bucket : buckets_)
+        {
+            total += bucket.load(std::memory_order_relaxed);
+        }
+        if( total == 0 )
+        {
+            return 0;
+        }
+
+        const auto rank = std::max<uint64_t>(1, uint64_t(ratio*total + 0.5));
+        uint64_t seen = 0;
+        for(int idx = 0; idx < BUCKET_COUNT; ++idx)
+        {
+            seen += buckets_[idx].load(std::memory_order_relaxed);
+            if( seen >= rank )
+            {
+                return std::min(HighestOf(idx), \
+                                max_ns_.load(std::memory_order_relaxed))/1000.0;
+            }
+        }
+        return MaxMicroseconds();
+    }
+};
+
+
+//! The per stage histograms and frame counters of the process, fed by
+//! every pick, sample and benchmark, read by getStats()
+class PipelineStats
+{
+public:
+    static class PipelineStats& Global()
+    {
+        static class PipelineStats stats;
+        return stats;
+    }
+private:
+    PipelineStats()
+    {
+        Reset();
+    }
+private:
+    class LatencyHistogram stages_[int(PipelineStage::COUNT)];
+    std::atomic<uint64_t> counters_[int(PipelineCounter::COUNT)];
+public:
+    void Add(PipelineStage stage, std::chrono::steady_clock::duration latency)
+    {
+        stages_[int(stage)].Add(latency);
+    }
+    void Count(PipelineCounter counter, uint64_t count = 1)
+    {
+        counters_[int(counter)].fetch_add(count, std::memory_order_relaxed);
+    }
+    void Reset()
+    {
+        for(auto& stage : stages_)
+        {
+            stage.Reset();
+        }
+        for(auto& counter : counters_)
+        {
+            counter.store(0, std::memory_order_relaxed);
+        }
+    }
+public:
+    const class LatencyHistogram& Stage(PipelineStage stage) const
+    {
+        return stages_[int(stage)];
+    }
+    uint64_t Counter(PipelineCounter counter) const
+    {
+        return counters_[int(counter)].load(std::memory_order_relaxed);
+    }
+};
+
+
+//! times its scope into a stage of the global stats
+class StageTimer
+{
+public:
+    explicit StageTimer(PipelineStage stage)
+    :stage_(stage), start_(std::chrono::steady_clock::now())
+    {
+    }
+    ~StageTimer()
+    {
+        PipelineStats::Global().Add(stage_, std::chrono::steady_clock::now() - start_);
+    }
+private:
+    const PipelineStage stage_;
+    const std::chrono::steady_clock::time_point start_;
+};
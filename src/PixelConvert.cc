@@ -0,0 +1,284 @@
+#include "PixelConvert.h"
+
+#include <algorithm>
+
+#include "simd.h"
+
+
+static void
+BGRAToRGBA8_Scalar
+(
+    const uint8_t* const bgra, PixelRGBA8* const rgba, int count
+)
+{
+    for(int idx = 0; idx < count; ++idx)
+    {
+        auto cursor = bgra + idx*4;
+        rgba[idx] = PixelRGBA8{cursor[2], cursor[1], cursor[0], 0xFF};
+    }
+}
+
+
+#ifdef SIMD_X86
+
+//! no pshufb before SSSE3, so B and R swap places through shifts and masks
+//! on the 0xXXRRGGBB lanes, giving 0xFFBBGGRR
+KERNEL_TARGET("sse2") static void
+BGRAToRGBA8_SSE2
+(
+    const uint8_t* const bgra, PixelRGBA8* const rgba, int count
+)
+{
+    const __m128i green_mask = _mm_set1_epi32(0x0000FF00);
+    const __m128i low_mask   = _mm_set1_epi32(0x000000FF);
+    const __m128i alpha      = _mm_set1_epi32(int(0xFF000000));
+
+    int idx = 0;
+    for(; idx + 4 <= count; idx += 4)
+    {
+        const __m128i pixels = _mm_loadu_si128((const __m128i*)(bgra + idx*4));
+        const __m128i green  = _mm_and_si128(pixels, green_mask);
+        const __m128i red    = _mm_and_si128(_mm_srli_epi32(pixels, 16), low_mask);
+        const __m128i blue   = _mm_slli_epi32(_mm_and_si128(pixels, low_mask), 16);
+        const __m128i result = _mm_or_si128(_mm_or_si128(green, red), \
+                                            _mm_or_si128(blue, alpha));
+        _mm_storeu_si128((__m128i*)(rgba + idx), result);
+    }
+
+    BGRAToRGBA8_Scalar(bgra + idx*4, rgba + idx, count - idx);
+}
+
+
+KERNEL_TARGET("avx2") static void
+BGRAToRGBA8_AVX2
+(
+    const uint8_t* const bgra, PixelRGBA8* const rgba, int count
+)
+{
+    const __m256i swap_red_blue = _mm256_setr_epi8(
+        2, 1, 0, 3,  6, 5, 4, 7,  10, 9, 8, 11,  14, 13, 12, 15,
+        2, 1, 0, 3,  6, 5, 4, 7,  10, 9, 8, 11,  14, 13, 12, 15);
+    const __m256i alpha = _mm256_set1_epi32(int(0xFF000000));
+
+    int idx = 0;
+    for(; idx + 16 <= count; idx += 16)
+    {
+        const __m256i pixels_0 = _mm256_loadu_si256((const __m256i*)(bgra + idx*4));
+        const __m256i pixels_1 = _mm256_loadu_si256((const __m256i*)(bgra + idx*4 + 32));
+        _mm256_storeu_si256((__m256i*)(rgba + idx), _mm256_or_si256( \
+                            _mm256_shuffle_epi8(pixels_0, swap_red_blue), alpha));
+        _mm256_storeu_si256((__m256i*)(rgba + idx + 8), _mm256_or_si256( \
+                            _mm256_shuffle_epi8(pixels_1, swap_red_blue), alpha));
+    }
+    for(; idx + 8 <= count; idx += 8)
+    {
+        const __m256i pixels = _mm256_loadu_si256((const __m256i*)(bgra + idx*4));
+        _mm256_storeu_si256((__m256i*)(rgba + idx), _mm256_or_si256( \
+                            _mm256_shuffle_epi8(pixels, swap_red_blue), alpha));
+    }
+
+    BGRAToRGBA8_Scalar(bgra + idx*4, rgba + idx, count - idx);
+}
+
+
+//! AVX-512F only (no BW), so the shift and mask form again
+KERNEL_TARGET("avx512f") static inline __m512i
+SwapRedBlue_AVX512(__m512i pixels)
+{
+    const __m512i green_mask = _mm512_set1_epi32(0x0000FF00);
+    const __m512i low_mask   = _mm512_set1_epi32(0x000000FF);
+    const __m512i alpha      = _mm512_set1_epi32(int(0xFF000000));
+
+    //! the zero masked shifts, GCC 12 warns about the undefined source of
+    //! the plain ones under -Wall
+    const __m512i green = _mm512_and_si512(pixels, green_mask);
+    const __m512i red   = _mm512_and_si512( \
+                            _mm512_maskz_srli_epi32(0xFFFF, pixels, 16), low_mask);
+    const __m512i blue  = _mm512_maskz_slli_epi32(0xFFFF, \
+                            _mm512_and_si512(pixels, low_mask), 16);
+    return _mm512_or_si512(_mm512_or_si512(green, red), \
+                           _mm512_or_si512(blue, alpha));
+}
+
+
+//! the tail goes through a masked load and store instead of the scalar loop
+KERNEL_TARGET("avx512f") static void
+BGRAToRGBA8_AVX512
+(
+    const uint8_t* const bgra, PixelRGBA8* const rgba, int count
+)
+{
+    int idx = 0;
+    for(; idx + 16 <= count; idx += 16)
+    {
+        const __m512i pixels = _mm512_loadu_si512((const void*)(bgra + idx*4));
+        _mm512_storeu_si512((void*)(rgba + idx), SwapRedBlue_AVX512(pixels));
+    }
+
+    if( idx < count )
+    {
+        const __mmask16 tail = __mmask16((1u << (count - idx)) - 1);
+        const __m512i pixels = _mm512_maskz_loadu_epi32(tail, bgra + idx*4);
+        _mm512_mask_storeu_epi32(rgba + idx, tail, SwapRedBlue_AVX512(pixels));
+    }
+}
+
+#endif // SIMD_X86
+
+
+ConvertKernelLevel
+DetectConvertKernelLevel()
+{
+#if defined(SIMD_X86) && defined(_MSC_VER)
+    int info[4] = {};
+    ::__cpuid(info, 0);
+    const int max_leaf = info[0];
+
+    ::__cpuidex(info, 1, 0);
+    const bool sse2    = (info[3] & (1 << 26)) != 0;
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    const bool avx     = (info[2] & (1 << 28)) != 0;
+
+    const auto xcr0 = (osxsave && avx) ? ::_xgetbv(0) : 0;
+    const bool ymm_enabled = (xcr0 & 0x06) == 0x06;
+    const bool zmm_enabled = (xcr0 & 0xE6) == 0xE6;
+
+    bool avx2 = false, avx512f = false;
+    if( max_leaf >= 7 )
+    {
+        ::__cpuidex(info, 7, 0);
+        avx2    = (info[1] & (1 << 5)) != 0;
+        avx512f = (info[1] & (1 << 16)) != 0;
+    }
+
+    if( avx512f && zmm_enabled ) { return ConvertKernelLevel::AVX512; }
+    if( avx2 && ymm_enabled )    { return ConvertKernelLevel::AVX2; }
+    if( sse2 )                   { return ConvertKernelLevel::SSE2; }
+#elif defined(SIMD_X86)
+    __builtin_cpu_init();
+    if( __builtin_cpu_supports("avx512f") ) { return ConvertKernelLevel::AVX512; }
+    if( __builtin_cpu_supports("avx2") )    { return ConvertKernelLevel::AVX2; }
+    if( __builtin_cpu_supports("sse2") )    { return ConvertKernelLevel::SSE2; }
+#endif
+    return ConvertKernelLevel::SCALAR;
+}
+
+
+const char*
+ConvertKernelLevelName
+(
+    ConvertKernelLevel level
+)
+{
+    switch(level)
+    {
+        case ConvertKernelLevel::SSE2:   return "sse2";
+        case ConvertKernelLevel::AVX2:   return "avx2";
+        case ConvertKernelLevel::AVX512: return "avx512";
+        default:                         return "scalar";
+    }
+}
+
+
+ConvertRowKernel
+BGRAToRGBA8RowKernel
+(
+    ConvertKernelLevel level
+)
+{
+    switch(level)
+    {
+#ifdef SIMD_X86
+        case ConvertKernelLevel::SSE2:   return BGRAToRGBA8_SSE2;
+        case ConvertKernelLevel::AVX2:   return BGRAToRGBA8_AVX2;
+        case ConvertKernelLevel::AVX512: return BGRAToRGBA8_AVX512;
+#endif
+        case ConvertKernelLevel::SCALAR: return BGRAToRGBA8_Scalar;
+        default:                         return nullptr;
+    }
+}
+
+
+//! the on-screen part of one row, any format, any captured layout
+template <typename PixelT>
+static void
+ConvertRowSpan
+(
+    const struct CapturedFrame& frame,
+    const uint8_t* const src, PixelT* const dst, int count
+)
+{
+    for(int idx = 0; idx < count; ++idx)
+    {
+        auto cursor = src + idx*frame.bytes_per_pixel;
+        dst[idx] = PixelT::FromRGB8(cursor[frame.red_offset], \
+                                    cursor[frame.green_offset], \
+                                    cursor[frame.blue_offset]);
+    }
+}
+
+
+static void
+ConvertRowSpan
+(
+    const struct CapturedFrame& frame,
+    const uint8_t* const src, PixelRGBA8* const dst, int count
+)
+{
+    static const auto row_kernel = \
+                        BGRAToRGBA8RowKernel(DetectConvertKernelLevel());
+
+    if( frame.bytes_per_pixel == 4 && frame.blue_offset == 0 && \
+        frame.green_offset == 1 && frame.red_offset == 2 )
+    {
+        row_kernel(src, dst, count);
+        return;
+    }
+
+    ConvertRowSpan<PixelRGBA8>(frame, src, dst, count);
+}
+
+
+template <typename PixelT>
+void
+ConvertCapturedFrame
+(
+    const struct CapturedFrame& frame,
+    int bound_left, int bound_top,
+    int bound_width, int bound_height,
+    PixelT* const dst, int dst_stride
+)
+{
+    //! columns [span_begin, span_end) of the bound are on the screen
+    const int span_begin = std::min(bound_width, std::max(0, -bound_left));
+    const int span_end   = std::max(span_begin, \
+                    std::min(bound_width, frame.screen_width - bound_left));
+
+    for(int y = 0; y < bound_height; ++y)
+    {
+        const int screen_y = bound_top + y;
+        auto dst_row = dst + y*dst_stride;
+
+        if( screen_y < 0 || screen_y >= frame.screen_height )
+        {
+            std::fill(dst_row, dst_row + bound_width, PixelT{});
+            continue;
+        }
+
+        std::fill(dst_row, dst_row + span_begin, PixelT{});
+        std::fill(dst_row + span_end, dst_row + bound_width, PixelT{});
+
+        auto src_row = frame.data + (screen_y - frame.top)*frame.stride + \
+                (bound_left + span_begin - frame.left)*frame.bytes_per_pixel;
+        ConvertRowSpan(frame, src_row, dst_row + span_begin, \
+                                                    span_end - span_begin);
+    }
+}
+
+
+template void ConvertCapturedFrame<PixelRGBA8>(
+    const struct CapturedFrame&, int, int, int, int, PixelRGBA8* const, int);
+template void ConvertCapturedFrame<PixelRGB10A2>(
+    const struct CapturedFrame&, int, int, int, int, PixelRGB10A2* const, int);
+template void ConvertCapturedFrame<PixelRGBA16F>(
+    const struct CapturedFrame&, int, int, int, int, PixelRGBA16F* const, int);
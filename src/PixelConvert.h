@@ -0,0 +1,45 @@
+#pragma once
+
+#include "pixel.h"
+
+
+//! bound_width*bound_height pixels whose top left corner sits at
+//! (bound_left, bound_top) on the screen, from the captured rows into the
+//! pipeline format, dst rows are dst_stride pixels apart
+template <typename PixelT>
+void
+ConvertCapturedFrame
+(
+    const struct CapturedFrame& frame,
+    int bound_left, int bound_top,
+    int bound_width, int bound_height,
+    PixelT* const dst, int dst_stride
+);
+
+
+/*
+ * Row kernels for the common case, 32 bits BGRX captures (X11 SHM, the
+ * Magnification API, raw synthetic frames) into RGBA8. ConvertCapturedFrame
+ * picks the widest one the CPU runs, detected once through cpuid.
+ */
+
+enum class ConvertKernelLevel
+{
+    SCALAR,
+    SSE2,
+    AVX2,
+    AVX512,
+};
+
+typedef void (*ConvertRowKernel)
+(
+    const uint8_t* const bgra, PixelRGBA8* const rgba, int count
+);
+
+ConvertKernelLevel DetectConvertKernelLevel();
+
+const char* ConvertKernelLevelName(ConvertKernelLevel level);
+
+//! nullptr when the level is not built for this architecture, the CPU
+//! support is the caller's business
+ConvertRowKernel BGRAToRGBA8RowKernel(ConvertKernelLevel level);
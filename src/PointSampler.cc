@@ -0,0 +1,418 @@
+#include "PointSampler.h"
+
+#include <chrono>
+#include <cstdio>
+#include <utility>
+#include <algorithm>
+
+#include "simd.h"
+#include "PipelineStats.h"
+
+
+static void
+Gather_Scalar
+(
+    const uint8_t* const base, const int32_t* const offsets,
+    uint32_t* const packed, int count
+)
+{
+    for(int idx = 0; idx < count; ++idx)
+    {
+        auto cursor = base + offsets[idx];
+        packed[idx] = uint32_t(cursor[0]) | uint32_t(cursor[1]) << 8 | \
+                      uint32_t(cursor[2]) << 16 | uint32_t(cursor[3]) << 24;
+    }
+}
+
+
+#ifdef SIMD_X86
+
+KERNEL_TARGET("avx2") static void
+Gather_AVX2
+(
+    const uint8_t* const base, const int32_t* const offsets,
+    uint32_t* const packed, int count
+)
+{
+    int idx = 0;
+    for(; idx + 8 <= count; idx += 8)
+    {
+        const __m256i offset = _mm256_loadu_si256((const __m256i*)(offsets + idx));
+        const __m256i pixels = _mm256_i32gather_epi32((const int*)base, offset, 1);
+        _mm256_storeu_si256((__m256i*)(packed + idx), pixels);
+    }
+
+    Gather_Scalar(base, offsets + idx, packed + idx, count - idx);
+}
+
+#endif
+
+
+PointSampler::GatherKernel
+PointSampler::GatherKernelOf
+(
+    ConvertKernelLevel level
+)
+{
+#ifdef SIMD_X86
+    if( level == ConvertKernelLevel::AVX2 || level == ConvertKernelLevel::AVX512 )
+    {
+        return Gather_AVX2;
+    }
+#endif
+    return Gather_Scalar;
+}
+
+
+PointSampler::PointSampler
+(
+    class FrameSource* frame_source,
+    int merge_area
+)
+:frame_source_(frame_source), merge_area_(std::max(0, merge_area))
+{
+    SetKernelLevel(DetectConvertKernelLevel());
+}
+
+
+PointSampler::~PointSampler()
+{
+}
+
+
+void
+PointSampler::SetKernelLevel
+(
+    ConvertKernelLevel level
+)
+{
+    gather_kernel_ = GatherKernelOf(level);
+    convert_kernel_ = BGRAToRGBA8RowKernel(level);
+}
+
+
+int
+PointSampler::rootOf
+(
+    int rect
+)
+{
+    while( rect_parents_[rect] != rect )
+    {
+        rect_parents_[rect] = rect_parents_[rect_parents_[rect]];
+        rect = rect_parents_[rect];
+    }
+    return rect;
+}
+
+
+//! the pixels capturing a and b as one rect takes on top of both
+static int64_t
+AddedArea(const struct PointSampler::CaptureRect& a, const struct PointSampler::CaptureRect& b)
+{
+    struct PointSampler::CaptureRect both;
+    both.left = std::min(a.left, b.left);
+    both.top = std::min(a.top, b.top);
+    both.right = std::max(a.right, b.right);
+    both.bottom = std::max(a.bottom, b.bottom);
+    return both.Area() - a.Area() - b.Area();
+}
+
+
+void
+PointSampler::joinRects
+(
+    int first, int second
+)
+{
+    first = rootOf(first);
+    second = rootOf(second);
+    if( first == second )
+    {
+        return;
+    }
+    auto& joined = rects_[first];
+    const auto& rect = rects_[second];
+    joined.left = std::min(joined.left, rect.left);
+    joined.top = std::min(joined.top, rect.top);
+    joined.right = std::max(joined.right, rect.right);
+    joined.bottom = std::max(joined.bottom, rect.bottom);
+    rect_parents_[second] = first;
+}
+
+
+void
+PointSampler::planRects
+(
+    const struct SamplePoint* const points, int count
+)
+{
+    rects_.clear();
+
+    const int screen_width = frame_source_->ScreenWidth();
+    const int screen_height = frame_source_->ScreenHeight();
+    const int tiles_x = (screen_width + POINT_CLUSTER_TILE - 1)/POINT_CLUSTER_TILE;
+    const int tiles_y = (screen_height + POINT_CLUSTER_TILE - 1)/POINT_CLUSTER_TILE;
+
+    //! one rect per tile holding points, their bounding box
+    tile_rects_.assign(size_t(tiles_x)*tiles_y, -1);
+    point_rects_.resize(count);
+    for(int idx = 0; idx < count; ++idx)
+    {
+        const auto& point = points[idx];
+        if( point.x < 0 || point.y < 0 || \
+            point.x >= screen_width || point.y >= screen_height )
+        {
+            point_rects_[idx] = -1;
+            continue;
+        }
+        const int tile = (point.y/POINT_CLUSTER_TILE)*tiles_x + point.x/POINT_CLUSTER_TILE;
+        if( tile_rects_[tile] < 0 )
+        {
+            tile_rects_[tile] = int(rects_.size());
+            struct CaptureRect rect;
+            rect.left = point.x;
+            rect.top = point.y;
+            rect.right = point.x + 1;
+            rect.bottom = point.y + 1;
+            rects_.push_back(rect);
+        }
+        auto& rect = rects_[tile_rects_[tile]];
+        rect.left = std::min(rect.left, point.x);
+        rect.top = std::min(rect.top, point.y);
+        rect.right = std::max(rect.right, point.x + 1);
+        rect.bottom = std::max(rect.bottom, point.y + 1);
+        point_rects_[idx] = tile_rects_[tile];
+    }
+
+    rect_parents_.resize(rects_.size());
+    for(size_t idx = 0; idx < rects_.size(); ++idx)
+    {
+        rect_parents_[idx] = int(idx);
+    }
+
+    //! join touching tiles up front on the tile grid, the pairwise pass
+    //! below only sees what is left; a chain of them grows its rect with
+    //! every join, so each one is held to merge_area_ as a pair would be
+    for(int tile_y = 0; tile_y < tiles_y; ++tile_y)
+    {
+        for(int tile_x = 0; tile_x < tiles_x; ++tile_x)
+        {
+            const int rect = tile_rects_[tile_y*tiles_x + tile_x];
+            if( rect < 0 )
+            {
+                continue;
+            }
+            //! the neighbours after this tile in row order
+            const int neighbours[4][2] = {
+                {tile_x + 1, tile_y},
+                {tile_x - 1, tile_y + 1}, {tile_x, tile_y + 1}, {tile_x + 1, tile_y + 1}
+            };
+            for(const auto& neighbour : neighbours)
+            {
+                if( neighbour[0] < 0 || neighbour[0] >= tiles_x || neighbour[1] >= tiles_y )
+                {
+                    continue;
+                }
+                const int other = tile_rects_[neighbour[1]*tiles_x + neighbour[0]];
+                if( other >= 0 && \
+                    AddedArea(rects_[rootOf(rect)], rects_[rootOf(other)]) <= merge_area_ )
+                {
+                    joinRects(rect, other);
+                }
+            }
+        }
+    }
+
+    //! merge until no pair is worth it, every merge takes one capture off
+    std::vector<int> live_rects;
+    for(size_t idx = 0; idx < rects_.size(); ++idx)
+    {
+        if( rootOf(int(idx)) == int(idx) )
+        {
+            live_rects.push_back(int(idx));
+        }
+    }
+    for(bool merged = true; merged; )
+    {
+        merged = false;
+        for(size_t first = 0; first < live_rects.size(); ++first)
+        {
+            for(size_t second = first + 1; second < live_rects.size(); )
+            {
+                if( AddedArea(rects_[live_rects[first]], \
+                              rects_[live_rects[second]]) > merge_area_ )
+                {
+                    ++second;
+                    continue;
+                }
+
+                joinRects(live_rects[first], live_rects[second]);
+                live_rects[second] = live_rects.back();
+                live_rects.pop_back();
+                merged = true;
+            }
+        }
+    }
+
+    //! the live rects in order, their points grouped by a counting sort
+    std::vector<struct CaptureRect> planned_rects(live_rects.size());
+    std::vector<int> planned_of(rects_.size(), -1);
+    for(size_t idx = 0; idx < live_rects.size(); ++idx)
+    {
+        planned_rects[idx] = rects_[live_rects[idx]];
+        planned_rects[idx].count = 0;
+        planned_of[live_rects[idx]] = int(idx);
+    }
+    for(int idx = 0; idx < count; ++idx)
+    {
+        if( point_rects_[idx] >= 0 )
+        {
+            point_rects_[idx] = planned_of[rootOf(point_rects_[idx])];
+            planned_rects[point_rects_[idx]].count += 1;
+        }
+    }
+    int first = 0;
+    for(auto& rect : planned_rects)
+    {
+        rect.first = first;
+        first += rect.count;
+        rect.count = 0;
+    }
+    point_order_.resize(first);
+    for(int idx = 0; idx < count; ++idx)
+    {
+        if( point_rects_[idx] >= 0 )
+        {
+            auto& rect = planned_rects[point_rects_[idx]];
+            point_order_[rect.first + rect.count] = idx;
+            rect.count += 1;
+        }
+    }
+    rects_ = std::move(planned_rects);
+}
+
+
+bool
+PointSampler::sampleRect
+(
+    const struct CaptureRect& rect,
+    const struct SamplePoint* const points,
+    uint32_t* const colors
+)
+{
+    const int width = rect.right - rect.left;
+    const int height = rect.bottom - rect.top;
+
+    struct CapturedFrame frame;
+    {
+        class StageTimer timer(PipelineStage::CAPTURE);
+        if( false == frame_source_->CaptureWithinBound(rect.left + width/2, \
+                                        rect.top + height/2, width, height, &frame) )
+        {
+            fprintf(stderr, "%s Error 0\n", __PRETTY_FUNCTION__);
+            return false;
+        }
+    }
+
+    const auto convert_start = std::chrono::steady_clock::now();
+
+    const int count = rect.count;
+    const int* const order = point_order_.data() + rect.first;
+    offsets_.resize(count);
+    converted_.resize(count);
+    for(int idx = 0; idx < count; ++idx)
+    {
+        const auto& point = points[order[idx]];
+        offsets_[idx] = (point.y - frame.top)*frame.stride + \
+                        (point.x - frame.left)*frame.bytes_per_pixel;
+    }
+
+    if( frame.bytes_per_pixel == 4 && frame.blue_offset == 0 && \
+        frame.green_offset == 1 && frame.red_offset == 2 )
+    {
+        gathered_.resize(count);
+        gather_kernel_(frame.data, offsets_.data(), gathered_.data(), count);
+        convert_kernel_((const uint8_t*)gathered_.data(), converted_.data(), count);
+    }
+    else
+    {
+        for(int idx = 0; idx < count; ++idx)
+        {
+            auto cursor = frame.data + offsets_[idx];
+            converted_[idx] = PixelRGBA8::FromRGB8(cursor[frame.red_offset], \
+                                                   cursor[frame.green_offset], \
+                                                   cursor[frame.blue_offset]);
+        }
+    }
+
+    PipelineStats::Global().Add(PipelineStage::CONVERT, \
+                                std::chrono::steady_clock::now() - convert_start);
+
+    auto color_transform = frame_source_->CurrentColorTransform();
+    if( color_transform != nullptr )
+    {
+        class StageTimer timer(PipelineStage::COLOR);
+        color_transform->TransformRow(converted_.data(), count);
+    }
+
+    for(int idx = 0; idx < count; ++idx)
+    {
+        colors[order[idx]] = converted_[idx].Packed();
+    }
+    return true;
+}
+
+
+bool
+PointSampler::Sample
+(
+    const struct SamplePoint* const points, int count,
+    uint32_t* const colors
+)
+{
+    std::fill(colors, colors + count, 0u);
+    planRects(points, count);
+
+    captured_area_ = 0;
+    for(const auto& rect : rects_)
+    {
+        if( false == sampleRect(rect, points, colors) )
+        {
+            fprintf(stderr, "%s Error 0\n", __PRETTY_FUNCTION__);
+            return false;
+        }
+        captured_area_ += rect.Area();
+    }
+    return true;
+}
+
+
+bool
+PointSampler::SampleRegion
+(
+    int left, int top, int width, int height,
+    uint32_t* const colors
+)
+{
+    if( width <= 0 || height <= 0 )
+    {
+        return true;
+    }
+
+    //! PixelRGBA8 is 4 bytes, converted in place then packed
+    auto pixels = reinterpret_cast<PixelRGBA8*>(colors);
+    if( false == frame_source_->RefreshScreenPixelDataWithinBound( \
+                        left + width/2, top + height/2, width, height, pixels) )
+    {
+        fprintf(stderr, "%s Error 0\n", __PRETTY_FUNCTION__);
+        return false;
+    }
+
+    const size_t count = size_t(width)*height;
+    for(size_t idx = 0; idx < count; ++idx)
+    {
+        colors[idx] = pixels[idx].Packed();
+    }
+    return true;
+}
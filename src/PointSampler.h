@@ -0,0 +1,105 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+#include "pixel.h"
+#include "FrameSource.h"
+#include "PixelConvert.h"
+#include "parameters.h"
+
+
+struct SamplePoint
+{
+    int x = 0, y = 0;
+};
+
+
+/*
+ * The colours of many points of one frame source at once, for pickMany():
+ * a capture per point would pay one round trip to the server each, so the
+ * points are planned into a few capture rects first:
+ *
+ *   - the points are bucketed in POINT_CLUSTER_TILE tiles, each bucket
+ *     starts as the bounding box of its points
+ *   - two boxes are merged as long as the merged one covers at most
+ *     merge_area more pixels than both (overlapping ones always are)
+ *
+ * Each rect is then captured once and its points gathered from it by
+ * byte offset, 8 at a time with AVX2 gathers, converted by the row kernels
+ * of PixelConvert and the colour transform of the source, and packed
+ * 0xRRGGBBAA like the compact updates. A whole region, for sample(), is
+ * one capture converted in place.
+ */
+class PointSampler
+{
+public:
+    PointSampler(class FrameSource* frame_source, int merge_area = POINT_MERGE_AREA);
+    ~PointSampler();
+public:
+    //! packed[idx] = the 4 bytes at base + offsets[idx], idx < count
+    typedef void (*GatherKernel)(
+        const uint8_t* const base, const int32_t* const offsets,
+        uint32_t* const packed, int count
+    );
+    static GatherKernel GatherKernelOf(ConvertKernelLevel level);
+public:
+    struct CaptureRect
+    {
+        //! [left, right) x [top, bottom), on the screen
+        int left = 0, top = 0, right = 0, bottom = 0;
+        //! its points, PointOrder()[first, first + count)
+        int first = 0, count = 0;
+    public:
+        int64_t Area() const { return int64_t(right - left)*(bottom - top); }
+    };
+private:
+    class FrameSource* const frame_source_;
+    const int merge_area_;
+    GatherKernel gather_kernel_ = nullptr;
+    ConvertRowKernel convert_kernel_ = nullptr;
+private:
+    std::vector<struct CaptureRect> rects_;
+    //! indices into the points of Sample(), grouped by rect
+    std::vector<int> point_order_;
+    //! planning: the rect of every tile and of every point (-1 for none),
+    //! the rects joined so far as a union find
+    std::vector<int> tile_rects_;
+    std::vector<int> point_rects_;
+    std::vector<int> rect_parents_;
+    std::vector<int32_t> offsets_;
+    std::vector<uint32_t> gathered_;
+    std::vector<PixelRGBA8> converted_;
+    int64_t captured_area_ = 0;
+private:
+    int rootOf(int rect);
+    //! second into first, the bounding box of both
+    void joinRects(int first, int second);
+    void planRects(const struct SamplePoint* const points, int count);
+    bool sampleRect(
+        const struct CaptureRect& rect,
+        const struct SamplePoint* const points,
+        uint32_t* const colors
+    );
+public:
+    //! colors[idx], 0xRRGGBBAA, of points[idx]; 0 (transparent) for the
+    //! points outside of the screen, false when a capture failed
+    bool Sample(
+        const struct SamplePoint* const points, int count,
+        uint32_t* const colors
+    );
+    //! colors[y*width + x], 0xRRGGBBAA, of the width*height region at
+    //! (left, top), one capture; 0 for the pixels outside of the screen
+    bool SampleRegion(
+        int left, int top, int width, int height,
+        uint32_t* const colors
+    );
+    //! forces a kernel level, for the benchmark, the CPU support is the
+    //! caller's business
+    void SetKernelLevel(ConvertKernelLevel level);
+public:
+    //! the plan of the last Sample()
+    const std::vector<struct CaptureRect>& Rects() const { return rects_; }
+    const std::vector<int>& PointOrder() const { return point_order_; }
+    int64_t CapturedArea() const { return captured_area_; }
+};
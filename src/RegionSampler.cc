@@ -0,0 +1,238 @@
+#include "RegionSampler.h"
+
+#include <cmath>
+#include <algorithm>
+
+
+static const int LINEAR_MAX = 0xFFFF;
+//! float channels are decoded through this many steps, interpolated
+static const int DECODING_TABLE_SIZE = 4096;
+
+
+static double
+DecodeSRGB(double encoded)
+{
+    return encoded <= 0.04045 ? encoded/12.92 : \
+                                std::pow((encoded + 0.055)/1.055, 2.4);
+}
+
+
+static double
+EncodeSRGB(double linear)
+{
+    return linear <= 0.0031308 ? linear*12.92 : \
+                                 1.055*std::pow(linear, 1/2.4) - 0.055;
+}
+
+
+static const uint16_t*
+LinearTable8()
+{
+    static const auto table = []()
+    {
+        static uint16_t values[256];
+        for(int value = 0; value < 256; ++value)
+        {
+            values[value] = uint16_t(DecodeSRGB(value/255.0)*LINEAR_MAX + 0.5);
+        }
+        return values;
+    }();
+    return table;
+}
+
+
+static const float*
+LinearTableFloat()
+{
+    static const auto table = []()
+    {
+        static float values[DECODING_TABLE_SIZE + 1];
+        for(int idx = 0; idx <= DECODING_TABLE_SIZE; ++idx)
+        {
+            values[idx] = float(DecodeSRGB(double(idx)/DECODING_TABLE_SIZE)*LINEAR_MAX);
+        }
+        return values;
+    }();
+    return table;
+}
+
+
+//! r, g, b of one pixel in 16 bits linear light
+template <typename PixelT>
+static void
+ToLinear(const PixelT& pixel, uint32_t* const linear)
+{
+    auto table = LinearTableFloat();
+
+    float rgba[4];
+    pixel.ToFloat(rgba);
+    for(int channel = 0; channel < 3; ++channel)
+    {
+        const float value = std::min(1.0f, std::max(0.0f, rgba[channel])) \
+                                                        *DECODING_TABLE_SIZE;
+        const int idx = std::min(int(value), DECODING_TABLE_SIZE - 1);
+        const float weight = value - idx;
+        linear[channel] = uint32_t(table[idx]*(1 - weight) + \
+                                   table[idx + 1]*weight + 0.5f);
+    }
+}
+
+
+static void
+ToLinear(const PixelRGBA8& pixel, uint32_t* const linear)
+{
+    auto table = LinearTable8();
+    linear[0] = table[pixel.r];
+    linear[1] = table[pixel.g];
+    linear[2] = table[pixel.b];
+}
+
+
+template <typename PixelT>
+RegionSampler<PixelT>::RegionSampler()
+{
+}
+
+
+template <typename PixelT>
+RegionSampler<PixelT>::~RegionSampler()
+{
+    delete[] summed_area_table_;
+}
+
+
+template <typename PixelT>
+bool
+RegionSampler<PixelT>::Build
+(
+    const struct ScreenPixelView<PixelT>& view
+)
+{
+    if( view.width > MAX_SIDE || view.height > MAX_SIDE )
+    {
+        return false;
+    }
+
+    const int table_width = view.width + 1;
+    const int cell_count = table_width*(view.height + 1)*3;
+    if( cell_count > summed_area_table_capacity_ )
+    {
+        delete[] summed_area_table_;
+        summed_area_table_ = new uint32_t[cell_count];
+        summed_area_table_capacity_ = cell_count;
+    }
+    view_ = view;
+
+    std::fill(summed_area_table_, summed_area_table_ + table_width*3, 0u);
+
+    for(int y = 0; y < view.height; ++y)
+    {
+        const uint32_t* above = summed_area_table_ + (y*table_width)*3;
+        uint32_t* cell = summed_area_table_ + ((y + 1)*table_width)*3;
+
+        uint32_t row_sum[3] = {0, 0, 0};
+        cell[0] = cell[1] = cell[2] = 0;
+        for(int x = 0; x < view.width; ++x)
+        {
+            uint32_t linear[3];
+            ToLinear(view.At(x, y), linear);
+
+            above += 3;
+            cell += 3;
+            for(int channel = 0; channel < 3; ++channel)
+            {
+                row_sum[channel] += linear[channel];
+                cell[channel] = above[channel] + row_sum[channel];
+            }
+        }
+    }
+
+    return true;
+}
+
+
+template <typename PixelT>
+PixelT
+RegionSampler<PixelT>::Mean
+(
+    int box_left, int box_top, int box_width, int box_height
+) const
+{
+    //! [left, right) x [top, bottom)
+    const int left   = std::max(0, box_left);
+    const int top    = std::max(0, box_top);
+    const int right  = std::min(view_.width, box_left + box_width);
+    const int bottom = std::min(view_.height, box_top + box_height);
+    if( left >= right || top >= bottom )
+    {
+        return PixelT{};
+    }
+
+    const int table_width = view_.width + 1;
+    auto cell = [&](int cell_x, int cell_y)
+    {
+        return summed_area_table_ + (cell_y*table_width + cell_x)*3;
+    };
+    const uint32_t* top_left     = cell(left, top);
+    const uint32_t* top_right    = cell(right, top);
+    const uint32_t* bottom_left  = cell(left, bottom);
+    const uint32_t* bottom_right = cell(right, bottom);
+
+    const double area = double(right - left)*(bottom - top);
+    float rgba[4] = {0, 0, 0, 1};
+    for(int channel = 0; channel < 3; ++channel)
+    {
+        const uint32_t sum = bottom_right[channel] - bottom_left[channel] - \
+                             top_right[channel] + top_left[channel];
+        rgba[channel] = float(EncodeSRGB(sum/area/LINEAR_MAX));
+    }
+    return PixelT::FromFloat(rgba);
+}
+
+
+template <typename PixelT>
+PixelT
+RegionSampler<PixelT>::Median
+(
+    int box_left, int box_top, int box_width, int box_height
+) const
+{
+    const int left   = std::max(0, box_left);
+    const int top    = std::max(0, box_top);
+    const int right  = std::min(view_.width, box_left + box_width);
+    const int bottom = std::min(view_.height, box_top + box_height);
+    if( left >= right || top >= bottom )
+    {
+        return PixelT{};
+    }
+
+    //! 8 bits bins, the tone curve is monotonic so the median is the same
+    //! in linear or encoded values
+    uint32_t histogram[3][256] = {};
+    for(int row = top; row < bottom; ++row)
+    {
+        for(int column = left; column < right; ++column)
+        {
+            const auto& pixel = view_.At(column, row);
+            histogram[0][pixel.R8()] += 1;
+            histogram[1][pixel.G8()] += 1;
+            histogram[2][pixel.B8()] += 1;
+        }
+    }
+
+    const uint32_t half = uint32_t((right - left)*(bottom - top) + 1)/2;
+    uint8_t median[3] = {};
+    for(int channel = 0; channel < 3; ++channel)
+    {
+        uint32_t count = 0;
+        int value = 0;
+        while( (count += histogram[channel][value]) < half ) { ++value; }
+        median[channel] = uint8_t(value);
+    }
+    return PixelT::FromRGB8(median[0], median[1], median[2]);
+}
+
+
+template class RegionSampler<PixelRGBA8>;
+template class RegionSampler<PixelRGB10A2>;
+template class RegionSampler<PixelRGBA16F>;
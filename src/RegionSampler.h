@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+
+#include "pixel.h"
+
+
+//! how the colour of a size*size sample is reduced to one
+enum class SampleMode
+{
+    MEAN,       // box average in linear light
+    MEDIAN,     // per channel, through a histogram
+};
+
+
+//! Box samples of a captured view, the way image editor eyedroppers
+//! average 3x3 to 101x101 pixels. Build() makes a summed area table of the
+//! linear light (sRGB tone curve) values once per captured frame, then any
+//! box mean is four lookups per channel whatever its size.
+template <typename PixelT>
+class RegionSampler
+{
+public:
+    RegionSampler();
+    ~RegionSampler();
+public:
+    //! 16 bits linear values summed over MAX_SIDE*MAX_SIDE still fit in
+    //! the 32 bits cells
+    static const int MAX_SIDE = 255;
+private:
+    struct ScreenPixelView<PixelT> view_;
+    //! (width + 1)*(height + 1) cells of r, g, b sums, row and column 0 are
+    //! zero so a box never needs a bounds check
+    uint32_t* summed_area_table_ = nullptr;
+    int summed_area_table_capacity_ = 0;
+public:
+    //! false when the view is larger than MAX_SIDE
+    bool Build(const struct ScreenPixelView<PixelT>& view);
+public:
+    //! the width*height box from (left, top) of the view, clipped to it,
+    //! black when nothing is left
+    PixelT Mean(int left, int top, int width, int height) const;
+    PixelT Median(int left, int top, int width, int height) const;
+    PixelT Sample(int left, int top, int width, int height, SampleMode mode) const
+    {
+        return mode == SampleMode::MEDIAN ? Median(left, top, width, height) \
+                                          : Mean(left, top, width, height);
+    }
+};
@@ -0,0 +1,179 @@
+#include "SurfacePool.h"
+
+#include <cstdio>
+
+#include "parameters.h"
+#include "PipelineStats.h"
+
+
+SurfacePool::SurfacePool(int buffer_count) :
+    buffer_count_(buffer_count < MIN_BUFFER_COUNT ? int(MIN_BUFFER_COUNT) : \
+                  buffer_count > MAX_BUFFER_COUNT ? int(MAX_BUFFER_COUNT) : \
+                                                    buffer_count)
+{
+}
+
+
+void
+SurfacePool::releaseSurfaces()
+{
+    if( reserved_ == false )
+    {
+        return;
+    }
+
+    for(int idx = 0; idx < buffer_count_; ++idx)
+    {
+        releaseSurface(idx);
+        surfaces_[idx] = RenderSurface{};
+    }
+    reserved_ = false;
+}
+
+
+bool
+SurfacePool::Reserve
+(
+    int width, int height, int dpi
+)
+{
+    if( reserved_ && width == width_ && height == height_ && dpi == dpi_ )
+    {
+        return true;
+    }
+
+    releaseSurfaces();
+
+    for(int idx = 0; idx < buffer_count_; ++idx)
+    {
+        auto& surface = surfaces_[idx];
+        surface.width = width;
+        surface.height = height;
+        if( false == allocateSurface(idx, width, height, dpi, &surface) )
+        {
+            fprintf(stderr, "%s Error 1 buffer %d\n", __PRETTY_FUNCTION__, idx);
+            //! release what was allocated so far, as a whole
+            for(int allocated = 0; allocated < idx; ++allocated)
+            {
+                releaseSurface(allocated);
+                surfaces_[allocated] = RenderSurface{};
+            }
+            surface = RenderSurface{};
+            return false;
+        }
+        surface.has_static_content = false;
+        allocation_count_ += 1;
+    }
+
+    width_ = width;
+    height_ = height;
+    dpi_ = dpi;
+    reserved_ = true;
+    back_buffer_ = 0;
+
+    return true;
+}
+
+
+struct RenderSurface*
+SurfacePool::Acquire()
+{
+    if( reserved_ == false )
+    {
+        return nullptr;
+    }
+
+    if( isSurfaceBusy(back_buffer_) )
+    {
+        wait_count_ += 1;
+        waitSurface(back_buffer_);
+    }
+
+    acquire_count_ += 1;
+    return &surfaces_[back_buffer_];
+}
+
+
+bool
+SurfacePool::Present
+(
+    int x, int y,
+    const struct RenderRect* const rects, int rect_count
+)
+{
+    if( reserved_ == false )
+    {
+        return false;
+    }
+
+    {
+        class StageTimer timer(PipelineStage::PRESENT);
+        if( false == presentSurface(back_buffer_, x, y, rects, rect_count) )
+        {
+            fprintf(stderr, "%s Error 1\n", __PRETTY_FUNCTION__);
+            return false;
+        }
+    }
+
+    present_count_ += 1;
+    back_buffer_ = (back_buffer_ + 1) % buffer_count_;
+    return true;
+}
+
+
+MemorySurfacePool::MemorySurfacePool(int buffer_count) :
+    SurfacePool(buffer_count)
+{
+    fprintf(stderr, "%s\n", __PRETTY_FUNCTION__);
+}
+
+
+MemorySurfacePool::~MemorySurfacePool()
+{
+    fprintf(stderr, "%s\n", __PRETTY_FUNCTION__);
+
+    releaseSurfaces();
+}
+
+
+bool
+MemorySurfacePool::allocateSurface
+(
+    int idx, int width, int height, int dpi,
+    struct RenderSurface* const surface
+)
+{
+    if( width <= 0 || height <= 0 )
+    {
+        return false;
+    }
+
+    buffers_[idx] = new uint32_t[size_t(width)*height]();
+    surface->pixels = buffers_[idx];
+    surface->stride = width;
+    return true;
+}
+
+
+void
+MemorySurfacePool::releaseSurface(int idx)
+{
+    if( front_surface_ == &surfaces_[idx] )
+    {
+        front_surface_ = nullptr;
+    }
+    delete[] buffers_[idx];
+    buffers_[idx] = nullptr;
+}
+
+
+bool
+MemorySurfacePool::presentSurface
+(
+    int idx, int x, int y,
+    const struct RenderRect* const rects, int rect_count
+)
+{
+    front_surface_ = &surfaces_[idx];
+    return true;
+}
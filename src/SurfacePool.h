@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstdint>
+
+
+//! One buffer the magnifier is drawn into, premultiplied 0xAARRGGBB rows
+//! (BGRA in memory) as the window systems take them
+struct RenderSurface
+{
+    uint32_t* pixels = nullptr;
+    int width = 0;
+    int height = 0;
+    //! in pixels
+    int stride = 0;
+    //! the parts of a frame which never change are already drawn; cleared
+    //! whenever the pool (re)allocates the buffer
+    bool has_static_content = false;
+};
+
+
+//! part of a surface, in pixels
+struct RenderRect
+{
+    int x = 0;
+    int y = 0;
+    int width = 0;
+    int height = 0;
+};
+
+
+//! Double or triple buffered surfaces for the magnifier window. Buffers are
+//! allocated when the window size or DPI changes and reused by every frame
+//! after that, a frame is:
+//!
+//!   auto surface = pool.Acquire();    // the back buffer
+//!   raster.Render(view, surface);
+//!   pool.Present(x, y, raster.PresentRects(), raster.PresentRectCount());
+//!
+//! so the steady state creates no DC, DIB section, XImage or segment. The
+//! counters prove it: AllocationCount() stays put once the size is stable.
+class SurfacePool
+{
+public:
+    SurfacePool(int buffer_count);
+    virtual ~SurfacePool() = default;
+public:
+    static const int MIN_BUFFER_COUNT = 2;
+    static const int MAX_BUFFER_COUNT = 3;
+protected:
+    const int buffer_count_;
+    struct RenderSurface surfaces_[MAX_BUFFER_COUNT];
+private:
+    int width_ = 0;
+    int height_ = 0;
+    int dpi_ = 0;
+    bool reserved_ = false;
+    int back_buffer_ = 0;
+private:
+    uint64_t allocation_count_ = 0;
+    uint64_t acquire_count_ = 0;
+    uint64_t present_count_ = 0;
+    uint64_t wait_count_ = 0;
+protected:
+    //! the platform part, fills surface->pixels and surface->stride
+    virtual bool allocateSurface(
+        int idx, int width, int height, int dpi,
+        struct RenderSurface* const surface
+    ) = 0;
+    virtual void releaseSurface(int idx) = 0;
+    //! blits buffer idx at (x, y) of the screen, only the rects of it when
+    //! rects is not nullptr
+    virtual bool presentSurface(
+        int idx, int x, int y,
+        const struct RenderRect* const rects, int rect_count
+    ) = 0;
+    //! true while the window system may still read buffer idx from an
+    //! earlier present, waitSurface() blocks until it does not
+    virtual bool isSurfaceBusy(int idx) { return false; }
+    virtual void waitSurface(int idx) {}
+protected:
+    //! derived destructors call it, the base one cannot reach their
+    //! releaseSurface() any more
+    void releaseSurfaces();
+public:
+    //! width*height device pixels for a window on a dpi screen, nothing
+    //! happens when both are the ones already reserved
+    bool Reserve(int width, int height, int dpi);
+    //! the back buffer, nullptr before a successful Reserve()
+    struct RenderSurface* Acquire();
+    //! shows the back buffer at (x, y) and makes the next one the back
+    //! buffer; with rects only those parts changed since the last present,
+    //! the window system may then leave the rest of the window alone
+    bool Present(
+        int x, int y,
+        const struct RenderRect* const rects = nullptr, int rect_count = 0
+    );
+public:
+    int BufferCount() const { return buffer_count_; }
+    //! surfaces allocated since construction, every Reserve() which
+    //! changes the size or DPI adds BufferCount()
+    uint64_t AllocationCount() const { return allocation_count_; }
+    uint64_t AcquireCount() const { return acquire_count_; }
+    uint64_t PresentCount() const { return present_count_; }
+    //! acquires which found their buffer still read by the window system
+    uint64_t WaitCount() const { return wait_count_; }
+};
+
+
+//! Plain heap buffers, for windows which copy the pixels on present (a
+//! CGImage from the bytes, a test without any window system)
+class MemorySurfacePool : public SurfacePool
+{
+public:
+    MemorySurfacePool(int buffer_count = MIN_BUFFER_COUNT);
+    ~MemorySurfacePool();
+private:
+    uint32_t* buffers_[MAX_BUFFER_COUNT] = {};
+    const struct RenderSurface* front_surface_ = nullptr;
+private:
+    bool allocateSurface(
+        int idx, int width, int height, int dpi,
+        struct RenderSurface* const surface
+    ) override;
+    void releaseSurface(int idx) override;
+    bool presentSurface(
+        int idx, int x, int y,
+        const struct RenderRect* const rects, int rect_count
+    ) override;
+public:
+    //! the buffer of the last Present(), nullptr before the first one
+    const struct RenderSurface* FrontSurface() const { return front_surface_; }
+};
@@ -0,0 +1,278 @@
+#include "SyntheticFrameSource.h"
+
+#include <cstdio>
+#include <cctype>
+#include <stdexcept>
+
+#ifdef _WIN32
+  #define WIN32_LEAN_AND_MEAN
+  #include <Windows.h>
+#else
+  #include <fcntl.h>
+  #include <unistd.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+#endif
+
+#include "parameters.h"
+
+
+//! frames of the default cursor path, a diagonal over the whole image
+static const int DEFAULT_CURSOR_PATH_LENGTH = 240;
+
+//! widest and highest image taken, far beyond any screen; checked before
+//! any product of the sizes, which then always fits
+static const int IMAGE_SIZE_MAX = 1 << 16;
+
+
+SyntheticFrameSource::SyntheticFrameSource
+(
+    const std::string& image_path,
+    const CursorPath& cursor_path,
+    int raw_width, int raw_height
+)
+:cursor_path_(cursor_path)
+{
+    fprintf(stderr, "%s\n", __PRETTY_FUNCTION__);
+
+    mapImageFile(image_path);
+
+    if( raw_width > 0 && raw_height > 0 )
+    {
+        if( raw_width > IMAGE_SIZE_MAX || raw_height > IMAGE_SIZE_MAX || \
+            mapped_size_ < size_t(raw_width)*raw_height*4 )
+        {
+            unmapImageFile();
+            fprintf(stderr, "SyntheticFrameSource Constructor Error 2\n");
+            throw std::runtime_error("SyntheticFrameSource Constructor Error 2");
+        }
+        pixel_data_ = mapped_data_;
+        bytes_per_pixel_ = 4;
+        blue_offset_ = 0; green_offset_ = 1; red_offset_ = 2;
+        screen_width_ = raw_width;
+        screen_height_ = raw_height;
+    }
+    else
+    {
+        parsePortablePixmapHeader();
+    }
+
+    if( cursor_path_.empty() )
+    {
+        for(int idx = 0; idx < DEFAULT_CURSOR_PATH_LENGTH; ++idx)
+        {
+            cursor_path_.push_back({
+                screen_width_*idx/DEFAULT_CURSOR_PATH_LENGTH,
+                screen_height_*idx/DEFAULT_CURSOR_PATH_LENGTH
+            });
+        }
+    }
+
+    fprintf(stderr, "synthetic screen: %4d %4d, cursor path: %zu\n", \
+                        screen_width_, screen_height_, cursor_path_.size());
+}
+
+
+SyntheticFrameSource::~SyntheticFrameSource()
+{
+    fprintf(stderr, "%s\n", __PRETTY_FUNCTION__);
+    unmapImageFile();
+}
+
+
+void
+SyntheticFrameSource::mapImageFile
+(
+    const std::string& image_path
+)
+{
+#ifdef _WIN32
+    file_handle_ = ::CreateFileA(image_path.c_str(), GENERIC_READ, \
+            FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, \
+                                                                    nullptr);
+    LARGE_INTEGER file_size = {};
+    if( file_handle_ == INVALID_HANDLE_VALUE || \
+        FALSE == ::GetFileSizeEx(file_handle_, &file_size) )
+    {
+        fprintf(stderr, "SyntheticFrameSource Constructor Error 0 %s\n", \
+                                                        image_path.c_str());
+        throw std::runtime_error("SyntheticFrameSource Constructor Error 0");
+    }
+    mapped_size_ = size_t(file_size.QuadPart);
+
+    mapping_handle_ = ::CreateFileMappingA(file_handle_, nullptr, \
+                                            PAGE_READONLY, 0, 0, nullptr);
+    if( mapping_handle_ != nullptr )
+    {
+        mapped_data_ = (const uint8_t*)::MapViewOfFile(mapping_handle_, \
+                                                    FILE_MAP_READ, 0, 0, 0);
+    }
+    if( mapped_data_ == nullptr )
+    {
+        unmapImageFile();
+        fprintf(stderr, "SyntheticFrameSource Constructor Error 1\n");
+        throw std::runtime_error("SyntheticFrameSource Constructor Error 1");
+    }
+#else
+    const int file_descriptor = ::open(image_path.c_str(), O_RDONLY);
+    struct stat file_status = {};
+    if( file_descriptor < 0 || ::fstat(file_descriptor, &file_status) != 0 )
+    {
+        if( file_descriptor >= 0 ) { ::close(file_descriptor); }
+        fprintf(stderr, "SyntheticFrameSource Constructor Error 0 %s\n", \
+                                                        image_path.c_str());
+        throw std::runtime_error("SyntheticFrameSource Constructor Error 0");
+    }
+    mapped_size_ = size_t(file_status.st_size);
+
+    auto mapped = ::mmap(nullptr, mapped_size_, PROT_READ, MAP_PRIVATE, \
+                                                        file_descriptor, 0);
+    ::close(file_descriptor); // the mapping keeps the file alive
+    if( mapped == MAP_FAILED )
+    {
+        mapped_size_ = 0;
+        fprintf(stderr, "SyntheticFrameSource Constructor Error 1\n");
+        throw std::runtime_error("SyntheticFrameSource Constructor Error 1");
+    }
+    mapped_data_ = (const uint8_t*)mapped;
+#endif
+}
+
+
+void
+SyntheticFrameSource::unmapImageFile()
+{
+#ifdef _WIN32
+    if( mapped_data_ != nullptr ) { ::UnmapViewOfFile(mapped_data_); }
+    if( mapping_handle_ != nullptr ) { ::CloseHandle(mapping_handle_); }
+    if( file_handle_ != nullptr && file_handle_ != INVALID_HANDLE_VALUE )
+    {
+        ::CloseHandle(file_handle_);
+    }
+    mapping_handle_ = nullptr;
+    file_handle_ = nullptr;
+#else
+    if( mapped_data_ != nullptr )
+    {
+        ::munmap((void*)mapped_data_, mapped_size_);
+    }
+#endif
+    mapped_data_ = nullptr;
+    mapped_size_ = 0;
+}
+
+
+void
+SyntheticFrameSource::parsePortablePixmapHeader()
+{
+    //! "P6" <ws> width <ws> height <ws> maxval <one ws> pixels, where any
+    //! <ws> may hold '#' comments up to the end of the line
+    size_t cursor = 0;
+
+    //! -1 when there is no number or it is above IMAGE_SIZE_MAX
+    auto next_token = [&]() -> long
+    {
+        while( cursor < mapped_size_ )
+        {
+            if( mapped_data_[cursor] == '#' )
+            {
+                while( cursor < mapped_size_ && mapped_data_[cursor] != '\n' )
+                {
+                    ++cursor;
+                }
+            }
+            else if( isspace(mapped_data_[cursor]) )
+            {
+                ++cursor;
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        long value = 0;
+        bool has_digit = false;
+        while( cursor < mapped_size_ && isdigit(mapped_data_[cursor]) )
+        {
+            value = value*10 + (mapped_data_[cursor] - '0');
+            has_digit = true;
+            ++cursor;
+            if( value > IMAGE_SIZE_MAX )
+            {
+                return -1;
+            }
+        }
+        return has_digit ? value : -1;
+    };
+
+    if( mapped_size_ < 2 || mapped_data_[0] != 'P' || mapped_data_[1] != '6' )
+    {
+        unmapImageFile();
+        fprintf(stderr, "SyntheticFrameSource Constructor Error 3\n");
+        throw std::runtime_error("SyntheticFrameSource Constructor Error 3");
+    }
+    cursor = 2;
+
+    const auto width = next_token();
+    const auto height = next_token();
+    const auto max_value = next_token();
+    cursor += 1; // single white space before the raster
+
+    if( width <= 0 || height <= 0 || max_value != 255 || \
+        mapped_size_ < cursor + size_t(width)*height*3 )
+    {
+        unmapImageFile();
+        fprintf(stderr, "SyntheticFrameSource Constructor Error 4\n");
+        throw std::runtime_error("SyntheticFrameSource Constructor Error 4");
+    }
+
+    pixel_data_ = mapped_data_ + cursor;
+    bytes_per_pixel_ = 3;
+    red_offset_ = 0; green_offset_ = 1; blue_offset_ = 2;
+    screen_width_ = int(width);
+    screen_height_ = int(height);
+}
+
+
+bool
+SyntheticFrameSource::CurrentCursorPosition
+(
+    int* const x, int* const y
+)
+{
+    if( cursor_path_position_ >= cursor_path_.size() )
+    {
+        return false;
+    }
+
+    const auto& point = cursor_path_[cursor_path_position_++];
+    *x = point.x;
+    *y = point.y;
+    return true;
+}
+
+
+bool
+SyntheticFrameSource::CaptureWithinBound
+(
+    int central_x, int central_y,
+    int bound_width, int bound_height,
+    struct CapturedFrame* const frame
+)
+{
+    frame->data = pixel_data_;
+    frame->stride = screen_width_*bytes_per_pixel_;
+    frame->bytes_per_pixel = bytes_per_pixel_;
+    frame->red_offset = red_offset_;
+    frame->green_offset = green_offset_;
+    frame->blue_offset = blue_offset_;
+    frame->left = 0;
+    frame->top = 0;
+    frame->width = screen_width_;
+    frame->height = screen_height_;
+    frame->screen_width = screen_width_;
+    frame->screen_height = screen_height_;
+
+    return true;
+}
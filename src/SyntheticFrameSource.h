@@ -0,0 +1,69 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "FrameSource.h"
+
+
+//! Replays a memory mapped image as if it were the desktop, and a scripted
+//! list of cursor positions as if the user moved the mouse. Two layouts
+//! are accepted: binary PPM (P6, 8 bits per channel) and raw 32 bits BGRA
+//! rows, the latter needs the image size from the caller.
+class SyntheticFrameSource : public FrameSource
+{
+public:
+    struct CursorPoint
+    {
+        int x = 0, y = 0;
+    };
+    typedef std::vector<CursorPoint> CursorPath;
+public:
+    SyntheticFrameSource(const std::string& image_path,
+                         const CursorPath& cursor_path,
+                         int raw_width = 0, int raw_height = 0);
+    ~SyntheticFrameSource();
+private:
+    const uint8_t* mapped_data_ = nullptr;
+    size_t mapped_size_ = 0;
+#ifdef _WIN32
+    void* file_handle_ = nullptr;
+    void* mapping_handle_ = nullptr;
+#endif
+private:
+    const uint8_t* pixel_data_ = nullptr;
+    int bytes_per_pixel_ = 0;
+    int blue_offset_ = 0, green_offset_ = 0, red_offset_ = 0;
+    int screen_width_ = 0;
+    int screen_height_ = 0;
+private:
+    CursorPath cursor_path_;
+    size_t cursor_path_position_ = 0;
+private:
+    void mapImageFile(const std::string& image_path);
+    void unmapImageFile();
+    void parsePortablePixmapHeader();
+public:
+    int ScreenWidth() const override { return screen_width_; }
+    int ScreenHeight() const override { return screen_height_; }
+public:
+    bool CurrentCursorPosition(int* const x, int* const y) override;
+public:
+    //! the image never changes, only a cursor move needs a new capture
+    bool ReportsDamage() const override { return true; }
+    bool IsDirtyWithinBound(
+        int central_x, int central_y,
+        int bound_width, int bound_height
+    ) override
+    {
+        return false;
+    }
+public:
+    //! the whole image, straight from the mapping
+    bool CaptureWithinBound(
+        int central_x, int central_y,
+        int bound_width, int bound_height,
+        struct CapturedFrame* const frame
+    ) override;
+};
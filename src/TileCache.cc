@@ -0,0 +1,227 @@
+#include "TileCache.h"
+
+#include <cstdio>
+#include <algorithm>
+
+
+static int
+AlignDownToHalfTile(int value)
+{
+    const int step = TILE_SIZE/2;
+    const int index = value >= 0 ? value/step : -((-value + step - 1)/step);
+    return index*step;
+}
+
+
+template <typename PixelT>
+TileCache<PixelT>::TileCache
+(
+    class FrameSource* frame_source
+)
+:frame_source_(frame_source)
+{
+    for(auto& tile : tiles_)
+    {
+        tile.data = new PixelT[TILE_SIZE*TILE_SIZE];
+    }
+}
+
+
+template <typename PixelT>
+TileCache<PixelT>::~TileCache()
+{
+    for(auto& tile : tiles_)
+    {
+        delete[] tile.data;
+    }
+}
+
+
+template <typename PixelT>
+bool
+TileCache<PixelT>::isTileValid
+(
+    const struct Tile& tile
+)
+{
+    return tile.generation == generation_ && \
+        false == frame_source_->IsDirtyWithinBound( \
+                                tile.left + TILE_SIZE/2, tile.top + TILE_SIZE/2, \
+                                                    TILE_SIZE, TILE_SIZE );
+}
+
+
+template <typename PixelT>
+typename TileCache<PixelT>::Tile*
+TileCache<PixelT>::acquireTile
+(
+    int tile_left, int tile_top,
+    bool* const captured
+)
+{
+    *captured = false;
+
+    struct Tile* found = nullptr;
+    struct Tile* least_recently_used = &tiles_[0];
+    for(auto& tile : tiles_)
+    {
+        if( tile.generation != 0 && \
+            tile.left == tile_left && tile.top == tile_top )
+        {
+            found = &tile;
+            break;
+        }
+        if( tile.last_use < least_recently_used->last_use )
+        {
+            least_recently_used = &tile;
+        }
+    }
+
+    if( found != nullptr && isTileValid(*found) )
+    {
+        return found;
+    }
+
+    if( found == nullptr )
+    {
+        found = least_recently_used;
+    }
+
+    //! the capture consumes the damage over the whole tile, cached tiles
+    //! overlapping it would look clean afterwards while holding what was
+    //! there before: they turn stale now, while the damage still tells
+    for(auto& tile : tiles_)
+    {
+        if( &tile == found || tile.generation != generation_ )
+        {
+            continue;
+        }
+        const int left = std::max(tile.left, tile_left);
+        const int top = std::max(tile.top, tile_top);
+        const int right = std::min(tile.left, tile_left) + TILE_SIZE;
+        const int bottom = std::min(tile.top, tile_top) + TILE_SIZE;
+        if( left < right && top < bottom && \
+            frame_source_->IsDirtyWithinBound(left + (right - left)/2, top + (bottom - top)/2, \
+                                              right - left, bottom - top) )
+        {
+            tile.generation = 0;
+        }
+    }
+
+    found->generation = 0;
+    found->prefetched = false;
+    found->left = tile_left;
+    found->top = tile_top;
+
+    const auto capture_start = std::chrono::steady_clock::now();
+    if( false == frame_source_->RefreshScreenPixelDataWithinBound( \
+                        tile_left + TILE_SIZE/2, tile_top + TILE_SIZE/2, \
+                                    TILE_SIZE, TILE_SIZE, found->data ) )
+    {
+        fprintf(stderr, "%s Error 1\n", __PRETTY_FUNCTION__);
+        return nullptr;
+    }
+    found->capture_time = std::chrono::steady_clock::now() - capture_start;
+
+    found->generation = generation_;
+    *captured = true;
+
+    return found;
+}
+
+
+template <typename PixelT>
+bool
+TileCache<PixelT>::ViewWithinBound
+(
+    int central_x, int central_y,
+    int bound_width, int bound_height,
+    struct ScreenPixelView<PixelT>* const view,
+    bool* const captured
+)
+{
+    *captured = false;
+
+    if( bound_width > TILE_SIZE/2 || bound_height > TILE_SIZE/2 )
+    {
+        return false;
+    }
+
+    const int bound_left = central_x - bound_width/2;
+    const int bound_top  = central_y - bound_height/2;
+    const int tile_left  = AlignDownToHalfTile(bound_left);
+    const int tile_top   = AlignDownToHalfTile(bound_top);
+
+    use_clock_ += 1;
+
+    auto tile = acquireTile(tile_left, tile_top, captured);
+    if( tile == nullptr )
+    {
+        miss_count_ += 1;
+        return false;
+    }
+
+    if( *captured )
+    {
+        miss_count_ += 1;
+    }
+    else
+    {
+        hit_count_ += 1;
+        if( tile->prefetched )
+        {
+            prefetch_hit_count_ += 1;
+            prefetch_saved_time_ += tile->capture_time;
+        }
+    }
+
+    tile->prefetched = false;
+    tile->last_use = use_clock_;
+
+    view->data = tile->data + \
+                    (bound_top - tile_top)*TILE_SIZE + (bound_left - tile_left);
+    view->width = bound_width;
+    view->height = bound_height;
+    view->stride = TILE_SIZE;
+
+    return true;
+}
+
+
+template <typename PixelT>
+bool
+TileCache<PixelT>::Prefetch
+(
+    int central_x, int central_y,
+    int bound_width, int bound_height
+)
+{
+    if( bound_width > TILE_SIZE/2 || bound_height > TILE_SIZE/2 )
+    {
+        return false;
+    }
+
+    const int tile_left = AlignDownToHalfTile(central_x - bound_width/2);
+    const int tile_top  = AlignDownToHalfTile(central_y - bound_height/2);
+
+    //! counts as used, so the next prefetch does not evict it right away
+    use_clock_ += 1;
+
+    bool captured = false;
+    auto tile = acquireTile(tile_left, tile_top, &captured);
+    if( tile == nullptr || captured == false )
+    {
+        return false;
+    }
+
+    tile->prefetched = true;
+    tile->last_use = use_clock_;
+    prefetch_count_ += 1;
+
+    return true;
+}
+
+
+template class TileCache<PixelRGBA8>;
+template class TileCache<PixelRGB10A2>;
+template class TileCache<PixelRGBA16F>;
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#include "FrameSource.h"
+#include "parameters.h"
+
+
+//! Keeps a few TILE_SIZE*TILE_SIZE captures around the cursor. Tiles sit on
+//! a TILE_SIZE/2 grid, so any bound up to TILE_SIZE/2 wide fits in one tile
+//! and is served as a view into it. A tile is stale once its generation
+//! is older than the cache's one or the source reports damage inside it.
+template <typename PixelT>
+class TileCache
+{
+public:
+    TileCache(class FrameSource* frame_source);
+    ~TileCache();
+private:
+    struct Tile
+    {
+        int left = 0;
+        int top = 0;
+        uint64_t generation = 0;
+        uint64_t last_use = 0;
+        PixelT* data = nullptr;
+        //! captured ahead of the cursor and not looked at yet
+        bool prefetched = false;
+        std::chrono::steady_clock::duration capture_time{};
+    };
+private:
+    class FrameSource* const frame_source_;
+    struct Tile tiles_[TILE_CACHE_CAPACITY];
+private:
+    uint64_t generation_ = 1;
+    uint64_t use_clock_ = 0;
+private:
+    uint64_t hit_count_ = 0;
+    uint64_t miss_count_ = 0;
+private:
+    uint64_t prefetch_count_ = 0;
+    uint64_t prefetch_hit_count_ = 0;
+    std::chrono::steady_clock::duration prefetch_saved_time_{};
+private:
+    bool isTileValid(const struct Tile& tile);
+    struct Tile* acquireTile(int tile_left, int tile_top, bool* const captured);
+public:
+    //! every tile captured so far turns stale
+    void Invalidate() { generation_ += 1; }
+public:
+    //! false when the bound is too big for a tile or its capture failed,
+    //! *captured tells whether the source had to capture for this view
+    bool ViewWithinBound(
+        int central_x, int central_y,
+        int bound_width, int bound_height,
+        struct ScreenPixelView<PixelT>* const view,
+        bool* const captured
+    );
+public:
+    //! captures the tile of a bound the cursor is expected to reach, so the
+    //! later ViewWithinBound() is a hit, false when it was valid already
+    bool Prefetch(
+        int central_x, int central_y,
+        int bound_width, int bound_height
+    );
+public:
+    uint64_t PrefetchCount() const { return prefetch_count_; }
+    uint64_t PrefetchHitCount() const { return prefetch_hit_count_; }
+    //! capture time of the prefetched tiles the cursor actually reached
+    std::chrono::steady_clock::duration PrefetchSavedTime() const
+    {
+        return prefetch_saved_time_;
+    }
+public:
+    uint64_t HitCount() const { return hit_count_; }
+    uint64_t MissCount() const { return miss_count_; }
+    double HitRate() const
+    {
+        const auto lookup_count = hit_count_ + miss_count_;
+        return lookup_count == 0 ? 0.0 : double(hit_count_)/lookup_count;
+    }
+};
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+
+//! One producer thread hands values to one consumer thread without either
+//! of them ever waiting: the producer fills Back() and publishes it, the
+//! consumer takes whatever was published last. Of the three slots one is
+//! the producer's, one the consumer's, the middle one changes hands by
+//! one atomic exchange on each side; a value published twice before the
+//! consumer looked is dropped, the consumer only ever sees the newest.
+template <typename T>
+class TripleBuffer
+{
+private:
+    //! set in middle_ when the producer put a value there the consumer
+    //! has not taken yet
+    static constexpr uint8_t FRESH = 0x4;
+    static constexpr uint8_t INDEX = 0x3;
+private:
+    T slots_[3];
+    std::atomic<uint8_t> middle_{1};
+    //! the producer's
+    uint8_t back_ = 0;
+    //! the consumer's
+    uint8_t front_ = 2;
+private:
+    std::atomic<uint64_t> published_count_{0};
+    std::atomic<uint64_t> dropped_count_{0};
+    uint64_t consumed_count_ = 0;
+public:
+    //! producer: the slot to fill, it stays the producer's until Publish()
+    T& Back() { return slots_[back_]; }
+    //! producer: Back() goes to the consumer, a new Back() comes from the
+    //! middle
+    void Publish()
+    {
+        const uint8_t previous = middle_.exchange(uint8_t(back_ | FRESH), \
+                                                    std::memory_order_acq_rel);
+        back_ = previous & INDEX;
+        if( (previous & FRESH) != 0 )
+        {
+            dropped_count_.fetch_add(1, std::memory_order_relaxed);
+        }
+        published_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+public:
+    //! consumer: Front() becomes the newest published value, false (and
+    //! Front() unchanged) when nothing was published since
+    bool Update()
+    {
+        if( (middle_.load(std::memory_order_acquire) & FRESH) == 0 )
+        {
+            return false;
+        }
+        front_ = middle_.exchange(front_, std::memory_order_acq_rel) & INDEX;
+        consumed_count_ += 1;
+        return true;
+    }
+    const T& Front() const { return slots_[front_]; }
+public:
+    uint64_t PublishedCount() const { return published_count_.load(std::memory_order_relaxed); }
+    //! published, then replaced before the consumer took it
+    uint64_t DroppedCount() const { return dropped_count_.load(std::memory_order_relaxed); }
+    //! consumer side only
+    uint64_t ConsumedCount() const { return consumed_count_; }
+};
@@ -1,5 +1,638 @@
 #include <iostream>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <cstring>
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <string>
+#include <vector>
 #include "addon.h"
+#include "PickerPipeline.h"
+#include "TripleBuffer.h"
+#include "PickerListener.h"
+#include "SyntheticFrameSource.h"
+#include "PointSampler.h"
+#include "ColorTransform.h"
+#include "PipelineStats.h"
+#include "MagnifierRaster.h"
+
+static SyntheticFrameSource* CreateSyntheticFrameSource(Napi::Object pickerParams) {
+  Napi::Env env = pickerParams.Env();
+
+  if (!pickerParams.Has("image")) {
+    throw Napi::TypeError::New(env, "synthetic source needs an image path");
+  }
+  std::string imagePath = (std::string) pickerParams.Get("image").ToString();
+
+  int rawWidth = 0, rawHeight = 0;
+  if (pickerParams.Has("imageWidth") && pickerParams.Has("imageHeight")) {
+    rawWidth = pickerParams.Get("imageWidth").ToNumber().Int32Value();
+    rawHeight = pickerParams.Get("imageHeight").ToNumber().Int32Value();
+  }
+
+  SyntheticFrameSource::CursorPath cursorPath;
+  if (pickerParams.Has("cursorPath")) {
+    Napi::Array points = pickerParams.Get("cursorPath").As<Napi::Array>();
+    for (uint32_t i = 0; i < points.Length(); i++) {
+      Napi::Object point = points.Get(i).As<Napi::Object>();
+      cursorPath.push_back({
+        point.Get("x").ToNumber().Int32Value(),
+        point.Get("y").ToNumber().Int32Value()
+      });
+    }
+  }
+
+  try {
+    return new SyntheticFrameSource(imagePath, cursorPath, rawWidth, rawHeight);
+  } catch (const std::exception& error) {
+    throw Napi::Error::New(env, error.what());
+  }
+}
+
+// the profile given by `iccProfile`, nullptr without one
+static ColorTransform* CreateColorTransform(Napi::Object pickerParams, TargetColorSpace colorSpace) {
+  Napi::Env env = pickerParams.Env();
+
+  if (!pickerParams.Has("iccProfile")) {
+    return nullptr;
+  }
+  std::string profilePath = (std::string) pickerParams.Get("iccProfile").ToString();
+
+  try {
+    ColorProfile profile(profilePath);
+    return new ColorTransform(profile, colorSpace);
+  } catch (const std::exception& error) {
+    throw Napi::Error::New(env, error.what());
+  }
+}
+
+static PickerOptions ReadPickerOptions(Napi::Object pickerParams) {
+  PickerOptions options;
+
+  if (pickerParams.Has("colorSpace") &&
+      (std::string) pickerParams.Get("colorSpace").ToString() == "display-p3") {
+    options.color_space = TargetColorSpace::DISPLAY_P3;
+  }
+  if (pickerParams.Has("gridSize")) {
+    options.sample_size = pickerParams.Get("gridSize").ToNumber().Int32Value();
+  }
+  if (pickerParams.Has("loupeCells")) {
+    options.grid_number = std::clamp(pickerParams.Get("loupeCells").ToNumber().Int32Value(),
+                                     GRID_NUMUBER_MIN, GRID_NUMUBER_MAX) | 1;
+  }
+  if (pickerParams.Has("zoom")) {
+    options.grid_pixel = std::clamp(pickerParams.Get("zoom").ToNumber().Int32Value(),
+                                    GRID_PIXEL_MIN, GRID_PIXEL_MAX);
+  }
+  if (pickerParams.Has("logStats")) {
+    options.log_statistics = pickerParams.Get("logStats").ToBoolean().Value();
+  }
+  if (pickerParams.Has("cpuBudget")) {
+    options.cpu_budget = pickerParams.Get("cpuBudget").ToNumber().DoubleValue();
+  }
+  if (pickerParams.Has("sampleMode") &&
+      (std::string) pickerParams.Get("sampleMode").ToString() == "median") {
+    options.sample_mode = SampleMode::MEDIAN;
+  }
+
+  return options;
+}
+
+// runs the whole pipeline against a frame source without any desktop and
+// reports how long each stage took per frame; the pipeline ticks on its
+// own thread and hands frames over through a triple buffer, this thread
+// only passes the newest one on
+template <typename PixelT>
+static void RunPipeline(PickerListener* listener, FrameSource* frameSource,
+                        const PickerOptions& options) {
+  typedef std::chrono::steady_clock clock;
+
+  PickerPipeline<PixelT> pipeline(frameSource, options);
+  TripleBuffer<PickerFrame<PixelT>> frameBuffer;
+  std::atomic<bool> captureDone(false), stopCapture(false);
+  // wakes this thread on every published frame and once the capture is
+  // done, it sleeps in between rather than spinning on the buffer
+  std::mutex wakeMutex;
+  std::condition_variable wake;
+  bool woken = false;
+  auto wakeConsumer = [&]() {
+    {
+      std::lock_guard<std::mutex> lock(wakeMutex);
+      woken = true;
+    }
+    wake.notify_one();
+  };
+
+  uint32_t frames = 0, emits = 0;
+  clock::duration captureTime{}, emitTime{};
+
+  std::thread captureThread([&]() {
+    while (!stopCapture.load(std::memory_order_relaxed)) {
+      auto captureStart = clock::now();
+      if (!pipeline.Tick()) {
+        break;
+      }
+      captureTime += clock::now() - captureStart;
+      frames++;
+
+      if (pipeline.FrameChanged()) {
+        auto& frame = frameBuffer.Back();
+        pipeline.Snapshot(&frame);
+        frame.tick_start = captureStart;
+        frame.published = clock::now();
+        frameBuffer.Publish();
+        PipelineStats::Global().Count(PipelineCounter::PUBLISHED);
+        wakeConsumer();
+      }
+
+      pipeline.Prefetch();
+    }
+    captureDone.store(true, std::memory_order_release);
+    wakeConsumer();
+  });
+
+  FrameLatency presentLatency;
+  try {
+    for (;;) {
+      // read before looking at the buffer: once done, the last frame is in
+      bool done = captureDone.load(std::memory_order_acquire);
+      if (frameBuffer.Update()) {
+        const auto& frame = frameBuffer.Front();
+        PipelineStats::Global().Count(PipelineCounter::PRESENTED);
+        auto emitStart = clock::now();
+        listener->Update(frame.Color());
+        emitTime += clock::now() - emitStart;
+        emits++;
+        presentLatency.Add(clock::now() - frame.tick_start);
+      } else if (done) {
+        break;
+      } else {
+        std::unique_lock<std::mutex> lock(wakeMutex);
+        wake.wait(lock, [&]() { return woken; });
+        woken = false;
+      }
+    }
+  } catch (...) {
+    stopCapture.store(true, std::memory_order_relaxed);
+    captureThread.join();
+    throw;
+  }
+  captureThread.join();
+
+  // the path is over, the pick ends where it did
+  if (frameBuffer.Front().id != 0) {
+    listener->Pick(frameBuffer.Front().color);
+  }
+
+  if (!options.log_statistics) {
+    return;
+  }
+  if (frames > 0) {
+    auto perCall = [](clock::duration total, uint32_t calls) {
+      return calls == 0 ? 0.0 :
+        std::chrono::duration<double, std::micro>(total).count() / calls;
+    };
+    fprintf(stderr, "pipeline frames %u, capture+convert %.2f us, emit %.2f us\n",
+            frames, perCall(captureTime, frames), perCall(emitTime, emits));
+    fprintf(stderr, "frames published %llu, emitted %llu, replaced unseen %llu\n",
+            (unsigned long long)frameBuffer.PublishedCount(),
+            (unsigned long long)frameBuffer.ConsumedCount(),
+            (unsigned long long)frameBuffer.DroppedCount());
+    presentLatency.LogStatistics("capture->emit");
+  }
+  pipeline.LogStatistics();
+}
+
+// the capture of color, in PixelT, through magnifier
+template <typename PixelT>
+static void RenderMagnifierOf(MagnifierRaster* magnifier, const PickerColor& color) {
+  ScreenPixelView<PixelT> view;
+  view.data = reinterpret_cast<const PixelT*>(color.pixels.Data());
+  view.width = color.pixels_width;
+  view.height = color.pixels_height;
+  view.stride = color.pixels_width;
+  magnifier->Render(view);
+}
+
+// what createSession() keeps across picks: the capture backend, opened
+// once, see PickerContext; touched on the JS thread only, the running pick
+// holds it too
+struct WarmSession {
+#if defined(__linux__)
+  std::unique_ptr<PickerContext> context;
+#endif
+  bool running = false;
+  // closed while a pick was running, the context goes once it is over
+  bool closed = false;
+};
+
+// one pick, run on its own thread so the JS one never waits for it:
+// colours reach `emit` through a thread-safe function, and the promise
+// init() returned settles once the threads are done and every update was
+// delivered.
+//
+// Latest value wins: the picker thread only replaces the pending colour,
+// an emit thread queues it to JS when the previous update was delivered
+// and no sooner than `maxUpdateRate` allows. A slow JS side gets fewer,
+// fresher updates instead of a growing queue.
+class PickerSession : public PickerListener {
+public:
+  typedef std::chrono::steady_clock clock;
+
+  PickerSession(Napi::Env env, const std::string& previousColor)
+    : deferred(Napi::Promise::Deferred::New(env)),
+      pickedColor(previousColor),
+      startTime(clock::now()) {}
+
+  Napi::Promise::Deferred deferred;
+  Napi::ThreadSafeFunction emit;
+  // the emit function itself, for "end" once the thread-safe one is gone
+  Napi::FunctionReference emitFunction;
+  std::thread thread;
+  std::thread emitThread;
+
+  PickerOptions options;
+  std::string pixelFormat;
+  std::unique_ptr<ColorTransform> colorTransform;
+  std::unique_ptr<FrameSource> frameSource;
+  // `update` as (rgba, x, y, frameId) numbers rather than "#RRGGBB"
+  bool compactPayload = false;
+  // `update` ends with (pixels, width, height), the capture around the
+  // cursor in the pipeline format, lent by reference
+  bool emitPixels = false;
+  // `update` ends with (magnifier, size): the loupe as the pick draws it,
+  // loupeCells cells of zoom pixels, size*size premultiplied BGRA pixels
+  std::unique_ptr<MagnifierRaster> magnifier;
+  void (*renderMagnifier)(MagnifierRaster*, const PickerColor&) = nullptr;
+  std::shared_ptr<BufferPool> magnifierPool;
+  // 0: as fast as JS takes them
+  clock::duration minUpdateInterval{};
+  // the warm session picking, none for init()
+  std::shared_ptr<WarmSession> warm;
+
+  // written by the picker thread, read once it is joined
+  std::string pickedColor;
+  std::string error;
+
+  // updates queued to JS, replaced by a newer one before that, and
+  // frames never passed on at all (frame id gaps, failed calls)
+  uint64_t updateCount = 0, coalescedCount = 0, droppedCount = 0;
+
+  // from init() or start() to the first colour of the pipeline, cold or
+  // warm; zero while there is none
+  clock::time_point startTime;
+  clock::duration firstColorTime{};
+
+  void Update(const PickerColor& color) override {
+    SharedBuffer magnifierPixels;
+    if (magnifier && !color.pixels.Empty()) {
+      magnifierPixels = RenderMagnifier(color);
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (hasPending) {
+        coalescedCount++;
+      }
+      droppedCount += color.frame_id - lastFrameId - 1;
+      if (lastFrameId == 0) {
+        firstColorTime = clock::now() - startTime;
+      }
+      lastFrameId = color.frame_id;
+      pending = color;
+      pendingSince = clock::now();
+      if (!emitPixels) {
+        // hold no frame buffer the capture could reuse
+        pending.pixels = SharedBuffer();
+      }
+      pendingMagnifier = std::move(magnifierPixels);
+      hasPending = true;
+    }
+    wake.notify_one();
+  }
+
+  void Pick(const char* color) override {
+    pickedColor = color;
+  }
+
+  // on the picker thread, till the pick is over
+  void Run() {
+    try {
+      if (frameSource) {
+        if (pixelFormat == "rgb10a2") {
+          RunPipeline<PixelRGB10A2>(this, frameSource.get(), options);
+        } else if (pixelFormat == "rgba16f") {
+          RunPipeline<PixelRGBA16F>(this, frameSource.get(), options);
+        } else {
+          RunPipeline<PixelRGBA8>(this, frameSource.get(), options);
+        }
+      } else {
+        int result = 0;
+#if defined(_WIN32)
+        result = Picker(NULL, NULL, NULL, 1);
+#elif defined(__linux__)
+        result = Picker(0, options, this, warm ? warm->context.get() : nullptr);
+#endif
+        if (result == 2) {
+          error = "init: the capture failed during the pick";
+        } else if (result != 0) {
+          // the display or the capture could not be opened
+          error = "init: the picker could not start (" + std::to_string(result) + ")";
+        }
+      }
+    } catch (const std::exception& exception) {
+      error = exception.what();
+    }
+    Done();
+  }
+
+  // the pick is over, the emit thread flushes what is pending and leaves
+  void Done() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      pickDone = true;
+    }
+    wake.notify_one();
+  }
+
+  // on the emit thread, one update in flight at most
+  void EmitLoop() {
+    clock::time_point lastEmit{};
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;) {
+      wake.wait(lock, [this]() {
+        return (hasPending && !inFlight) || (pickDone && !hasPending);
+      });
+      if (!hasPending) {
+        break;
+      }
+      // the last colour of a pick is not held back
+      auto nextEmit = lastEmit + minUpdateInterval;
+      if (!pickDone && clock::now() < nextEmit) {
+        wake.wait_until(lock, nextEmit, [this]() { return pickDone; });
+        continue;
+      }
+
+      inFlightColor = pending;
+      inFlightMagnifier = std::move(pendingMagnifier);
+      inFlightSince = pendingSince;
+      hasPending = false;
+      inFlight = true;
+      lastEmit = clock::now();
+      updateCount++;
+
+      lock.unlock();
+      napi_status status = emit.NonBlockingCall(this, EmitUpdate);
+      lock.lock();
+      if (status != napi_ok) {
+        inFlight = false;
+        updateCount--;
+        droppedCount++;
+      }
+    }
+    lock.unlock();
+    emit.Release();
+  }
+
+  // on the JS thread, after the last update
+  static void Finish(Napi::Env env, PickerSession* session) {
+    if (session->thread.joinable()) {
+      session->thread.join();
+    }
+    if (session->emitThread.joinable()) {
+      session->emitThread.join();
+    }
+
+    if (session->warm) {
+      session->warm->running = false;
+#if defined(__linux__)
+      if (session->warm->closed) {
+        session->warm->context.reset();
+      }
+#endif
+    }
+
+    double firstColorMs =
+      std::chrono::duration<double, std::milli>(session->firstColorTime).count();
+
+    Napi::Object stats = Napi::Object::New(env);
+    stats.Set("updates", Napi::Number::New(env, (double) session->updateCount));
+    stats.Set("coalesced", Napi::Number::New(env, (double) session->coalescedCount));
+    stats.Set("dropped", Napi::Number::New(env, (double) session->droppedCount));
+    stats.Set("firstColorMs", Napi::Number::New(env, firstColorMs));
+
+    Napi::Function emit = session->emitFunction.Value();
+    emit.Call({
+      Napi::String::New(env, "end"),
+      stats
+    });
+
+    if (session->error.empty()) {
+      session->deferred.Resolve(Napi::String::New(env, session->pickedColor));
+    } else {
+      session->deferred.Reject(Napi::Error::New(env, session->error).Value());
+    }
+    delete session;
+  }
+
+private:
+  std::mutex mutex;
+  std::condition_variable wake;
+  PickerColor pending;
+  SharedBuffer pendingMagnifier;
+  // only written while no update is in flight
+  PickerColor inFlightColor;
+  SharedBuffer inFlightMagnifier;
+  // where the last magnifier was drawn, on the picker thread
+  int magnifierX = -1, magnifierY = -1;
+
+  // on the picker thread: the loupe of color, copied out of the raster's
+  // own framebuffer, which the next frame diffs against
+  SharedBuffer RenderMagnifier(const PickerColor& color) {
+    if (color.cursor_x != magnifierX || color.cursor_y != magnifierY) {
+      magnifier->Invalidate();
+      magnifierX = color.cursor_x;
+      magnifierY = color.cursor_y;
+    }
+    renderMagnifier(magnifier.get(), color);
+
+    size_t size = (size_t) magnifier->Stride() * magnifier->Size();
+    SharedBuffer pixels(magnifierPool->Acquire(size));
+    memcpy(pixels.Data(), magnifier->Framebuffer(), size);
+    return pixels;
+  }
+  // when the picker thread handed them over, for the emit stage
+  clock::time_point pendingSince, inFlightSince;
+  uint64_t lastFrameId = 0;
+  bool hasPending = false, inFlight = false, pickDone = false;
+
+  static void EmitUpdate(Napi::Env env, Napi::Function emit, PickerSession* session) {
+    // the pixels reference comes along, the next colour gets its own
+    PickerColor color = std::move(session->inFlightColor);
+    SharedBuffer magnifierPixels = std::move(session->inFlightMagnifier);
+    clock::time_point since = session->inFlightSince;
+    {
+      std::lock_guard<std::mutex> lock(session->mutex);
+      session->inFlight = false;
+    }
+    session->wake.notify_one();
+
+    if (env == nullptr) {
+      return;
+    }
+
+    std::vector<napi_value> args;
+    args.push_back(Napi::String::New(env, "update"));
+    if (session->compactPayload) {
+      args.push_back(Napi::Number::New(env, color.rgba));
+      args.push_back(Napi::Number::New(env, color.cursor_x));
+      args.push_back(Napi::Number::New(env, color.cursor_y));
+      args.push_back(Napi::Number::New(env, (double) color.frame_id));
+    } else {
+      args.push_back(Napi::String::New(env, color.color));
+    }
+    if (session->emitPixels && !color.pixels.Empty()) {
+      args.push_back(PixelsBuffer(env, color.pixels.Detach()));
+      args.push_back(Napi::Number::New(env, color.pixels_width));
+      args.push_back(Napi::Number::New(env, color.pixels_height));
+    }
+    if (!magnifierPixels.Empty()) {
+      args.push_back(PixelsBuffer(env, magnifierPixels.Detach()));
+      args.push_back(Napi::Number::New(env, session->magnifier->Size()));
+    }
+    emit.Call(args);
+
+    PipelineStats::Global().Add(PipelineStage::EMIT, clock::now() - since);
+    PipelineStats::Global().Count(PipelineCounter::EMITTED);
+  }
+
+  // the pool buffer itself as a Node Buffer, given back to the pool once
+  // JS collects it; takes over the reference
+  static Napi::Value PixelsBuffer(Napi::Env env, BufferPool::Buffer* buffer) {
+    try {
+      return Napi::Buffer<uint8_t>::New(env, buffer->Data(), buffer->Size(),
+        [](Napi::Env, uint8_t*, BufferPool::Buffer* buffer) {
+          buffer->Release();
+        }, buffer);
+    } catch (const Napi::Error&) {
+      // runtimes refusing external memory (Electron's V8 sandbox) get a copy
+      Napi::Value copy = Napi::Buffer<uint8_t>::Copy(env, buffer->Data(), buffer->Size());
+      buffer->Release();
+      return copy;
+    }
+  }
+};
+
+// init() and start() of a session: the pick is on its own threads once
+// this returns, warm is the session picking or none
+static Napi::Promise StartPick(Napi::Env env, Napi::Function emit, Napi::Object pickerParams,
+                               std::shared_ptr<WarmSession> warm) {
+  std::string source = pickerParams.Has("source")
+    ? (std::string) pickerParams.Get("source").ToString()
+    : "screen";
+  std::string color = (std::string) pickerParams.Get("previousColor").ToString();
+
+  // everything JS is read here, the picker thread never touches it
+  std::unique_ptr<PickerSession> session(new PickerSession(env, color));
+  session->options = ReadPickerOptions(pickerParams);
+  session->colorTransform.reset(
+    CreateColorTransform(pickerParams, session->options.color_space));
+  session->options.color_transform = session->colorTransform.get();
+
+  if (source == "synthetic") {
+    if (warm) {
+      throw Napi::TypeError::New(env, "session: picks the screen only");
+    }
+    session->frameSource.reset(CreateSyntheticFrameSource(pickerParams));
+    session->frameSource->SetColorTransform(session->colorTransform.get());
+  }
+  session->pixelFormat = pickerParams.Has("pixelFormat")
+    ? (std::string) pickerParams.Get("pixelFormat").ToString()
+    : "rgba8";
+  session->compactPayload = pickerParams.Has("payload") &&
+    (std::string) pickerParams.Get("payload").ToString() == "compact";
+  session->emitPixels = pickerParams.Has("pixels") &&
+    pickerParams.Get("pixels").ToBoolean().Value();
+  if (pickerParams.Has("magnifier") && pickerParams.Get("magnifier").ToBoolean().Value()) {
+    session->magnifier.reset(
+      new MagnifierRaster(1, session->options.grid_number, session->options.grid_pixel));
+    session->magnifierPool = BufferPool::Create();
+    if (source == "synthetic" && session->pixelFormat == "rgb10a2") {
+      session->renderMagnifier = RenderMagnifierOf<PixelRGB10A2>;
+    } else if (source == "synthetic" && session->pixelFormat == "rgba16f") {
+      session->renderMagnifier = RenderMagnifierOf<PixelRGBA16F>;
+    } else {
+      session->renderMagnifier = RenderMagnifierOf<ScreenPixel>;
+    }
+  }
+  if (pickerParams.Has("maxUpdateRate")) {
+    double rate = pickerParams.Get("maxUpdateRate").ToNumber().DoubleValue();
+    if (rate > 0) {
+      session->minUpdateInterval = std::chrono::duration_cast<PickerSession::clock::duration>(
+        std::chrono::duration<double>(1.0 / rate));
+    }
+  }
+
+#if defined(__linux__)
+  // from here on the pick is the context's till Finish()
+  if (warm) {
+    if (!warm->context->Begin()) {
+      throw Napi::Error::New(env, "session: a pick is running");
+    }
+    warm->running = true;
+    session->warm = warm;
+  }
+#endif
+
+  try {
+    emit.Call({
+      Napi::String::New(env, "start")
+    });
+
+    emit.Call({
+      Napi::String::New(env, "update"),
+      Napi::String::New(env, color)
+    });
+
+    // start picker here.
+
+    session->emitFunction = Napi::Persistent(emit);
+    session->emit = Napi::ThreadSafeFunction::New(
+      env, emit, "native-picker", 0, 1, session.get(), PickerSession::Finish);
+  } catch (...) {
+    // a throwing callback: no Finish() will come, the session picks again
+#if defined(__linux__)
+    if (warm) {
+      warm->context->End();
+      warm->running = false;
+    }
+#endif
+    throw;
+  }
+
+  // from now on the session is Finish()'s to delete
+  PickerSession* running = session.release();
+  Napi::Promise promise = running->deferred.Promise();
+  try {
+    running->emitThread = std::thread(&PickerSession::EmitLoop, running);
+  } catch (const std::exception& exception) {
+    running->error = exception.what();
+    running->emit.Release();
+    return promise;
+  }
+  try {
+    running->thread = std::thread(&PickerSession::Run, running);
+  } catch (const std::exception& exception) {
+    running->error = exception.what();
+    running->Done();
+  }
+
+  // end picker in Finish().
+
+  return promise;
+}
 
 Napi::Value addon::Init(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
@@ -7,28 +640,275 @@ Napi::Value addon::Init(const Napi::CallbackInfo& info) {
   Napi::Function emit = info[0].As<Napi::Function>();
   Napi::Object pickerParams = info[1].As<Napi::Object>();
 
-  emit.Call({
-    Napi::String::New(env, "start")
-  });
+  return StartPick(env, emit, pickerParams, nullptr);
+}
+
+// a picker kept warm across picks: the X connections, shared segment,
+// display profile and frame buffers are opened here once, start() then
+// picks like init() without opening anything, stop() cancels the running
+// pick, close() lets the backend go
+Napi::Value addon::CreateSession(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
 
-  // start picker here.
+#if defined(__linux__)
+  typedef std::chrono::steady_clock clock;
 
-  std::string color = (std::string) pickerParams.Get("previousColor").ToString();
+  auto openStart = clock::now();
+  std::shared_ptr<WarmSession> warm(new WarmSession());
+  try {
+    warm->context.reset(new PickerContext());
+  } catch (const std::exception& error) {
+    throw Napi::Error::New(env, error.what());
+  }
+  double openMs = std::chrono::duration<double, std::milli>(clock::now() - openStart).count();
 
-  emit.Call({
-    Napi::String::New(env, "update"),
-    Napi::String::New(env, color)
-  });
+  Napi::Object session = Napi::Object::New(env);
+  session.Set("openMs", Napi::Number::New(env, openMs));
 
-  Picker(NULL, NULL, NULL, 1);
+  session.Set("start", Napi::Function::New(env, [warm](const Napi::CallbackInfo& info) -> Napi::Value {
+    Napi::Env env = info.Env();
+    if (warm->closed) {
+      throw Napi::Error::New(env, "session: closed");
+    }
+    if (warm->running) {
+      throw Napi::Error::New(env, "session: a pick is running");
+    }
+    Napi::Function emit = info[0].As<Napi::Function>();
+    Napi::Object pickerParams = info.Length() > 1 && info[1].IsObject()
+      ? info[1].As<Napi::Object>()
+      : Napi::Object::New(env);
+    return StartPick(env, emit, pickerParams, warm);
+  }));
 
-  // end picker here.
+  session.Set("stop", Napi::Function::New(env, [warm](const Napi::CallbackInfo& info) -> Napi::Value {
+    if (warm->running) {
+      warm->context->Stop();
+    }
+    return info.Env().Undefined();
+  }));
 
-  emit.Call({
-    Napi::String::New(env, "end")
-  });
+  session.Set("close", Napi::Function::New(env, [warm](const Napi::CallbackInfo& info) -> Napi::Value {
+    warm->closed = true;
+    if (warm->running) {
+      warm->context->Stop();
+    } else {
+      warm->context.reset();
+    }
+    return info.Env().Undefined();
+  }));
+
+  return session;
+#else
+  throw Napi::Error::New(env, "createSession: no screen capture on this platform");
+#endif
+}
+
+// the colours of many points in one go: planned into a few captures
+// rather than one per point, see PointSampler; a Uint32Array of
+// 0xRRGGBBAA, 0 for the points outside of the screen
+Napi::Value addon::PickMany(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
 
-  return Napi::Boolean::New(env, true);
+  Napi::Array pointList = info[0].As<Napi::Array>();
+  Napi::Object pickerParams = info.Length() > 1 && info[1].IsObject()
+    ? info[1].As<Napi::Object>()
+    : Napi::Object::New(env);
+
+  std::vector<SamplePoint> points(pointList.Length());
+  for (uint32_t i = 0; i < pointList.Length(); i++) {
+    Napi::Object point = pointList.Get(i).As<Napi::Object>();
+    points[i].x = point.Get("x").ToNumber().Int32Value();
+    points[i].y = point.Get("y").ToNumber().Int32Value();
+  }
+
+  PickerOptions options = ReadPickerOptions(pickerParams);
+  std::unique_ptr<ColorTransform> colorTransform(
+    CreateColorTransform(pickerParams, options.color_space));
+  options.color_transform = colorTransform.get();
+
+  Napi::Uint32Array colors = Napi::Uint32Array::New(env, points.size());
+
+  std::string source = pickerParams.Has("source")
+    ? (std::string) pickerParams.Get("source").ToString()
+    : "screen";
+  if (source == "synthetic") {
+    std::unique_ptr<FrameSource> frameSource(CreateSyntheticFrameSource(pickerParams));
+    frameSource->SetColorTransform(colorTransform.get());
+    PointSampler sampler(frameSource.get());
+    if (!sampler.Sample(points.data(), (int) points.size(), colors.Data())) {
+      throw Napi::Error::New(env, "pickMany: capture failed");
+    }
+  } else {
+#if defined(__linux__)
+    if (!PickPoints(points.data(), (int) points.size(), colors.Data(), options)) {
+      throw Napi::Error::New(env, "pickMany: capture failed");
+    }
+#else
+    throw Napi::Error::New(env, "pickMany: no screen capture on this platform");
+#endif
+  }
+
+  return colors;
+}
+
+// a region for sample() and sampleAsync(): the arguments are read on the
+// JS thread, Run() may go anywhere
+struct SampleRequest {
+  int left = 0, top = 0, width = 0, height = 0;
+  PickerOptions options;
+  std::unique_ptr<ColorTransform> colorTransform;
+  // the synthetic source, the warm screen context without one
+  std::unique_ptr<FrameSource> frameSource;
+
+  bool Run(uint32_t* colors) {
+    if (frameSource) {
+      PointSampler sampler(frameSource.get());
+      return sampler.SampleRegion(left, top, width, height, colors);
+    }
+#if defined(__linux__)
+    return SampleRegion(left, top, width, height, colors, options);
+#else
+    return false;
+#endif
+  }
+};
+
+static SampleRequest* ReadSampleRequest(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  std::unique_ptr<SampleRequest> request(new SampleRequest());
+  request->left = info[0].ToNumber().Int32Value();
+  request->top = info[1].ToNumber().Int32Value();
+  request->width = info[2].ToNumber().Int32Value();
+  request->height = info[3].ToNumber().Int32Value();
+  if (request->width <= 0 || request->height <= 0 ||
+      int64_t(request->width) * request->height > (int64_t(1) << 28)) {
+    throw Napi::RangeError::New(env, "sample: bad region size");
+  }
+
+  Napi::Object pickerParams = info.Length() > 4 && info[4].IsObject()
+    ? info[4].As<Napi::Object>()
+    : Napi::Object::New(env);
+  request->options = ReadPickerOptions(pickerParams);
+  request->colorTransform.reset(
+    CreateColorTransform(pickerParams, request->options.color_space));
+  request->options.color_transform = request->colorTransform.get();
+
+  if (pickerParams.Has("source") &&
+      (std::string) pickerParams.Get("source").ToString() == "synthetic") {
+    request->frameSource.reset(CreateSyntheticFrameSource(pickerParams));
+    request->frameSource->SetColorTransform(request->colorTransform.get());
+  }
+#if !defined(__linux__)
+  if (!request->frameSource) {
+    throw Napi::Error::New(env, "sample: no screen capture on this platform");
+  }
+#endif
+
+  return request.release();
+}
+
+// the pixels of a region, no picker session: a Uint32Array of
+// width*height 0xRRGGBBAA, row by row, 0 off the screen
+Napi::Value addon::Sample(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  std::unique_ptr<SampleRequest> request(ReadSampleRequest(info));
+  Napi::Uint32Array colors = Napi::Uint32Array::New(env,
+    size_t(request->width) * request->height);
+  if (!request->Run(colors.Data())) {
+    throw Napi::Error::New(env, "sample: capture failed");
+  }
+  return colors;
+}
+
+// sample() on the libuv pool: the array is allocated here and filled
+// there, JS only sees it once the promise resolves
+class SampleWorker : public Napi::AsyncWorker {
+public:
+  SampleWorker(Napi::Env env, std::unique_ptr<SampleRequest> request, Napi::Uint32Array colors)
+    : Napi::AsyncWorker(env),
+      deferred(Napi::Promise::Deferred::New(env)),
+      request(std::move(request)),
+      colorsReference(Napi::Persistent(colors)),
+      colors(colors.Data()) {}
+
+  Napi::Promise::Deferred deferred;
+
+  void Execute() override {
+    if (!request->Run(colors)) {
+      SetError("sample: capture failed");
+    }
+  }
+
+  void OnOK() override {
+    deferred.Resolve(colorsReference.Value());
+  }
+
+  void OnError(const Napi::Error& error) override {
+    deferred.Reject(error.Value());
+  }
+
+private:
+  std::unique_ptr<SampleRequest> request;
+  Napi::Reference<Napi::Uint32Array> colorsReference;
+  uint32_t* colors;
+};
+
+Napi::Value addon::SampleAsync(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  std::unique_ptr<SampleRequest> request(ReadSampleRequest(info));
+  Napi::Uint32Array colors = Napi::Uint32Array::New(env,
+    size_t(request->width) * request->height);
+
+  // the worker takes the request and deletes itself once settled
+  SampleWorker* worker = new SampleWorker(env, std::move(request), colors);
+  Napi::Promise promise = worker->deferred.Promise();
+  worker->Queue();
+  return promise;
+}
+
+// the latencies of every stage and the frame counts since the process
+// started or the last reset, in microseconds; cheap enough to poll in
+// production: { stages: { cursor: { count, mean, p50, p95, p99, max }, ...
+// }, frames: { ticks, captures, published, presented, emitted } }
+Napi::Value addon::GetStats(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  PipelineStats& stats = PipelineStats::Global();
+
+  Napi::Object stages = Napi::Object::New(env);
+  for (int i = 0; i < int(PipelineStage::COUNT); i++) {
+    const LatencyHistogram& histogram = stats.Stage(PipelineStage(i));
+    Napi::Object stage = Napi::Object::New(env);
+    stage.Set("count", Napi::Number::New(env, (double) histogram.Count()));
+    stage.Set("mean", Napi::Number::New(env, histogram.MeanMicroseconds()));
+    stage.Set("p50", Napi::Number::New(env, histogram.PercentileMicroseconds(0.50)));
+    stage.Set("p95", Napi::Number::New(env, histogram.PercentileMicroseconds(0.95)));
+    stage.Set("p99", Napi::Number::New(env, histogram.PercentileMicroseconds(0.99)));
+    stage.Set("max", Napi::Number::New(env, histogram.MaxMicroseconds()));
+    stages.Set(PipelineStageName(PipelineStage(i)), stage);
+  }
+
+  Napi::Object frames = Napi::Object::New(env);
+  for (int i = 0; i < int(PipelineCounter::COUNT); i++) {
+    frames.Set(PipelineCounterName(PipelineCounter(i)),
+      Napi::Number::New(env, (double) stats.Counter(PipelineCounter(i))));
+  }
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("stages", stages);
+  result.Set("frames", frames);
+
+  // getStats({ reset: true }) starts the next window from zero
+  if (info.Length() > 0 && info[0].IsObject()) {
+    Napi::Object params = info[0].As<Napi::Object>();
+    if (params.Has("reset") && params.Get("reset").ToBoolean().Value()) {
+      stats.Reset();
+    }
+  }
+
+  return result;
 }
 
 Napi::Object Init(Napi::Env env, Napi::Object exports) {
@@ -36,8 +916,28 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
     Napi::String::New(env, "init"),
     Napi::Function::New(env, addon::Init)
   );
+  exports.Set(
+    Napi::String::New(env, "pickMany"),
+    Napi::Function::New(env, addon::PickMany)
+  );
+  exports.Set(
+    Napi::String::New(env, "sample"),
+    Napi::Function::New(env, addon::Sample)
+  );
+  exports.Set(
+    Napi::String::New(env, "sampleAsync"),
+    Napi::Function::New(env, addon::SampleAsync)
+  );
+  exports.Set(
+    Napi::String::New(env, "createSession"),
+    Napi::Function::New(env, addon::CreateSession)
+  );
+  exports.Set(
+    Napi::String::New(env, "getStats"),
+    Napi::Function::New(env, addon::GetStats)
+  );
 
   return exports;
 }
 
-NODE_API_MODULE(picker, Init)
\ No newline at end of file
+NODE_API_MODULE(picker, Init)
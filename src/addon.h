@@ -5,10 +5,18 @@
   #define WIN32_LEAN_AND_MEAN
   #include <Windows.h>
   #include "windows/Picker.h"
+#elif defined(__linux__)
+  #include "linux/Picker.h"
+  #include "linux/PickerContext.h"
 #endif
 
 namespace addon {
     Napi::Value Init(const Napi::CallbackInfo& info);
+    Napi::Value PickMany(const Napi::CallbackInfo& info);
+    Napi::Value Sample(const Napi::CallbackInfo& info);
+    Napi::Value SampleAsync(const Napi::CallbackInfo& info);
+    Napi::Value CreateSession(const Napi::CallbackInfo& info);
+    Napi::Value GetStats(const Napi::CallbackInfo& info);
 }
 
 Napi::Object Init(Napi::Env env, Napi::Object exports);
\ No newline at end of file
@@ -0,0 +1,485 @@
+#include "Picker.h"
+#include "ScreenLens.h"
+#include "PickerContext.h"
+
+#include <X11/keysym.h>
+
+#include <poll.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+
+#include <cmath>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <cstdio>
+#include <memory>
+
+#include "../PickerPipeline.h"
+#include "../IdleGovernor.h"
+#include "../TripleBuffer.h"
+#include "../parameters.h"
+
+
+typedef class TripleBuffer<struct PickerFrame<ScreenPixel>> PickerFrameBuffer;
+
+
+//! to stdout while the pick may still be taken, to stderr once cancelled
+static void
+PrintPixelColor(const char* color, bool should_log_out_central_pixel_color)
+{
+    if( should_log_out_central_pixel_color == true )
+    {
+        fprintf(stdout, "%s\n", color);
+    }
+    else
+    {
+        fprintf(stderr, "%s\n", color);
+    }
+}
+
+
+//! the grabbed pointer and keyboard, returns false once the pick is over;
+//! cancelled is set when it ended without a colour
+static bool
+DispatchInputEvents(Display* display, bool* const cancelled)
+{
+    while( ::XPending(display) > 0 )
+    {
+        XEvent event;
+        ::XNextEvent(display, &event);
+
+        switch(event.type)
+        {
+        case ButtonRelease:
+        {
+            fprintf(stderr, "Mouse Button Up\n");
+            return false;
+        }
+        case KeyPress:
+        {
+            auto key = ::XLookupKeysym(&event.xkey, 0);
+            fprintf(stderr, "Key Down %lu\n", key);
+
+            if( key == XK_Escape )
+            {
+                *cancelled = true;
+                return false;
+            }
+            if( key == XK_Return || key == XK_KP_Enter || key == XK_space )
+            {
+                return false;
+            }
+        }
+        break;
+        default:
+        break;
+        }
+    }
+    return true;
+}
+
+
+//! motion and damage of the capture connection
+static void
+DispatchCaptureEvents(class ScreenLens& screen_lens)
+{
+    auto display = screen_lens.NativeDisplay();
+
+    while( ::XPending(display) > 0 )
+    {
+        XEvent event;
+        ::XNextEvent(display, &event);
+
+        if( false == screen_lens.ProcessMotionEvent(event) )
+        {
+            screen_lens.ProcessDamageEvent(event);
+        }
+    }
+}
+
+
+static void
+SignalEvent(int event_fd)
+{
+    const uint64_t one = 1;
+    if( sizeof(one) != ::write(event_fd, &one, sizeof(one)) )
+    {
+        //! the counter is non zero already, the reader wakes anyway
+    }
+}
+
+
+static void
+DrainEvent(int event_fd)
+{
+    uint64_t count = 0;
+    if( sizeof(count) != ::read(event_fd, &count, sizeof(count)) )
+    {
+        //! nothing signalled, EAGAIN
+    }
+}
+
+
+//! until an event is queued, event_fd is signalled or deadline, whichever
+//! comes first
+static void
+WaitForEvents
+(
+    Display* display,
+    int event_fd,
+    std::chrono::steady_clock::time_point deadline
+)
+{
+    //! XPending() also flushes, and sees what Xlib read already
+    if( ::XPending(display) > 0 )
+    {
+        return;
+    }
+
+    int timeout_ms = -1;
+    if( deadline != std::chrono::steady_clock::time_point::max() )
+    {
+        const auto timeout = deadline - std::chrono::steady_clock::now();
+        if( timeout <= std::chrono::steady_clock::duration::zero() )
+        {
+            return;
+        }
+        timeout_ms = int(std::ceil( \
+                std::chrono::duration<double, std::milli>(timeout).count()));
+    }
+
+    struct pollfd fds[2] = {};
+    fds[0].fd = ConnectionNumber(display);
+    fds[0].events = POLLIN;
+    fds[1].fd = event_fd;
+    fds[1].events = POLLIN;
+    ::poll(fds, 2, timeout_ms);
+}
+
+
+//! the capture thread: ticks the pipeline as the governor lets it and
+//! publishes every changed frame, until stop_fd is signalled or a tick
+//! fails, which sets failed
+static void
+CaptureLoop
+(
+    class ScreenLens& screen_lens,
+    class PickerPipeline<ScreenPixel>& pipeline,
+    class IdleGovernor& governor,
+    PickerFrameBuffer& frames,
+    int frame_ready_fd,
+    int stop_fd,
+    const std::atomic<bool>& stopping,
+    std::atomic<bool>& failed
+)
+{
+    auto display = screen_lens.NativeDisplay();
+
+    while( stopping.load(std::memory_order_relaxed) == false )
+    {
+        WaitForEvents(display, stop_fd, governor.NextIdleTick());
+        DispatchCaptureEvents(screen_lens);
+
+        //! anything else (a ShmCompletion, the stop) is no reason to tick
+        const bool woken = screen_lens.TakeActivity();
+        if( stopping.load(std::memory_order_relaxed) || ( woken == false && \
+            std::chrono::steady_clock::now() < governor.NextIdleTick() ) )
+        {
+            continue;
+        }
+
+        const auto start = governor.Admit(std::chrono::steady_clock::now());
+        std::this_thread::sleep_until(start);
+
+        if( false == pipeline.Tick() )
+        {
+            //! the pointer left the screen, the server went away
+            fprintf(stderr, "%s Error 0\n", __PRETTY_FUNCTION__);
+            failed.store(true, std::memory_order_relaxed);
+            break;
+        }
+        if( pipeline.FrameChanged() )
+        {
+            auto& frame = frames.Back();
+            pipeline.Snapshot(&frame);
+            frame.tick_start = start;
+            frame.published = std::chrono::steady_clock::now();
+            frames.Publish();
+            PipelineStats::Global().Count(PipelineCounter::PUBLISHED);
+            SignalEvent(frame_ready_fd);
+        }
+        pipeline.Prefetch();
+
+        governor.TickDone(start, std::chrono::steady_clock::now() - start, \
+                          pipeline.FrameChanged());
+    }
+
+    SignalEvent(frame_ready_fd);
+}
+
+
+int Picker (
+    int screenMode,
+    const struct PickerOptions& options,
+    class PickerListener* listener,
+    class PickerContext* context
+) {
+    fprintf(stderr, "%s\n", __PRETTY_FUNCTION__);
+
+    std::unique_ptr<class PickerContext> cold_context;
+    if( context == nullptr )
+    {
+        try
+        {
+            cold_context.reset(new class PickerContext);
+        }
+        catch(const std::exception& error)
+        {
+            fprintf(stderr, "%s Error 0: %s\n", __PRETTY_FUNCTION__, error.what());
+            return 1;
+        }
+        context = cold_context.get();
+        context->Begin();
+    }
+
+    auto& screen_lens = context->Lens();
+    auto display = context->NativeDisplay();
+    auto root_window = DefaultRootWindow(display);
+
+    auto color_transform = options.color_transform;
+    if( color_transform == nullptr )
+    {
+        color_transform = context->DisplayColorTransform(options.color_space);
+    }
+    screen_lens.SetColorTransform(color_transform);
+
+    class PickerPipeline<ScreenPixel> pipeline(&screen_lens, options, \
+                                                context->SnapshotPool());
+    fprintf(stderr, "screen record size: %4d %4d\n", \
+                    pipeline.CaptureWidth(), pipeline.CaptureHeight());
+
+    //! of this pick only, concurrent picks and samples have their own
+    bool cancelled = false;
+
+    const int stop_fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if( stop_fd < 0 )
+    {
+        fprintf(stderr, "%s Error 2\n", __PRETTY_FUNCTION__);
+        context->End();
+        return 1;
+    }
+
+    if( GrabSuccess != ::XGrabPointer(display, root_window, False, \
+                        ButtonPressMask | ButtonReleaseMask, \
+                        GrabModeAsync, GrabModeAsync, \
+                        None, context->CrossCursor(), CurrentTime) )
+    {
+        fprintf(stderr, "%s Error 1\n", __PRETTY_FUNCTION__);
+    }
+    ::XGrabKeyboard(display, root_window, False, \
+                        GrabModeAsync, GrabModeAsync, CurrentTime);
+
+    //! motion and damage wake the capture thread, without them it backs
+    //! off; a server without XInput2 keeps being polled at the full rate
+    class IdleGovernor governor(options.cpu_budget, screen_lens.ReportsMotion() ? \
+                                IDLE_REFRESH_FREQUENCY : CURSOR_REFRESH_FREQUENCY);
+
+    //! frames go through the triple buffer, eventfds only wake the sides;
+    //! the context one also wakes this side on Stop()
+    PickerFrameBuffer frames;
+    const int frame_ready_fd = context->WakeFd();
+    std::atomic<bool> stopping(false), capture_failed(false);
+
+    std::thread capture_thread(CaptureLoop, std::ref(screen_lens), std::ref(pipeline), \
+                    std::ref(governor), std::ref(frames), frame_ready_fd, stop_fd, \
+                    std::cref(stopping), std::ref(capture_failed));
+
+    class FrameLatency capture_latency, hand_off_latency, present_latency;
+    auto present = [&]()
+    {
+        const auto& frame = frames.Front();
+        if( listener != nullptr )
+        {
+            listener->Update(frame.Color());
+        }
+        else
+        {
+            PrintPixelColor(frame.color, cancelled == false);
+        }
+
+        PipelineStats::Global().Count(PipelineCounter::PRESENTED);
+
+        const auto presented = std::chrono::steady_clock::now();
+        capture_latency.Add(frame.published - frame.tick_start);
+        hand_off_latency.Add(presented - frame.published);
+        present_latency.Add(presented - frame.tick_start);
+    };
+
+    while( DispatchInputEvents(display, &cancelled) )
+    {
+        if( context->StopRequested() )
+        {
+            //! as if cancelled
+            cancelled = true;
+            break;
+        }
+
+        WaitForEvents(display, frame_ready_fd, \
+                            std::chrono::steady_clock::time_point::max());
+        DrainEvent(frame_ready_fd);
+
+        if( frames.Update() )
+        {
+            present();
+        }
+
+        //! no more frames will come, the pick ends without a colour
+        if( capture_failed.load(std::memory_order_relaxed) )
+        {
+            cancelled = true;
+            break;
+        }
+    }
+
+    stopping.store(true, std::memory_order_relaxed);
+    SignalEvent(stop_fd);
+    capture_thread.join();
+
+    ::XUngrabKeyboard(display, CurrentTime);
+    ::XUngrabPointer(display, CurrentTime);
+    ::XSync(display, False);
+
+    ::close(stop_fd);
+
+    if( options.log_statistics )
+    {
+        pipeline.LogStatistics();
+        governor.LogStatistics();
+        fprintf(stderr, "frames published %llu, presented %llu, replaced unseen %llu\n", \
+                    (unsigned long long)frames.PublishedCount(), \
+                    (unsigned long long)frames.ConsumedCount(), \
+                    (unsigned long long)frames.DroppedCount());
+        capture_latency.LogStatistics("capture");
+        hand_off_latency.LogStatistics("hand-off");
+        present_latency.LogStatistics("capture->present");
+    }
+
+    frames.Update();
+    if( frames.Front().id != 0 )
+    {
+        if( listener == nullptr )
+        {
+            PrintPixelColor(frames.Front().color, cancelled == false);
+        }
+        else if( cancelled == false )
+        {
+            listener->Pick(frames.Front().color);
+        }
+    }
+
+    context->End();
+    return capture_failed.load(std::memory_order_relaxed) ? 2 : 0;
+}
+
+
+//! what PickPoints() and SampleRegion() capture through: opened by the
+//! first call and kept for the next ones, so a call costs no connection,
+//! no segment and no profile lookup, only the capture itself
+static struct
+{
+    std::mutex mutex;
+    std::unique_ptr<class ScreenLens> screen_lens;
+    std::unique_ptr<class PointSampler> point_sampler;
+    std::unique_ptr<class ColorTransform> display_color_transform;
+    TargetColorSpace color_space = TargetColorSpace::SRGB;
+} warm_screen;
+
+
+//! the warm sampler for options, nullptr when the screen cannot be
+//! captured; the mutex of warm_screen is the caller's
+static class PointSampler*
+WarmPointSampler
+(
+    const struct PickerOptions& options
+)
+{
+    if( warm_screen.screen_lens == nullptr )
+    {
+        //! before any other Xlib call, Picker() may run on another thread
+        ::XInitThreads();
+        try
+        {
+            warm_screen.screen_lens.reset(new class ScreenLens(nullptr, false));
+        }
+        catch(const std::exception& error)
+        {
+            fprintf(stderr, "%s Error 0: %s\n", __PRETTY_FUNCTION__, error.what());
+            return nullptr;
+        }
+        warm_screen.point_sampler.reset( \
+                        new class PointSampler(warm_screen.screen_lens.get()));
+        warm_screen.display_color_transform.reset(CreateDisplayColorTransform( \
+                        *warm_screen.screen_lens, options.color_space));
+        warm_screen.color_space = options.color_space;
+    }
+    else if( warm_screen.color_space != options.color_space )
+    {
+        warm_screen.display_color_transform.reset(CreateDisplayColorTransform( \
+                        *warm_screen.screen_lens, options.color_space));
+        warm_screen.color_space = options.color_space;
+    }
+
+    warm_screen.screen_lens->SetColorTransform(options.color_transform != nullptr ? \
+                options.color_transform : warm_screen.display_color_transform.get());
+    return warm_screen.point_sampler.get();
+}
+
+
+bool PickPoints (
+    const struct SamplePoint* points,
+    int count,
+    uint32_t* colors,
+    const struct PickerOptions& options
+) {
+    std::lock_guard<std::mutex> lock(warm_screen.mutex);
+
+    auto point_sampler = WarmPointSampler(options);
+    if( point_sampler == nullptr )
+    {
+        fprintf(stderr, "%s Error 0\n", __PRETTY_FUNCTION__);
+        return false;
+    }
+    if( false == point_sampler->Sample(points, count, colors) )
+    {
+        fprintf(stderr, "%s Error 1\n", __PRETTY_FUNCTION__);
+        return false;
+    }
+    return true;
+}
+
+
+bool SampleRegion (
+    int left,
+    int top,
+    int width,
+    int height,
+    uint32_t* colors,
+    const struct PickerOptions& options
+) {
+    std::lock_guard<std::mutex> lock(warm_screen.mutex);
+
+    auto point_sampler = WarmPointSampler(options);
+    if( point_sampler == nullptr )
+    {
+        fprintf(stderr, "%s Error 0\n", __PRETTY_FUNCTION__);
+        return false;
+    }
+    if( false == point_sampler->SampleRegion(left, top, width, height, colors) )
+    {
+        fprintf(stderr, "%s Error 1\n", __PRETTY_FUNCTION__);
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "../PickerOptions.h"
+#include "../PickerListener.h"
+#include "../PointSampler.h"
+
+//! blocks until the pick is over; the colours go to listener, or to stdout
+//! without one. context: a warm one the caller Begin()s, see PickerContext,
+//! nullptr opens and closes one for this pick only. 0 once picked or
+//! cancelled, 1 when the display or the capture could not be opened, 2
+//! when capturing failed during the pick
+int Picker (
+    int screenMode,
+    const struct PickerOptions& options = {},
+    class PickerListener* listener = nullptr,
+    class PickerContext* context = nullptr
+);
+
+//! colors[idx], 0xRRGGBBAA, of points[idx] on the screen, through the
+//! display profile like Picker(); false when the screen cannot be captured.
+//! Both this and SampleRegion() reuse one capture context, opened by the
+//! first call, from any thread
+bool PickPoints (
+    const struct SamplePoint* points,
+    int count,
+    uint32_t* colors,
+    const struct PickerOptions& options = {}
+);
+
+//! colors[y*width + x], 0xRRGGBBAA, of the width*height region at (left,
+//! top), 0 off the screen; false when the screen cannot be captured
+bool SampleRegion (
+    int left,
+    int top,
+    int width,
+    int height,
+    uint32_t* colors,
+    const struct PickerOptions& options = {}
+);
@@ -0,0 +1,167 @@
+#include "PickerContext.h"
+
+#include <X11/cursorfont.h>
+
+#include <unistd.h>
+#include <sys/eventfd.h>
+
+#include <cstdio>
+#include <vector>
+#include <stdexcept>
+
+#include "../ColorProfile.h"
+
+
+class ColorTransform*
+CreateDisplayColorTransform
+(
+    const class ScreenLens& screen_lens,
+    TargetColorSpace color_space
+)
+{
+    std::vector<uint8_t> profile_data;
+    if( false == screen_lens.DisplayColorProfile(&profile_data) )
+    {
+        fprintf(stderr, "display color profile: none\n");
+        return nullptr;
+    }
+
+    try
+    {
+        class ColorProfile profile(profile_data.data(), profile_data.size());
+        return new class ColorTransform(profile, color_space);
+    }
+    catch(const std::exception& error)
+    {
+        fprintf(stderr, "display color profile ignored: %s\n", error.what());
+        return nullptr;
+    }
+}
+
+
+PickerContext::PickerContext()
+{
+    fprintf(stderr, "%s\n", __PRETTY_FUNCTION__);
+
+    //! one connection per thread: the capture one (motion, damage, the
+    //! shared segment) and this one (the grabs)
+    ::XInitThreads();
+
+    screen_lens_ = new class ScreenLens;
+    //! listens again on Begin()
+    screen_lens_->SuspendActivity();
+
+    display_ = ::XOpenDisplay(nullptr);
+    if( display_ == nullptr )
+    {
+        delete screen_lens_;
+        fprintf(stderr, "PickerContext Constructor Error 0\n");
+        throw std::runtime_error("PickerContext Constructor Error 0");
+    }
+
+    wake_fd_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if( wake_fd_ < 0 )
+    {
+        ::XCloseDisplay(display_);
+        delete screen_lens_;
+        fprintf(stderr, "PickerContext Constructor Error 1\n");
+        throw std::runtime_error("PickerContext Constructor Error 1");
+    }
+
+    cross_cursor_ = ::XCreateFontCursor(display_, XC_crosshair);
+    buffer_pool_ = BufferPool::Create();
+}
+
+
+PickerContext::~PickerContext()
+{
+    fprintf(stderr, "%s\n", __PRETTY_FUNCTION__);
+
+    ::XFreeCursor(display_, cross_cursor_);
+    ::XCloseDisplay(display_);
+    ::close(wake_fd_);
+
+    delete screen_lens_;
+}
+
+
+const class ColorTransform*
+PickerContext::DisplayColorTransform
+(
+    TargetColorSpace color_space
+)
+{
+    if( has_looked_up_profile_ == false || color_space_ != color_space )
+    {
+        display_color_transform_.reset(CreateDisplayColorTransform( \
+                                            *screen_lens_, color_space));
+        color_space_ = color_space;
+        has_looked_up_profile_ = true;
+    }
+    return display_color_transform_.get();
+}
+
+
+bool
+PickerContext::Begin()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if( picking_ )
+        {
+            fprintf(stderr, "%s Error 0\n", __PRETTY_FUNCTION__);
+            return false;
+        }
+        picking_ = true;
+        stop_requested_ = false;
+    }
+
+    //! a wake left over from the last pick would only cost a spurious tick
+    uint64_t count = 0;
+    if( sizeof(count) != ::read(wake_fd_, &count, sizeof(count)) )
+    {
+        //! nothing signalled, EAGAIN
+    }
+
+    screen_lens_->ResumeActivity();
+    pick_count_ += 1;
+    return true;
+}
+
+
+void
+PickerContext::End()
+{
+    screen_lens_->SuspendActivity();
+    ::XSync(display_, True);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    picking_ = false;
+    stop_requested_ = false;
+}
+
+
+void
+PickerContext::Stop()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if( picking_ == false )
+    {
+        return;
+    }
+    stop_requested_ = true;
+
+    const uint64_t one = 1;
+    if( sizeof(one) != ::write(wake_fd_, &one, sizeof(one)) )
+    {
+        //! the counter is non zero already, the pick wakes anyway
+    }
+}
+
+
+bool
+PickerContext::StopRequested()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stop_requested_;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <X11/Xlib.h>
+
+#include <mutex>
+#include <memory>
+
+#include "ScreenLens.h"
+#include "../BufferPool.h"
+#include "../ColorTransform.h"
+
+
+//! the display's own profile -> color_space, nullptr when it has none or
+//! the profile is not a matrix/TRC one
+class ColorTransform*
+CreateDisplayColorTransform
+(
+    const class ScreenLens& screen_lens,
+    TargetColorSpace color_space
+);
+
+
+//! What a pick opens on the X server and keeps from one pick to the next:
+//! the capture connection with its shared segment, DAMAGE and XInput2, the
+//! connection holding the grabs, the crosshair, the display profile and
+//! the snapshot buffers. Picker() opens one per call without it; a warm
+//! session opens it once and pays none of that on the following picks.
+//! One pick at a time: Begin() on the thread starting it, the pick ends
+//! with End(), Stop() may come from any thread in between.
+class PickerContext
+{
+public:
+    PickerContext();
+    ~PickerContext();
+private:
+    class ScreenLens* screen_lens_ = nullptr;
+    //! the grabs, the capture thread owns the other connection
+    Display* display_ = nullptr;
+    Cursor cross_cursor_ = 0;
+    std::shared_ptr<class BufferPool> buffer_pool_;
+private:
+    //! of the last colour space asked for, nullptr when the display has no
+    //! usable profile
+    std::unique_ptr<class ColorTransform> display_color_transform_;
+    TargetColorSpace color_space_ = TargetColorSpace::SRGB;
+    bool has_looked_up_profile_ = false;
+private:
+    //! signalled by the capture thread on every frame and by Stop()
+    int wake_fd_ = -1;
+    std::mutex mutex_;
+    bool picking_ = false;
+    bool stop_requested_ = false;
+    uint64_t pick_count_ = 0;
+public:
+    class ScreenLens& Lens() { return *screen_lens_; }
+    Display* NativeDisplay() const { return display_; }
+    Cursor CrossCursor() const { return cross_cursor_; }
+    const std::shared_ptr<class BufferPool>& SnapshotPool() const { return buffer_pool_; }
+    int WakeFd() const { return wake_fd_; }
+    //! the display's own profile -> color_space, looked up once
+    const class ColorTransform* DisplayColorTransform(TargetColorSpace color_space);
+public:
+    //! resumes the lens for a pick, false when one is running already
+    bool Begin();
+    //! suspends it again, the pick is over
+    void End();
+    //! ends the running pick as if cancelled, nothing when there is none
+    void Stop();
+    bool StopRequested();
+    uint64_t PickCount() const { return pick_count_; }
+};
@@ -0,0 +1,458 @@
+#include "ScreenLens.h"
+
+#include <sys/ipc.h>
+#include <sys/shm.h>
+
+#include <cstdio>
+#include <stdexcept>
+#include <algorithm>
+
+#include "ShmAttach.h"
+#include "../parameters.h"
+
+
+void
+GetCurrentCursorPosition
+(
+    Display* display,
+    int* const x, int* const y
+)
+{
+    Window root_return, child_return;
+    int root_x = 0, root_y = 0;
+    int window_x = 0, window_y = 0;
+    unsigned int mask_return = 0;
+
+    ::XQueryPointer(display, DefaultRootWindow(display), \
+                    &root_return, &child_return, \
+                    &root_x, &root_y, &window_x, &window_y, &mask_return);
+
+    *x = root_x;
+    *y = root_y;
+}
+
+
+ScreenLens::ScreenLens(const char* display_name, bool track_activity)
+{
+    fprintf(stderr, "%s\n", __PRETTY_FUNCTION__);
+
+    display_ = ::XOpenDisplay(display_name);
+    if( display_ == nullptr )
+    {
+        fprintf(stderr, "ScreenLens Constructor Error 0\n");
+        throw std::runtime_error("ScreenLens Constructor Error 0");
+    }
+
+    if( False == ::XShmQueryExtension(display_) )
+    {
+        ::XCloseDisplay(display_);
+        fprintf(stderr, "ScreenLens Constructor Error 1\n");
+        throw std::runtime_error("ScreenLens Constructor Error 1");
+    }
+
+    const auto screen = DefaultScreen(display_);
+    root_window_   = RootWindow(display_, screen);
+    visual_        = DefaultVisual(display_, screen);
+    depth_         = DefaultDepth(display_, screen);
+    screen_width_  = DisplayWidth(display_, screen);
+    screen_height_ = DisplayHeight(display_, screen);
+
+    //! the conversion below reads 8-bit B, G, R, X from 32 bits pixels
+    if( (depth_ != 24 && depth_ != 32) || visual_->red_mask != 0xFF0000 || \
+        visual_->green_mask != 0x00FF00 || visual_->blue_mask != 0x0000FF )
+    {
+        ::XCloseDisplay(display_);
+        fprintf(stderr, "ScreenLens Constructor Error 2 depth %d\n", depth_);
+        throw std::runtime_error("ScreenLens Constructor Error 2");
+    }
+
+    if( false == reserveSharedImage(CAPTURE_WIDTH, CAPTURE_HEIGHT) )
+    {
+        ::XCloseDisplay(display_);
+        fprintf(stderr, "ScreenLens Constructor Error 3\n");
+        throw std::runtime_error("ScreenLens Constructor Error 3");
+    }
+
+    if( track_activity == false )
+    {
+        return;
+    }
+
+    int damage_error_base = 0;
+    has_damage_ = True == ::XDamageQueryExtension(display_, \
+                            &damage_event_base_, &damage_error_base);
+    if( has_damage_ == false )
+    {
+        fprintf(stderr, "ScreenLens: no DAMAGE, capture every frame\n");
+    }
+
+    int xi_event_base = 0, xi_error_base = 0;
+    int xi_major = 2, xi_minor = 0;
+    has_xinput2_ = True == ::XQueryExtension(display_, "XInputExtension", \
+                            &xi_opcode_, &xi_event_base, &xi_error_base) && \
+                   Success == ::XIQueryVersion(display_, &xi_major, &xi_minor);
+
+    ResumeActivity();
+    if( reports_motion_ == false )
+    {
+        fprintf(stderr, "ScreenLens: no XInput2, poll the cursor\n");
+    }
+}
+
+
+ScreenLens::~ScreenLens()
+{
+    fprintf(stderr, "%s\n", __PRETTY_FUNCTION__);
+
+    if( damage_ != 0 )
+    {
+        ::XDamageDestroy(display_, damage_);
+        ::XDestroyRegion(damaged_region_);
+    }
+
+    releaseSharedImage();
+    releaseSharedSegment();
+
+    ::XCloseDisplay(display_);
+}
+
+
+bool
+ScreenLens::DisplayColorProfile
+(
+    std::vector<uint8_t>* const profile
+) const
+{
+    //! the ICC Profiles in X Specification: the colour manager (colord,
+    //! the desktop settings) puts the profile of the first screen on the
+    //! root window as a CARDINAL/8 property
+    auto profile_atom = ::XInternAtom(display_, "_ICC_PROFILE", True);
+    if( profile_atom == None )
+    {
+        return false;
+    }
+
+    Atom actual_type = None;
+    int actual_format = 0;
+    unsigned long item_count = 0, bytes_after = 0;
+    unsigned char* data = nullptr;
+    if( Success != ::XGetWindowProperty(display_, root_window_, profile_atom, \
+                        0, 0x7FFFFFFF/4, False, AnyPropertyType, &actual_type, \
+                        &actual_format, &item_count, &bytes_after, &data) )
+    {
+        return false;
+    }
+
+    const bool ok = data != nullptr && actual_format == 8 && item_count > 0;
+    if( ok )
+    {
+        profile->assign(data, data + item_count);
+    }
+    if( data != nullptr )
+    {
+        ::XFree(data);
+    }
+    return ok;
+}
+
+
+bool
+ScreenLens::ProcessDamageEvent
+(
+    const XEvent& event
+)
+{
+    if( damage_ == 0 || event.type != damage_event_base_ + XDamageNotify )
+    {
+        return false;
+    }
+
+    auto damage_event = reinterpret_cast<const XDamageNotifyEvent*>(&event);
+    auto area = damage_event->area;
+    ::XUnionRectWithRegion(&area, damaged_region_, damaged_region_);
+    damage_pending_ = true;
+    return true;
+}
+
+
+bool
+ScreenLens::ProcessMotionEvent
+(
+    const XEvent& event
+)
+{
+    //! the type is in the cookie header, the data is not needed: the
+    //! position is read by the next tick anyway
+    if( reports_motion_ == false || event.type != GenericEvent || \
+        event.xcookie.extension != xi_opcode_ || \
+        event.xcookie.evtype != XI_RawMotion )
+    {
+        return false;
+    }
+
+    motion_pending_ = true;
+    return true;
+}
+
+
+void
+ScreenLens::ResumeActivity()
+{
+    if( has_damage_ && damage_ == 0 )
+    {
+        damage_ = ::XDamageCreate(display_, root_window_, \
+                                            XDamageReportRawRectangles);
+        damaged_region_ = ::XCreateRegion();
+    }
+
+    //! raw events reach the root window whoever grabbed the pointer
+    if( has_xinput2_ && reports_motion_ == false )
+    {
+        unsigned char mask_bits[XIMaskLen(XI_RawMotion)] = {};
+        XISetMask(mask_bits, XI_RawMotion);
+
+        XIEventMask event_mask;
+        event_mask.deviceid = XIAllMasterDevices;
+        event_mask.mask_len = sizeof(mask_bits);
+        event_mask.mask = mask_bits;
+        reports_motion_ = Success == ::XISelectEvents(display_, \
+                                            root_window_, &event_mask, 1);
+    }
+
+    motion_pending_ = true;
+    damage_pending_ = true;
+}
+
+
+void
+ScreenLens::SuspendActivity()
+{
+    if( damage_ != 0 )
+    {
+        ::XDamageDestroy(display_, damage_);
+        ::XDestroyRegion(damaged_region_);
+        damage_ = 0;
+        damaged_region_ = nullptr;
+    }
+
+    if( reports_motion_ )
+    {
+        unsigned char mask_bits[XIMaskLen(XI_RawMotion)] = {};
+
+        XIEventMask event_mask;
+        event_mask.deviceid = XIAllMasterDevices;
+        event_mask.mask_len = sizeof(mask_bits);
+        event_mask.mask = mask_bits;
+        ::XISelectEvents(display_, root_window_, &event_mask, 1);
+        reports_motion_ = false;
+    }
+
+    //! whatever was queued before the server got the above is stale
+    ::XSync(display_, True);
+}
+
+
+bool
+ScreenLens::TakeActivity()
+{
+    const bool activity = motion_pending_ || damage_pending_ || \
+                          reports_motion_ == false;
+    motion_pending_ = false;
+    damage_pending_ = false;
+    return activity;
+}
+
+
+bool
+ScreenLens::IsDirtyWithinBound
+(
+    int central_x, int central_y,
+    int bound_width, int bound_height
+)
+{
+    if( damage_ == 0 )
+    {
+        return true;
+    }
+
+    //! pick up whatever the caller's event loop has not dispatched yet
+    XEvent event;
+    while( True == ::XCheckTypedEvent(display_, \
+                            damage_event_base_ + XDamageNotify, &event) )
+    {
+        ProcessDamageEvent(event);
+    }
+
+    const int bound_left = central_x - bound_width/2;
+    const int bound_top  = central_y - bound_height/2;
+
+    return RectangleOut != ::XRectInRegion(damaged_region_, \
+                        bound_left, bound_top, bound_width, bound_height);
+}
+
+
+bool
+ScreenLens::reserveSharedImage
+(
+    int width, int height
+)
+{
+    if( shm_image_ != nullptr && \
+        shm_image_->width == width && shm_image_->height == height )
+    {
+        return true;
+    }
+
+    releaseSharedImage();
+
+    //! the image header is cheap, the segment behind it is not, so only
+    //! the header follows the requested size and the segment only grows
+    shm_image_ = ::XShmCreateImage(display_, visual_, depth_, ZPixmap, \
+                            nullptr, &shm_segment_info_, width, height);
+    if( shm_image_ == nullptr )
+    {
+        fprintf(stderr, "%s Error 1\n", __PRETTY_FUNCTION__);
+        return false;
+    }
+
+    const size_t required_size = \
+                    size_t(shm_image_->bytes_per_line)*shm_image_->height;
+
+    if( required_size > shm_segment_size_ )
+    {
+        releaseSharedSegment();
+
+        shm_segment_info_.shmid = ::shmget(IPC_PRIVATE, required_size, \
+                                                        IPC_CREAT | 0600);
+        if( shm_segment_info_.shmid < 0 )
+        {
+            fprintf(stderr, "%s Error 2\n", __PRETTY_FUNCTION__);
+            releaseSharedImage();
+            return false;
+        }
+
+        shm_segment_info_.shmaddr = (char*)::shmat( \
+                                    shm_segment_info_.shmid, nullptr, 0);
+        shm_segment_info_.readOnly = False;
+
+        //! mark it removed right away, it lives until the last detach
+        ::shmctl(shm_segment_info_.shmid, IPC_RMID, nullptr);
+
+        if( shm_segment_info_.shmaddr == (char*)-1 )
+        {
+            fprintf(stderr, "%s Error 3\n", __PRETTY_FUNCTION__);
+            shm_segment_info_.shmaddr = nullptr;
+            releaseSharedImage();
+            return false;
+        }
+
+        if( false == ShmAttach::Attach(display_, &shm_segment_info_) )
+        {
+            fprintf(stderr, "%s Error 4\n", __PRETTY_FUNCTION__);
+            ::shmdt(shm_segment_info_.shmaddr);
+            shm_segment_info_.shmaddr = nullptr;
+            releaseSharedImage();
+            return false;
+        }
+
+        shm_segment_size_ = required_size;
+    }
+
+    shm_image_->data = shm_segment_info_.shmaddr;
+
+    return true;
+}
+
+
+void
+ScreenLens::releaseSharedImage()
+{
+    if( shm_image_ != nullptr )
+    {
+        shm_image_->data = nullptr; // the data belongs to the segment
+        XDestroyImage(shm_image_);
+        shm_image_ = nullptr;
+    }
+}
+
+
+void
+ScreenLens::releaseSharedSegment()
+{
+    if( shm_segment_size_ != 0 )
+    {
+        ::XShmDetach(display_, &shm_segment_info_);
+        ::XSync(display_, False);
+        ::shmdt(shm_segment_info_.shmaddr);
+        shm_segment_info_.shmaddr = nullptr;
+        shm_segment_size_ = 0;
+    }
+}
+
+
+bool
+ScreenLens::CaptureWithinBound
+(
+    int central_x, int central_y,
+    int bound_width, int bound_height,
+    struct CapturedFrame* const frame
+)
+{
+    if( bound_width > screen_width_ || bound_height > screen_height_ )
+    {
+        fprintf(stderr, "%s Error 1\n", __PRETTY_FUNCTION__);
+        return false;
+    }
+
+    if( false == reserveSharedImage(bound_width, bound_height) )
+    {
+        fprintf(stderr, "%s Error 2\n", __PRETTY_FUNCTION__);
+        return false;
+    }
+
+    const int bound_left = central_x - bound_width/2;
+    const int bound_top  = central_y - bound_height/2;
+
+    //! XShmGetImage needs the whole rectangle inside the root window, so
+    //! grab a shifted one, the conversion leaves the off-screen part black
+    const int grab_x = std::clamp(bound_left, 0, screen_width_ - bound_width);
+    const int grab_y = std::clamp(bound_top, 0, screen_height_ - bound_height);
+
+    if( False == ::XShmGetImage(display_, root_window_, shm_image_, \
+                                            grab_x, grab_y, AllPlanes) )
+    {
+        fprintf(stderr, "%s Error 3\n", __PRETTY_FUNCTION__);
+        return false;
+    }
+
+    //! only the damage inside this bound is consumed, the rest still has
+    //! to invalidate whatever else was captured from there
+    if( damage_ != 0 )
+    {
+        XRectangle captured_rect;
+        captured_rect.x = short(bound_left);
+        captured_rect.y = short(bound_top);
+        captured_rect.width = (unsigned short)bound_width;
+        captured_rect.height = (unsigned short)bound_height;
+
+        auto captured_region = ::XCreateRegion();
+        ::XUnionRectWithRegion(&captured_rect, captured_region, captured_region);
+        ::XSubtractRegion(damaged_region_, captured_region, damaged_region_);
+        ::XDestroyRegion(captured_region);
+    }
+
+    frame->data = (const uint8_t*)shm_image_->data;
+    frame->stride = shm_image_->bytes_per_line;
+    frame->bytes_per_pixel = 4;
+    frame->blue_offset = 0;
+    frame->green_offset = 1;
+    frame->red_offset = 2;
+    frame->left = grab_x;
+    frame->top = grab_y;
+    frame->width = bound_width;
+    frame->height = bound_height;
+    frame->screen_width = screen_width_;
+    frame->screen_height = screen_height_;
+
+    return true;
+}
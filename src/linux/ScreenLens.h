@@ -0,0 +1,109 @@
+#pragma once
+
+#include <X11/Xlib.h>
+#include <X11/Xutil.h>
+#include <X11/extensions/XShm.h>
+#include <X11/extensions/Xdamage.h>
+#include <X11/extensions/XInput2.h>
+
+#include <vector>
+#include <cstdint>
+
+#include "../FrameSource.h"
+
+
+void
+GetCurrentCursorPosition
+(
+    Display* display,
+    int* const x, int* const y
+);
+
+
+//! Captures a small block of the root window through one MIT-SHM segment.
+//! The segment is attached once and reused by every frame, the X server
+//! writes the pixels straight into it, so there is no XGetImage transfer
+//! through the socket per frame.
+class ScreenLens : public FrameSource
+{
+public:
+    //! track_activity: watch DAMAGE and XInput2 motion, for a picker
+    //! loop; a lens which only captures on demand never reads its events
+    ScreenLens(const char* display_name = nullptr, bool track_activity = true);
+    ~ScreenLens();
+private:
+    Display* display_ = nullptr;
+    Window root_window_ = 0;
+    Visual* visual_ = nullptr;
+    int depth_ = 0;
+    int screen_width_ = 0;
+    int screen_height_ = 0;
+private:
+    XShmSegmentInfo shm_segment_info_ = {};
+    size_t shm_segment_size_ = 0;
+    XImage* shm_image_ = nullptr;
+private:
+    //! damage rectangles reported since the last capture, when the server
+    //! has no DAMAGE extension every bound is considered dirty
+    Damage damage_ = 0;
+    int damage_event_base_ = 0;
+    Region damaged_region_ = nullptr;
+private:
+    //! XInput2 raw motion of every master pointer, also during the grab;
+    //! without XInput2 the cursor is polled
+    int xi_opcode_ = 0;
+    bool reports_motion_ = false;
+    //! what the server offers, whether the lens currently listens or not
+    bool has_damage_ = false;
+    bool has_xinput2_ = false;
+    bool motion_pending_ = true;
+    //! any DamageNotify since the last TakeActivity()
+    bool damage_pending_ = true;
+private:
+    bool reserveSharedImage(int width, int height);
+    void releaseSharedImage();
+    void releaseSharedSegment();
+public:
+    Display* NativeDisplay() const { return display_; }
+    int ScreenWidth() const override { return screen_width_; }
+    int ScreenHeight() const override { return screen_height_; }
+    //! the ICC profile the colour manager set for the screen, false when
+    //! there is none
+    bool DisplayColorProfile(std::vector<uint8_t>* const profile) const;
+public:
+    bool CurrentCursorPosition(int* const x, int* const y) override
+    {
+        GetCurrentCursorPosition(display_, x, y);
+        return true;
+    }
+public:
+    //! takes a DamageNotify out of the caller's event loop, false when the
+    //! event is not one of ours
+    bool ProcessDamageEvent(const XEvent& event);
+public:
+    //! takes an XI_RawMotion out of the caller's event loop, false when
+    //! the event is not one
+    bool ProcessMotionEvent(const XEvent& event);
+    //! the server sends motion events, the loop can wait for them
+    bool ReportsMotion() const { return reports_motion_; }
+    //! motion or damage since the last call; always true when the server
+    //! reports neither
+    bool TakeActivity();
+    //! a lens kept between two picks stops listening, DAMAGE and motion
+    //! would queue up on the server meanwhile, and listens again before
+    //! the next one; a resumed lens reports activity right away
+    void SuspendActivity();
+    void ResumeActivity();
+public:
+    bool ReportsDamage() const override { return damage_ != 0; }
+    bool IsDirtyWithinBound(
+        int central_x, int central_y,
+        int bound_width, int bound_height
+    ) override;
+public:
+    bool CaptureWithinBound(
+        int central_x, int central_y,
+        int bound_width, int bound_height,
+        struct CapturedFrame* const frame
+    ) override;
+};
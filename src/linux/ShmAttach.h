@@ -0,0 +1,70 @@
+#pragma once
+
+#include <X11/Xlib.h>
+#include <X11/extensions/XShm.h>
+#include <X11/Xproto.h>
+#include <X11/extensions/shmproto.h>
+
+#include <mutex>
+
+
+//! XShmAttach() with its error caught rather than left to Xlib's default
+//! handler, which exit()s the host process. The error handler is process
+//! wide and captures run on several threads (the picker, sample() on the
+//! libuv pool, the surface pools), so one attach at a time swaps it, and
+//! the handler only takes the X_ShmAttach error of the display attaching;
+//! any other error goes on to the handler installed before.
+class ShmAttach
+{
+private:
+    struct State
+    {
+        std::mutex mutex;
+        Display* display = nullptr;
+        int major_opcode = 0;
+        bool failed = false;
+        XErrorHandler previous_handler = nullptr;
+    };
+    static struct State& Current()
+    {
+        static struct State state;
+        return state;
+    }
+    static int ErrorHandler(Display* display, XErrorEvent* error)
+    {
+        auto& state = Current();
+        if( display == state.display && \
+            error->request_code == state.major_opcode && error->minor_code == X_ShmAttach )
+        {
+            state.failed = true;
+            return 0;
+        }
+        return state.previous_handler == nullptr ? 0 : state.previous_handler(display, error);
+    }
+public:
+    //! attaches segment_info on the server side and waits for the answer,
+    //! false when the server has no MIT-SHM or refused the segment
+    static bool Attach(Display* display, XShmSegmentInfo* segment_info)
+    {
+        int major_opcode = 0, first_event = 0, first_error = 0;
+        if( False == ::XQueryExtension(display, "MIT-SHM", \
+                                        &major_opcode, &first_event, &first_error) )
+        {
+            return false;
+        }
+
+        auto& state = Current();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.display = display;
+        state.major_opcode = major_opcode;
+        state.failed = false;
+        state.previous_handler = ::XSetErrorHandler(ErrorHandler);
+
+        ::XShmAttach(display, segment_info);
+        ::XSync(display, False);
+
+        ::XSetErrorHandler(state.previous_handler);
+        state.display = nullptr;
+        return state.failed == false;
+    }
+};
@@ -0,0 +1,284 @@
+#include "XShmSurfacePool.h"
+
+#include <sys/ipc.h>
+#include <sys/shm.h>
+
+#include <cstdio>
+#include <stdexcept>
+
+#include "ShmAttach.h"
+#include "../parameters.h"
+
+
+XShmSurfacePool::XShmSurfacePool(Display* display, int buffer_count) :
+    SurfacePool(buffer_count),
+    display_(display)
+{
+    fprintf(stderr, "%s\n", __PRETTY_FUNCTION__);
+
+    if( display_ == nullptr || False == ::XShmQueryExtension(display_) )
+    {
+        fprintf(stderr, "XShmSurfacePool Constructor Error 0\n");
+        throw std::runtime_error("XShmSurfacePool Constructor Error 0");
+    }
+
+    const auto screen = DefaultScreen(display_);
+    const auto root_window = RootWindow(display_, screen);
+
+    //! the circle needs the alpha channel, which only an ARGB visual (a
+    //! compositing manager) gives; the default visual shows the corners
+    XVisualInfo visual_info;
+    if( 0 != ::XMatchVisualInfo(display_, screen, 32, TrueColor, &visual_info) )
+    {
+        visual_ = visual_info.visual;
+        depth_  = visual_info.depth;
+    }
+    else
+    {
+        visual_ = DefaultVisual(display_, screen);
+        depth_  = DefaultDepth(display_, screen);
+    }
+
+    //! the surfaces hold 8-bit B, G, R, A in 32 bits pixels
+    if( (depth_ != 24 && depth_ != 32) || visual_->red_mask != 0xFF0000 || \
+        visual_->green_mask != 0x00FF00 || visual_->blue_mask != 0x0000FF )
+    {
+        fprintf(stderr, "XShmSurfacePool Constructor Error 1 depth %d\n", depth_);
+        throw std::runtime_error("XShmSurfacePool Constructor Error 1");
+    }
+
+    colormap_ = ::XCreateColormap(display_, root_window, visual_, AllocNone);
+
+    XSetWindowAttributes attributes = {};
+    attributes.override_redirect = True;
+    attributes.colormap = colormap_;
+    attributes.background_pixel = 0;
+    attributes.border_pixel = 0;
+    window_ = ::XCreateWindow(display_, root_window, 0, 0, \
+                    UI_WINDOW_SIZE, UI_WINDOW_SIZE, 0, depth_, InputOutput, \
+                    visual_, CWOverrideRedirect | CWColormap | CWBackPixel | \
+                                                    CWBorderPixel, &attributes);
+    if( window_ == 0 )
+    {
+        ::XFreeColormap(display_, colormap_);
+        fprintf(stderr, "XShmSurfacePool Constructor Error 2\n");
+        throw std::runtime_error("XShmSurfacePool Constructor Error 2");
+    }
+
+    gc_ = ::XCreateGC(display_, window_, 0, nullptr);
+    completion_event_type_ = ::XShmGetEventBase(display_) + ShmCompletion;
+}
+
+
+XShmSurfacePool::~XShmSurfacePool()
+{
+    fprintf(stderr, "%s\n", __PRETTY_FUNCTION__);
+
+    releaseSurfaces();
+
+    ::XFreeGC(display_, gc_);
+    ::XDestroyWindow(display_, window_);
+    ::XFreeColormap(display_, colormap_);
+    ::XFlush(display_);
+}
+
+
+bool
+XShmSurfacePool::allocateSurface
+(
+    int idx, int width, int height, int dpi,
+    struct RenderSurface* const surface
+)
+{
+    auto& buffer = buffers_[idx];
+
+    buffer.image = ::XShmCreateImage(display_, visual_, depth_, ZPixmap, \
+                            nullptr, &buffer.segment_info, width, height);
+    if( buffer.image == nullptr )
+    {
+        fprintf(stderr, "%s Error 1\n", __PRETTY_FUNCTION__);
+        return false;
+    }
+
+    const size_t required_size = \
+                    size_t(buffer.image->bytes_per_line)*buffer.image->height;
+
+    buffer.segment_info.shmid = ::shmget(IPC_PRIVATE, required_size, \
+                                                        IPC_CREAT | 0600);
+    if( buffer.segment_info.shmid < 0 )
+    {
+        fprintf(stderr, "%s Error 2\n", __PRETTY_FUNCTION__);
+        XDestroyImage(buffer.image);
+        buffer.image = nullptr;
+        return false;
+    }
+
+    buffer.segment_info.shmaddr = (char*)::shmat( \
+                                    buffer.segment_info.shmid, nullptr, 0);
+    buffer.segment_info.readOnly = True;
+
+    //! mark it removed right away, it lives until the last detach
+    ::shmctl(buffer.segment_info.shmid, IPC_RMID, nullptr);
+
+    if( buffer.segment_info.shmaddr == (char*)-1 )
+    {
+        fprintf(stderr, "%s Error 3\n", __PRETTY_FUNCTION__);
+        buffer.segment_info.shmaddr = nullptr;
+        XDestroyImage(buffer.image);
+        buffer.image = nullptr;
+        return false;
+    }
+
+    if( false == ShmAttach::Attach(display_, &buffer.segment_info) )
+    {
+        fprintf(stderr, "%s Error 4\n", __PRETTY_FUNCTION__);
+        ::shmdt(buffer.segment_info.shmaddr);
+        buffer.segment_info.shmaddr = nullptr;
+        XDestroyImage(buffer.image);
+        buffer.image = nullptr;
+        return false;
+    }
+
+    buffer.image->data = buffer.segment_info.shmaddr;
+    buffer.busy = false;
+
+    surface->pixels = reinterpret_cast<uint32_t*>(buffer.image->data);
+    surface->stride = buffer.image->bytes_per_line/4;
+
+    return true;
+}
+
+
+void
+XShmSurfacePool::releaseSurface(int idx)
+{
+    auto& buffer = buffers_[idx];
+    if( buffer.image == nullptr )
+    {
+        return;
+    }
+
+    //! the server may still read it, the detach below is ordered after the
+    //! put anyway
+    ::XShmDetach(display_, &buffer.segment_info);
+    ::XSync(display_, False);
+    ::shmdt(buffer.segment_info.shmaddr);
+    buffer.segment_info.shmaddr = nullptr;
+
+    buffer.image->data = nullptr; // the data belongs to the segment
+    XDestroyImage(buffer.image);
+    buffer.image = nullptr;
+    buffer.busy = false;
+}
+
+
+bool
+XShmSurfacePool::presentSurface
+(
+    int idx, int x, int y,
+    const struct RenderRect* const rects, int rect_count
+)
+{
+    auto& buffer = buffers_[idx];
+    const int width = buffer.image->width;
+    const int height = buffer.image->height;
+
+    const bool moved = mapped_ == false || x != window_x_ || y != window_y_ || \
+                    width != window_width_ || height != window_height_;
+    if( moved )
+    {
+        ::XMoveResizeWindow(display_, window_, x, y, \
+                            (unsigned int)width, (unsigned int)height);
+        window_x_ = x;
+        window_y_ = y;
+        window_width_ = width;
+        window_height_ = height;
+    }
+    if( mapped_ == false )
+    {
+        ::XMapRaised(display_, window_);
+        mapped_ = true;
+    }
+
+    //! only the last put asks for a completion, the server handles the
+    //! requests in order
+    struct RenderRect whole;
+    whole.width = width;
+    whole.height = height;
+    const struct RenderRect* puts = (moved || rects == nullptr) ? &whole : rects;
+    const int put_count = (moved || rects == nullptr) ? 1 : rect_count;
+    for(int put = 0; put < put_count; ++put)
+    {
+        const auto& rect = puts[put];
+        if( False == ::XShmPutImage(display_, window_, gc_, buffer.image, \
+                    rect.x, rect.y, rect.x, rect.y, (unsigned int)rect.width, \
+                    (unsigned int)rect.height, put == put_count - 1 ? True : False) )
+        {
+            fprintf(stderr, "%s Error 1\n", __PRETTY_FUNCTION__);
+            return false;
+        }
+    }
+    buffer.busy = put_count > 0;
+
+    ::XFlush(display_);
+    return true;
+}
+
+
+bool
+XShmSurfacePool::ProcessCompletionEvent
+(
+    const XEvent& event
+)
+{
+    if( event.type != completion_event_type_ )
+    {
+        return false;
+    }
+
+    auto completion_event = reinterpret_cast<const XShmCompletionEvent*>(&event);
+    for(auto& buffer : buffers_)
+    {
+        if( buffer.image != nullptr && \
+            buffer.segment_info.shmseg == completion_event->shmseg )
+        {
+            buffer.busy = false;
+            return true;
+        }
+    }
+    return false;
+}
+
+
+bool
+XShmSurfacePool::isSurfaceBusy(int idx)
+{
+    if( buffers_[idx].busy == false )
+    {
+        return false;
+    }
+
+    //! pick up whatever the caller's event loop has not dispatched yet
+    XEvent event;
+    while( True == ::XCheckTypedEvent(display_, completion_event_type_, &event) )
+    {
+        ProcessCompletionEvent(event);
+    }
+    return buffers_[idx].busy;
+}
+
+
+void
+XShmSurfacePool::waitSurface(int idx)
+{
+    //! once the server answered the round trip it has read every put
+    //! before it, whoever dispatches the ShmCompletion
+    ::XSync(display_, False);
+
+    XEvent event;
+    while( True == ::XCheckTypedEvent(display_, completion_event_type_, &event) )
+    {
+        ProcessCompletionEvent(event);
+    }
+    buffers_[idx].busy = false;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <X11/Xlib.h>
+#include <X11/Xutil.h>
+#include <X11/extensions/XShm.h>
+
+#include "../SurfacePool.h"
+
+
+//! The magnifier window of X11: an override-redirect window on a 32 bits
+//! ARGB visual (the default one when the server has none) fed from one
+//! MIT-SHM XImage per buffer. Present() is an XShmPutImage of the back
+//! buffer, which asks for a ShmCompletion so a buffer is only drawn into
+//! again once the server is done reading it.
+class XShmSurfacePool : public SurfacePool
+{
+public:
+    //! the display stays the caller's (ScreenLens::NativeDisplay())
+    XShmSurfacePool(Display* display, int buffer_count = MIN_BUFFER_COUNT);
+    ~XShmSurfacePool();
+private:
+    Display* const display_;
+    Visual* visual_ = nullptr;
+    int depth_ = 0;
+    Colormap colormap_ = 0;
+    Window window_ = 0;
+    GC gc_ = nullptr;
+    bool mapped_ = false;
+    //! where the window is, a present elsewhere puts the whole buffer
+    int window_x_ = 0;
+    int window_y_ = 0;
+    int window_width_ = 0;
+    int window_height_ = 0;
+    int completion_event_type_ = 0;
+private:
+    struct Buffer
+    {
+        XShmSegmentInfo segment_info = {};
+        XImage* image = nullptr;
+        //! put, no ShmCompletion for it yet
+        bool busy = false;
+    };
+    struct Buffer buffers_[MAX_BUFFER_COUNT];
+private:
+    bool allocateSurface(
+        int idx, int width, int height, int dpi,
+        struct RenderSurface* const surface
+    ) override;
+    void releaseSurface(int idx) override;
+    bool presentSurface(
+        int idx, int x, int y,
+        const struct RenderRect* const rects, int rect_count
+    ) override;
+    bool isSurfaceBusy(int idx) override;
+    void waitSurface(int idx) override;
+public:
+    Window NativeWindow() const { return window_; }
+public:
+    //! takes a ShmCompletion out of the caller's event loop, false when the
+    //! event is not one of ours
+    bool ProcessCompletionEvent(const XEvent& event);
+};
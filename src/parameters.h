@@ -1,6 +1,10 @@
 #pragma once
 
-#define __PRETTY_FUNCTION__ __FUNCSIG__
+#include <cstdint>
+
+#ifdef _MSC_VER
+    #define __PRETTY_FUNCTION__ __FUNCSIG__
+#endif // _MSC_VER
 
 /*
         /+/       <---------------------------
@@ -24,6 +28,13 @@ const int GRID_NUMUBER_L = 8;
 
 const int GRID_NUMUBER = GRID_NUMUBER_L*2 + 1;
 
+//! the defaults above, a session may pick any odd grid and any zoom in
+//! these bounds (PickerOptions), the window grows with them
+const int GRID_NUMUBER_MIN = 5;
+const int GRID_NUMUBER_MAX = 65;
+const int GRID_PIXEL_MIN = 3;
+const int GRID_PIXEL_MAX = 15;
+
 const int CAPTURE_WIDTH  = GRID_NUMUBER;
 const int CAPTURE_HEIGHT = GRID_NUMUBER;
 
@@ -32,20 +43,55 @@ const int CAPTURE_HEIGHT = GRID_NUMUBER;
 const int UI_WINDOW_SIZE = 16 + // <- window shadow
                            GRID_PIXEL + 2 + // center pixel
                            ((GRID_PIXEL + 1)*GRID_NUMUBER_L)*2;
+const int UI_WINDOW_MARGIN = 8;
 
-#elif defined(OS_WINDOWS)
+#elif defined(OS_WINDOWS) || defined(OS_LINUX)
 
 const int UI_WINDOW_SIZE = 0 + // <- without window shadow
                            GRID_PIXEL + 2 + // center pixel
                            ((GRID_PIXEL + 1)*GRID_NUMUBER_L)*2;
+const int UI_WINDOW_MARGIN = 0;
+
+#endif // defined(OS_WINDOWS) || defined(OS_LINUX)
+
+//! the magnifier is clipped to the circle inscribed in the window, this
+//! far from its edges
+const int UI_CIRCLE_INSET = UI_WINDOW_MARGIN + 4;
+
+//! the magnifier and its mask are drawn at an integer display scale, the
+//! masks come in 1x and 2x
+const int UI_SCALE_MAX = 2;
 
-#endif // defined(OS_WINDOWS)
+//! largest gridSize sample, the capture grows past the grid to hold it
+const int SAMPLE_SIZE_MAX = 101;
 
+//! the capture behind the grid, cursor moves inside a cached tile need no
+//! new capture at all
+const int TILE_SIZE = 256;
+const int TILE_CACHE_CAPACITY = 4;
+
+//! the tile of the position predicted that many ticks ahead is captured
+//! in the slack of the current tick, once the cursor moves fast enough
+const int CURSOR_PREDICTION_TICKS = 2;
+const float CURSOR_PREFETCH_MIN_SPEED = 4.0f; // pixels per tick
+
+//! the loop ticks on motion and damage events; without any it still looks
+//! at the cursor, backing off from CURSOR_REFRESH_FREQUENCY to
+//! IDLE_REFRESH_FREQUENCY (the polling rate when the server reports no
+//! motion stays CURSOR_REFRESH_FREQUENCY)
 const uint32_t CURSOR_REFRESH_FREQUENCY = 144;
 // const uint32_t CURSOR_REFRESH_FREQUENCY = 20;
-const uint32_t SCREEN_CAPTURE_FREQUENCY_TO_CURSOR_REFRESH_RATIO = 1; // 60 hz
-// const uint32_t SCREEN_CAPTURE_FREQUENCY_TO_CURSOR_REFRESH_RATIO = 3; // 20 hz
-// const uint32_t SCREEN_CAPTURE_FREQUENCY_TO_CURSOR_REFRESH_RATIO = 30; // 2 hz
+const uint32_t IDLE_REFRESH_FREQUENCY = 4;
+
+//! share of one core the loop may spend, ticks are spaced out to stay
+//! below it (PickerOptions::cpu_budget)
+const double CPU_BUDGET = 0.10;
+
+//! pickMany() buckets its points in tiles of that size, then merges two
+//! capture rects whenever the merged one covers at most POINT_MERGE_AREA
+//! more pixels than both, about what one more capture round trip costs
+const int POINT_CLUSTER_TILE = 64;
+const int POINT_MERGE_AREA = 256*256;
 
 
 
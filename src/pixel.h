@@ -0,0 +1,231 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+/*
+ * Pixel formats of the pipeline buffers. Captures come in as 8 bits per
+ * channel, so RGBA8 is lossless for them; RGB10A2 and RGBA16F are for HDR
+ * displays. Every format converts from 8 bits on capture and to float only
+ * where a stage needs it (averaging, colour management), through:
+ *
+ *   static PixelT FromRGB8(uint8_t r, uint8_t g, uint8_t b);
+ *   static PixelT FromFloat(const float* const rgba);  // [0, 1]
+ *   void ToFloat(float* const rgba) const;             // [0, 1]
+ *   uint8_t R8() const, G8() const, B8() const;
+ */
+
+struct PixelRGBA8
+{
+    uint8_t r = 0, g = 0, b = 0, a = 0;
+
+    static PixelRGBA8 FromRGB8(uint8_t r, uint8_t g, uint8_t b)
+    {
+        return PixelRGBA8{r, g, b, 0xFF};
+    }
+
+    static PixelRGBA8 FromFloat(const float* const rgba)
+    {
+        auto to_8 = [](float v) -> uint8_t
+        {
+            return v <= 0 ? 0 : v >= 1 ? 0xFF : uint8_t(v*255.0f + 0.5f);
+        };
+        return PixelRGBA8{to_8(rgba[0]), to_8(rgba[1]), \
+                                    to_8(rgba[2]), to_8(rgba[3])};
+    }
+
+    void ToFloat(float* const rgba) const
+    {
+        rgba[0] = r/255.0f;
+        rgba[1] = g/255.0f;
+        rgba[2] = b/255.0f;
+        rgba[3] = a/255.0f;
+    }
+
+    uint8_t R8() const { return r; }
+    uint8_t G8() const { return g; }
+    uint8_t B8() const { return b; }
+
+    //! 0xRRGGBBAA, as JS gets colours
+    uint32_t Packed() const
+    {
+        return uint32_t(r) << 24 | uint32_t(g) << 16 | uint32_t(b) << 8 | uint32_t(a);
+    }
+};
+
+static_assert( sizeof(PixelRGBA8) == 4 );
+
+
+//! r in bits 0..9, g in 10..19, b in 20..29, a in 30..31
+struct PixelRGB10A2
+{
+    uint32_t value = 0;
+
+    static uint32_t Expand8To10(uint8_t v) { return (uint32_t(v) << 2) | (v >> 6); }
+
+    static PixelRGB10A2 FromRGB8(uint8_t r, uint8_t g, uint8_t b)
+    {
+        return PixelRGB10A2{ Expand8To10(r) | (Expand8To10(g) << 10) | \
+                             (Expand8To10(b) << 20) | (3u << 30) };
+    }
+
+    static PixelRGB10A2 FromFloat(const float* const rgba)
+    {
+        auto to_n = [](float v, uint32_t max) -> uint32_t
+        {
+            return v <= 0 ? 0 : v >= 1 ? max : uint32_t(v*max + 0.5f);
+        };
+        return PixelRGB10A2{ to_n(rgba[0], 1023) | (to_n(rgba[1], 1023) << 10) | \
+                             (to_n(rgba[2], 1023) << 20) | (to_n(rgba[3], 3) << 30) };
+    }
+
+    void ToFloat(float* const rgba) const
+    {
+        rgba[0] = ((value      ) & 0x3FF)/1023.0f;
+        rgba[1] = ((value >> 10) & 0x3FF)/1023.0f;
+        rgba[2] = ((value >> 20) & 0x3FF)/1023.0f;
+        rgba[3] = ((value >> 30) & 0x3  )/3.0f;
+    }
+
+    uint8_t R8() const { return uint8_t(((value      ) & 0x3FF) >> 2); }
+    uint8_t G8() const { return uint8_t(((value >> 10) & 0x3FF) >> 2); }
+    uint8_t B8() const { return uint8_t(((value >> 20) & 0x3FF) >> 2); }
+};
+
+static_assert( sizeof(PixelRGB10A2) == 4 );
+
+
+//! IEEE 754 binary16 per channel, converted in software so it needs no F16C
+struct PixelRGBA16F
+{
+    uint16_t r = 0, g = 0, b = 0, a = 0;
+
+    static uint16_t FloatToHalf(float value)
+    {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+
+        const uint32_t sign = (bits >> 16) & 0x8000;
+        const int32_t exponent = int32_t((bits >> 23) & 0xFF) - 127 + 15;
+        uint32_t mantissa = bits & 0x7FFFFF;
+
+        if( exponent <= 0 )
+        {
+            if( exponent < -10 ) { return uint16_t(sign); }
+            mantissa |= 0x800000;
+            const uint32_t shift = uint32_t(14 - exponent);
+            uint32_t half = mantissa >> shift;
+            if( (mantissa >> (shift - 1)) & 1 ) { half += 1; } // round
+            return uint16_t(sign | half);
+        }
+        if( exponent >= 31 )
+        {
+            return uint16_t(sign | 0x7C00); // overflow to infinity
+        }
+
+        uint32_t half = sign | (uint32_t(exponent) << 10) | (mantissa >> 13);
+        if( mantissa & 0x1000 ) { half += 1; } // round, may carry into exponent
+        return uint16_t(half);
+    }
+
+    static float HalfToFloat(uint16_t half)
+    {
+        const uint32_t sign = uint32_t(half & 0x8000) << 16;
+        uint32_t exponent = (half >> 10) & 0x1F;
+        uint32_t mantissa = half & 0x3FF;
+        uint32_t bits = 0;
+
+        if( exponent == 0 )
+        {
+            if( mantissa == 0 )
+            {
+                bits = sign;
+            }
+            else
+            {
+                exponent = 127 - 15 + 1;
+                while( (mantissa & 0x400) == 0 ) { mantissa <<= 1; exponent -= 1; }
+                bits = sign | (exponent << 23) | ((mantissa & 0x3FF) << 13);
+            }
+        }
+        else if( exponent == 0x1F )
+        {
+            bits = sign | 0x7F800000 | (mantissa << 13);
+        }
+        else
+        {
+            bits = sign | ((exponent - 15 + 127) << 23) | (mantissa << 13);
+        }
+
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    static PixelRGBA16F FromRGB8(uint8_t r, uint8_t g, uint8_t b)
+    {
+        return PixelRGBA16F{ FloatToHalf(r/255.0f), FloatToHalf(g/255.0f), \
+                             FloatToHalf(b/255.0f), FloatToHalf(1.0f) };
+    }
+
+    static PixelRGBA16F FromFloat(const float* const rgba)
+    {
+        return PixelRGBA16F{ FloatToHalf(rgba[0]), FloatToHalf(rgba[1]), \
+                             FloatToHalf(rgba[2]), FloatToHalf(rgba[3]) };
+    }
+
+    void ToFloat(float* const rgba) const
+    {
+        rgba[0] = HalfToFloat(r);
+        rgba[1] = HalfToFloat(g);
+        rgba[2] = HalfToFloat(b);
+        rgba[3] = HalfToFloat(a);
+    }
+
+    static uint8_t To8(uint16_t half)
+    {
+        const float v = HalfToFloat(half);
+        return v <= 0 ? 0 : v >= 1 ? 0xFF : uint8_t(v*255.0f + 0.5f);
+    }
+
+    uint8_t R8() const { return To8(r); }
+    uint8_t G8() const { return To8(g); }
+    uint8_t B8() const { return To8(b); }
+};
+
+static_assert( sizeof(PixelRGBA16F) == 8 );
+
+
+//! the format the picker runs with unless asked otherwise
+typedef PixelRGBA8 ScreenPixel;
+
+
+//! a bound inside a bigger buffer, rows are `stride` pixels apart
+template <typename PixelT>
+struct ScreenPixelView
+{
+    const PixelT* data = nullptr;
+    int width = 0;
+    int height = 0;
+    int stride = 0;
+
+    const PixelT& At(int x, int y) const
+    {
+        return data[y*stride + x];
+    }
+};
+
+
+//! rows as the source captured them, before any conversion
+struct CapturedFrame
+{
+    const uint8_t* data = nullptr;
+    int stride = 0;             // bytes between two rows
+    int bytes_per_pixel = 0;
+    int red_offset = 0, green_offset = 0, blue_offset = 0;
+    //! the rectangle `data` holds, in screen coordinates
+    int left = 0, top = 0;
+    int width = 0, height = 0;
+    //! anything outside of it is black
+    int screen_width = 0, screen_height = 0;
+};
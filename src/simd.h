@@ -0,0 +1,24 @@
+#pragma once
+
+/*
+ * What the SIMD kernels (PixelConvert.cc, ColorTransform.cc) build on.
+ * Each kernel is compiled for its own instruction set through
+ * KERNEL_TARGET and only called once DetectConvertKernelLevel() said the
+ * CPU runs it, so the rest of the addon keeps the baseline flags.
+ */
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+  #define SIMD_X86 1
+  #include <immintrin.h>
+  #ifdef _MSC_VER
+    #include <intrin.h>
+  #endif
+#endif
+
+//! GCC and Clang only emit AVX instructions in functions asking for them,
+//! MSVC emits whatever intrinsic it is given
+#if defined(__GNUC__) || defined(__clang__)
+  #define KERNEL_TARGET(name) __attribute__((target(name)))
+#else
+  #define KERNEL_TARGET(name)
+#endif
@@ -13,5 +13,7 @@ emitter.on('end', () => console.log('Picker ended'));
 
 picker.init(emitter.emit.bind(emitter), {
     previousColor: '#112233',
-    gridSize: 3
-});
\ No newline at end of file
+    gridSize: 3,
+    loupeCells: 17,
+    zoom: 9
+}).then(color => console.log('picked', color));
\ No newline at end of file
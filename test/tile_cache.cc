@@ -0,0 +1,160 @@
+//! Cached tiles against damage: tiles overlap on their half tile grid and
+//! a capture consumes the damage of its whole bound, so recapturing one
+//! tile must not leave an overlapping one looking clean with old pixels.
+//! Runs a damage reporting source through the pipeline, exits non zero
+//! when a stale colour comes back:
+//!
+//!   ./build/Release/tile_cache_test
+
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <algorithm>
+
+#include "../src/PickerPipeline.h"
+
+
+//! a grey BGRX screen with a damage bitmap, cleared over every captured
+//! bound as ScreenLens clears its damage region
+class DamagedScreen : public FrameSource
+{
+public:
+    DamagedScreen(int width, int height)
+    :width_(width), height_(height), pixels_(size_t(width)*height*4, 0x80), \
+     dirty_(size_t(width)*height, 0)
+    {
+    }
+private:
+    const int width_;
+    const int height_;
+    std::vector<uint8_t> pixels_;
+    std::vector<uint8_t> dirty_;
+public:
+    int cursor_x = 0;
+    int cursor_y = 0;
+public:
+    //! paints one pixel and damages it
+    void Paint(int x, int y, uint8_t r, uint8_t g, uint8_t b)
+    {
+        auto pixel = &pixels_[(size_t(y)*width_ + x)*4];
+        pixel[0] = b;
+        pixel[1] = g;
+        pixel[2] = r;
+        dirty_[size_t(y)*width_ + x] = 1;
+    }
+public:
+    int ScreenWidth() const override { return width_; }
+    int ScreenHeight() const override { return height_; }
+    bool CurrentCursorPosition(int* const x, int* const y) override
+    {
+        *x = cursor_x;
+        *y = cursor_y;
+        return true;
+    }
+    bool ReportsDamage() const override { return true; }
+    bool IsDirtyWithinBound(int central_x, int central_y, int bound_width, int bound_height) override
+    {
+        const int left = std::max(0, central_x - bound_width/2);
+        const int top = std::max(0, central_y - bound_height/2);
+        const int right = std::min(width_, central_x - bound_width/2 + bound_width);
+        const int bottom = std::min(height_, central_y - bound_height/2 + bound_height);
+        for(int y = top; y < bottom; ++y)
+        {
+            for(int x = left; x < right; ++x)
+            {
+                if( dirty_[size_t(y)*width_ + x] != 0 )
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+    bool CaptureWithinBound(int central_x, int central_y, int bound_width, int bound_height, \
+                            struct CapturedFrame* const frame) override
+    {
+        const int bound_left = central_x - bound_width/2;
+        const int bound_top = central_y - bound_height/2;
+        const int grab_x = std::clamp(bound_left, 0, width_ - bound_width);
+        const int grab_y = std::clamp(bound_top, 0, height_ - bound_height);
+
+        for(int y = std::max(0, bound_top); y < std::min(height_, bound_top + bound_height); ++y)
+        {
+            for(int x = std::max(0, bound_left); x < std::min(width_, bound_left + bound_width); ++x)
+            {
+                dirty_[size_t(y)*width_ + x] = 0;
+            }
+        }
+
+        frame->data = &pixels_[(size_t(grab_y)*width_ + grab_x)*4];
+        frame->stride = width_*4;
+        frame->bytes_per_pixel = 4;
+        frame->blue_offset = 0;
+        frame->green_offset = 1;
+        frame->red_offset = 2;
+        frame->left = grab_x;
+        frame->top = grab_y;
+        frame->width = bound_width;
+        frame->height = bound_height;
+        frame->screen_width = width_;
+        frame->screen_height = height_;
+        return true;
+    }
+};
+
+
+static int failure_count = 0;
+
+
+static void
+ExpectColor(class PickerPipeline<PixelRGBA8>& pipeline, class DamagedScreen& screen, \
+            int x, int y, const char* expected)
+{
+    screen.cursor_x = x;
+    screen.cursor_y = y;
+    if( false == pipeline.Tick() )
+    {
+        fprintf(stderr, "tick at %d,%d failed\n", x, y);
+        failure_count += 1;
+        return;
+    }
+    const auto color = pipeline.CentralPixelColor();
+    if( color != expected )
+    {
+        fprintf(stderr, "at %d,%d: %s, expected %s\n", x, y, color.c_str(), expected);
+        failure_count += 1;
+    }
+}
+
+
+int
+main()
+{
+    class DamagedScreen screen(640, 480);
+    class PickerPipeline<PixelRGBA8> pipeline(&screen, {});
+    if( pipeline.Cache() == nullptr )
+    {
+        fprintf(stderr, "the pipeline keeps no tiles\n");
+        return 1;
+    }
+
+    //! tile A at (128, 128) and tile B at (256, 128) overlap over x 256..383
+    ExpectColor(pipeline, screen, 200, 200, "#808080");
+    ExpectColor(pipeline, screen, 300, 200, "#808080");
+    ExpectColor(pipeline, screen, 200, 200, "#808080");
+
+    //! damage in A and B; moving inside A recaptures A, which consumes it
+    screen.Paint(300, 200, 0xFF, 0x00, 0x00);
+    ExpectColor(pipeline, screen, 201, 200, "#808080");
+    ExpectColor(pipeline, screen, 300, 200, "#FF0000");
+    ExpectColor(pipeline, screen, 300, 200, "#FF0000");
+
+    if( failure_count != 0 )
+    {
+        fprintf(stderr, "tile_cache_test: %d failures\n", failure_count);
+        return 1;
+    }
+    fprintf(stderr, "tile_cache_test: ok\n");
+    return 0;
+}